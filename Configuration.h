@@ -4,7 +4,7 @@
  *
  * @mc       Arduino/RBBB
  * @autor    Christian Aschoff / caschoff _AT_ mac _DOT_ com
- * @version  1.5c
+ * @version  1.5d
  * @created  23.1.2013
  * @updated  14.04.2016 (Ergänzungen von A. Mueller)
  *
@@ -21,6 +21,25 @@
  * V 1.5a: - Optionen für die neue DCF77-Synchronisation hinzugefuegt.
  * V 1.5b: - Schalter für Zusatzoptionen von Qlockthree.ino hierher verlegt
  * V 1.5c: - Schalter für Timer2 entfernt, da kein Timer mehr für die Driftkorrektur benötigt wird
+ * V 1.5d: - Schalter WOERTER_DE_MKF fuer die deutsche Frontplatte nach mikrocontroller.net hinzugefuegt.
+ *         - Schalter TRANSITION_EFFECT und TRANSITION_STEP_MILLIS fuer Uebergaenge beim Minutenwechsel hinzugefuegt.
+ *         - Schalter LED_DRIVER_INTENSITY fuer eine Intensitaet pro Pixel hinzugefuegt.
+ *         - Schalter LED_DRIVER_PALETTE und PALETTE_HOURS_* fuer eine eigene Farbe der Stunden-Woerter hinzugefuegt.
+ *         - Schalter TEXT_SCROLLER, TEXT_SCROLLER_COLUMN_MILLIS und TEXT_SCROLLER_SYNC_LOST_MINUTES fuer Lauftexte hinzugefuegt.
+ *         - Schalter MYDCF77_QUIET_WINDOWS, MYDCF77_QUIET_GUARD_BINS und MYDCF77_QUIET_SUSPEND_MULTIPLEXING
+ *           fuer LED-Updates ausserhalb des DCF77-Impulses hinzugefuegt.
+ *         - Schalter LED_DRIVER_DEFAULT_TIMER und LED_DRIVER_DEFAULT_BCM_* fuer das Multiplexen per Timer-Interrupt hinzugefuegt.
+ *         - Schalter SHIFTREGISTER_SPI und SHIFTREGISTER_SPI_CLOCK fuer die Shift-Register ueber Hardware-SPI (mit
+ *           Umverdrahtung auf MOSI, SCK und SS) hinzugefuegt.
+ *         - Schalter LED_DRIVER_DOTSTAR_GLOBAL_BRIGHTNESS fuer die Helligkeit ueber das Helligkeitsfeld der APA102 hinzugefuegt.
+ *         - Schalter LED_DRIVER_GAMMA, LED_DRIVER_WHITE_BALANCE_* und LED_DRIVER_DITHER_MILLIS fuer Gamma-Korrektur
+ *           und Dithering der LED-Stripes hinzugefuegt.
+ *         - Schalter LED_DRIVER_CURRENT_LIMIT, LED_DRIVER_CURRENT_BUDGET_MA und LED_DRIVER_MA_PER_CHANNEL fuer die
+ *           Begrenzung des Stroms der LED-Stripes hinzugefuegt.
+ *         - Schalter MYDCF77_EDGE_CAPTURE und MYDCF77_EDGE_BUFFER fuer das DCF77-Signal per Interrupt hinzugefuegt.
+ *         - Schalter MYDCF77_MATCHED_FILTER und MYDCF77_MIN_CONFIDENCE fuer den DCF77Demodulator hinzugefuegt.
+ *         - Schalter MYDCF77_ACCUMULATOR und MYDCF77_ACCUMULATOR_THRESHOLD fuer den DCF77Accumulator hinzugefuegt.
+ *         - Schalter MYDCF77_RECORDER und MYDCF77_RECORDER_SERIAL fuer die Aufzeichnung des DCF77-Signals hinzugefuegt.
  */
 #ifndef CONFIGURATION_H
 #define CONFIGURATION_H
@@ -54,6 +73,17 @@
 // FPS im Debug-Modus anzeigen (Standard: eingeschaltet).
 #define FPS_SHOW_DEBUG
 
+// Deutsche Frontplatte in der Variante von mikrocontroller.net verwenden (Woerter_DE_MKF.h). (Standard: ausgeschaltet)
+//#define WOERTER_DE_MKF
+
+// Uebergang beim Minutenwechsel statt hartem Schnitt (siehe Transition.h). Moegliche Effekte:
+// TRANSITION_WIPE, TRANSITION_TYPEWRITER, TRANSITION_SCATTER, TRANSITION_CROSSFADE (Standard: ausgeschaltet).
+//#define TRANSITION_EFFECT TRANSITION_WIPE
+
+// Lauftext "SYNC OK" beim ersten erfolgreichen DCF77-Empfang nach dem Einschalten und wenn der Empfang
+// TEXT_SCROLLER_SYNC_LOST_MINUTES lang nicht geklappt hat (siehe TextScroller.h). (Standard: ausgeschaltet)
+//#define TEXT_SCROLLER
+
 /*
  * Alarmfunktion einschalten?
  * Dazu muss ein Lautsprecher an D13 und GND und eine weitere 'Eck-LED' an die 5te Reihe.
@@ -91,6 +121,60 @@
 
 #define LPD_ALT_LAYOUT
 
+/*
+ * DotStar: die Helligkeit grob ueber das 5-Bit-Helligkeitsfeld der APA102 und nur fein ueber die
+ * Farben. Dunkel bleiben so mehr Farbstufen uebrig, und ab 25% ist eine neue Helligkeit nur ein neues
+ * Helligkeitsfeld (keine neuen Farben). Der Streifen wird dafuer selbst ausgegeben (Bit-Banging).
+ * Default: ausgeschaltet
+ */
+// #define LED_DRIVER_DOTSTAR_GLOBAL_BRIGHTNESS
+
+/*
+ * Eine Intensitaet (0-255) pro Pixel zusaetzlich zum Bildspeicher (z.B. fuer das Ein- und Ausblenden
+ * einzelner Woerter). Wird nur von den LED-Stripes (NeoPixel, DotStar, LPD8806) ausgewertet und braucht
+ * 135 Byte RAM.
+ * Default: ausgeschaltet
+ */
+// #define LED_DRIVER_INTENSITY
+
+/*
+ * Eine Farbpalette mit 16 Plaetzen und ein Farbplatz (4 Bit) pro Pixel, statt einer Farbe fuer alles.
+ * Platz 0 ist die normale Farbe, die Stunden-Woerter bekommen Platz PALETTE_SLOT_HOURS mit der Farbe
+ * PALETTE_HOURS_*. Wird nur von den LED-Stripes (NeoPixel, DotStar, LPD8806) ausgewertet und braucht
+ * etwa 190 Byte RAM.
+ * Default: ausgeschaltet
+ */
+// #define LED_DRIVER_PALETTE
+#define PALETTE_SLOT_HOURS  1
+#define PALETTE_HOURS_RED   255
+#define PALETTE_HOURS_GREEN 140
+#define PALETTE_HOURS_BLUE  0
+
+/*
+ * Die LED-Stripes rechnen die Farben mit Gamma-Korrektur (ca. 2.2), Weissabgleich (LED_DRIVER_WHITE_BALANCE_*,
+ * 255 = voll) und einer Helligkeit mit 16 Bit. Im unteren Achtel wird zwischen zwei Stufen des Streifens alle
+ * LED_DRIVER_DITHER_MILLIS zeitlich gedithert, damit es nachts (LPD8806: nur 7 Bit) keine sichtbaren Spruenge
+ * gibt. Die Tabellen werden nur bei neuen Farben oder neuer Helligkeit berechnet. Braucht 512 Byte Flash und
+ * etwa 16 Byte RAM (mit LED_DRIVER_PALETTE etwa 100 Byte mehr als ohne Gamma).
+ * Default: ausgeschaltet, 255, 255, 255, 5.
+ */
+// #define LED_DRIVER_GAMMA
+#define LED_DRIVER_WHITE_BALANCE_RED   255
+#define LED_DRIVER_WHITE_BALANCE_GREEN 255
+#define LED_DRIVER_WHITE_BALANCE_BLUE  255
+#define LED_DRIVER_DITHER_MILLIS 5
+
+/*
+ * Die LED-Stripes schaetzen den Strom pro Bild ab (eingeschaltete LEDs * hellste Farbe * Helligkeit,
+ * LED_DRIVER_MA_PER_CHANNEL pro Farbe bei voller Stufe) und nehmen die Helligkeit zurueck, wenn er ueber
+ * LED_DRIVER_CURRENT_BUDGET_MA (Netzteil ohne den Ruhestrom der Stripes und des Arduino) liegt.
+ * Die eingeschalteten LEDs werden nur in den geaenderten Zeilen neu gezaehlt.
+ * Default: ausgeschaltet, 2000, 20.
+ */
+// #define LED_DRIVER_CURRENT_LIMIT
+#define LED_DRIVER_CURRENT_BUDGET_MA 2000
+#define LED_DRIVER_MA_PER_CHANNEL 20
+
 /*
  * Welche Uhr soll benutzt werden?
  */
@@ -131,6 +215,21 @@
  * (default = 8)
  */
 #define PWM_DURATION 8
+/*
+ * Das Multiplexen des Default-LED-Treibers per Timer1-Interrupt im Hintergrund statt mit
+ * delayMicroseconds() aus loop() heraus (nur AVR, Timer1 darf nicht anderweitig belegt sein).
+ * Pro Zeile werden die Shift-Register einmal beschrieben, danach wird die Helligkeit per
+ * Binary Code Modulation (BCM) ueber OutputEnable eingestellt: LED_DRIVER_DEFAULT_BCM_BITS
+ * Zeitscheiben mit 1, 2, 4... mal LED_DRIVER_DEFAULT_BCM_MICROS Mikrosekunden, an fuer jedes
+ * gesetzte Bit der Helligkeit. Eine Zeile dauert (2^BITS - 1) * MICROS plus das Schreiben
+ * der Shift-Register, bei 6 und 8 sind das ca. 0,7ms (ca. 140 Hz bei 10 Zeilen).
+ * PWM_DURATION und SKIP_BLANK_LINES haben dann keine Bedeutung, MYDCF77_QUIET_SUSPEND_MULTIPLEXING
+ * geht damit nicht.
+ * Default: ausgeschaltet, 6, 8.
+ */
+// #define LED_DRIVER_DEFAULT_TIMER
+#define LED_DRIVER_DEFAULT_BCM_BITS 6
+#define LED_DRIVER_DEFAULT_BCM_MICROS 8
 /*
  * Dieser Schalter stellt die Anzeige auf den Kopf, falls man die Kabel beim Anoden-
  * multiplexer nicht kreuzen moechte oder es vergessen hat.
@@ -147,6 +246,46 @@
  * Default: Ausgeschaltet
  */
 // #define OPTIMIZED_FOR_DARKNESS
+/*
+ * Die Shift-Register ueber Hardware-SPI beschreiben statt per Bit-Banging (Data an MOSI,
+ * Clock an SCK, beim ATmega328 also Pin 11 und 13). Die Platinen haben Data an 10, Clock an 12
+ * und Latch an 11 und muessen dafuer umverdrahtet werden: Data 10 -> 11 (MOSI), Clock 12 -> 13
+ * (SCK), Latch 11 -> 10 (SS). Der Lautsprecher an 13 wandert beim LED_DRIVER_DEFAULT auf A2,
+ * Pin 12 (MISO) ist mit SPI ein Eingang und bleibt frei. Die Pins setzt der Sketch.
+ * Die USART im SPI-Modus ist keine Alternative: sie braucht TXD0 und XCK0 (Pin 1 und 4), also
+ * die serielle Schnittstelle und die SQW-LED.
+ * Spalten und Zeile gehen als 32 Bit am Stueck raus, ohne Interrupts pro Bit zu sperren. Gemessen pro Zeile
+ * mit Latch (shift_register_bench, _turbo und _spi im Host-Build): Bit-Banging 98 digitalWrite(),
+ * SHIFTREGISTER_TURBO 98 Portzugriffe mit cli(), SPI 4 Byte (32 SPI-Takte, mit 8 MHz 4us) und 2 Portzugriffe.
+ * Das sind die beiden Latch-Flanken: prepareShiftregisterWrite() und finishShiftregisterWrite() schalten den
+ * Latch auch mit SPI per fastDigitalWriteToLatch() (ohne SHIFTREGISTER_TURBO per digitalWrite()), dort
+ * werden die Interrupts also weiter kurz gesperrt.
+ * Default: ausgeschaltet, 8000000.
+ */
+// #define SHIFTREGISTER_SPI
+#define SHIFTREGISTER_SPI_CLOCK 8000000
+
+// ------------------ Uebergaenge ---------------------
+/*
+ * Die Zeit zwischen zwei Schritten eines Uebergangs in Millisekunden.
+ * Ein Schritt selbst dauert nur wenige hundert Mikrosekunden (plus die Ausgabe
+ * auf die LEDs), dazwischen laeuft loop() normal weiter.
+ * Default: 40
+ */
+#define TRANSITION_STEP_MILLIS 40
+
+/*
+ * Die Geschwindigkeit des Lauftextes in Millisekunden pro Spalte.
+ * Default: 120
+ */
+#define TEXT_SCROLLER_COLUMN_MILLIS 120
+
+/*
+ * Nach wie vielen Minuten ohne erfolgreichen DCF77-Empfang gilt die Synchronisation als verloren?
+ * Der naechste Empfang zeigt dann wieder "SYNC OK" (sonst nur der erste nach dem Einschalten).
+ * Default: 60
+ */
+#define TEXT_SCROLLER_SYNC_LOST_MINUTES 60
 
 // ------------------ Tasten ---------------------
 /*
@@ -205,6 +344,7 @@
  * möglich, die Drift wird beliebig und es kann 
  * keine Zeiteinstellung via DCF mehr erfolgen.
  * Werte < 4 sind ebenso sinnlos.
+ * Mit MYDCF77_EDGE_CAPTURE gilt diese Grenze nicht.
  * Default: 11  (sinnvoll: 5 - 25)
  */
 #define MYDCF77_SIGNAL_BINS 11
@@ -218,6 +358,61 @@
  * Default: 30  (sinnvoll: 10 - 300)
  */
 #define MYDCF77_DRIFT_CORRECTION_TIME 30
+/*
+ * Aenderungen nur in den ruhigen Bins der Sekunde (ausserhalb des 100/200ms-Impulses,
+ * den MyDCF77 gerade abtastet) an die LEDs schicken. Aenderungen kommen dann
+ * um bis zu ca. 450ms verzoegert an.
+ * MYDCF77_QUIET_GUARD_BINS: Sicherheitsabstand in Bins vor und hinter dem Impuls.
+ * MYDCF77_QUIET_SUSPEND_MULTIPLEXING: auch das Multiplexen (LED_DRIVER_DEFAULT)
+ * waehrend des Impulses aussetzen. Das Display ist dann jede Sekunde kurz dunkel.
+ * Nicht mit LED_DRIVER_DEFAULT_TIMER (der Timer1-Interrupt multiplext unabhaengig
+ * von loop() weiter, das gibt einen Fehler beim Uebersetzen).
+ * Default: ausgeschaltet, 1, ausgeschaltet.
+ */
+// #define MYDCF77_QUIET_WINDOWS
+#define MYDCF77_QUIET_GUARD_BINS 1
+// #define MYDCF77_QUIET_SUSPEND_MULTIPLEXING
+/*
+ * Das DCF77-Signal per Interrupt (CHANGE, an Pins ohne externen Interrupt Pin-Change) aufzeichnen statt
+ * in jedem loop() abzufragen: die Flanken kommen mit Zeitstempel in einen Ringpuffer, poll() rechnet
+ * daraus die Dauer des Signals pro Bin. Langsame loop()-Durchlaeufe (Ausgabe auf die LEDs, I2C, Touch)
+ * verfaelschen den Empfang dann nicht mehr. MYDCF77_EDGE_BUFFER Flanken (Zweierpotenz, 4 Byte pro Flanke)
+ * muessen zwischen zwei poll()-Aufrufen Platz haben. Nicht mit MYDCF77_SIGNAL_IS_ANALOG.
+ * Default: ausgeschaltet, 16.
+ */
+// #define MYDCF77_EDGE_CAPTURE
+#define MYDCF77_EDGE_BUFFER 16
+/*
+ * Die Bits nicht aus den Bins (Maximum und Schwelle pro Sekunde) bestimmen, sondern mit dem DCF77Demodulator:
+ * 10ms-Slots, Korrelation mit 100ms- und 200ms-Impulsen, Software-PLL fuer die Phase der Sekunde und weiche
+ * Bits (-127 bis +127). Ein Telegramm mit einem Bit unter MYDCF77_MIN_CONFIDENCE wird verworfen.
+ * Die Bins laufen fuer die Driftkorrektur und MYDCF77_QUIET_WINDOWS weiter. Braucht ca. 200 Byte RAM.
+ * Default: ausgeschaltet, 32.
+ */
+// #define MYDCF77_MATCHED_FILTER
+#define MYDCF77_MIN_CONFIDENCE 32
+/*
+ * Die weichen Bits des DCF77Demodulator ueber mehrere Minuten sammeln (DCF77Accumulator): Stunde und Datum
+ * werden pro Bit aufaddiert, die Minute ueber alle 60 Kandidaten, die jede Minute eins weiterzaehlen.
+ * Die Zeit wird gestellt, sobald jedes Bit in der Summe MYDCF77_ACCUMULATOR_THRESHOLD (ein sicheres Bit
+ * ist 127) und die Minute den doppelten Vorsprung erreicht. Der DCF77Helper (drei passende Telegramme)
+ * und MYDCF77_MIN_CONFIDENCE werden dann nicht mehr gebraucht. Braucht MYDCF77_MATCHED_FILTER und ca. 210 Byte RAM.
+ * Default: ausgeschaltet, 192.
+ */
+// #define MYDCF77_ACCUMULATOR
+#define MYDCF77_ACCUMULATOR_THRESHOLD 192
+/*
+ * Das rohe DCF77-Signal binaer ueber MYDCF77_RECORDER_SERIAL aufzeichnen (DCF77Recorder): jede Flanke als
+ * 2-Byte-Wort (Pegel und Abstand in 64us), einmal pro Minute Kopf und RTC-Zeit. Das sind bei gutem Empfang
+ * weniger als 10 Byte pro Sekunde. Am Rechner schickt dcf77_replay (host/tools) die Aufzeichnung durch
+ * MyDCF77, DCF77Helper und MyRTC. Die Startmeldungen des Sketches entfallen dann.
+ * Auf Serial gehen DEBUG-Ausgaben in die Aufzeichnung: DCF77Replay liest ab dem naechsten Kopf (einmal pro
+ * Minute) wieder richtig, bis dahin ist die Aufzeichnung verloren. Wo es sie gibt (Leonardo, Mega, Teensy),
+ * besser Serial1 nehmen.
+ * Default: ausgeschaltet, Serial.
+ */
+// #define MYDCF77_RECORDER
+#define MYDCF77_RECORDER_SERIAL Serial
 /*
  * Ist das Signal invertiert (z.B. ELV-Empfaenger)?
  * Default: ausgeschaltet.
@@ -0,0 +1,209 @@
+/**
+ * DCF77Accumulator
+ * Sammelt die weichen Bits (DCF77Demodulator) ueber mehrere Minuten, damit
+ * auch bei schlechtem Empfang ein Telegramm zustande kommt:
+ * - Die Bits, die sich von Minute zu Minute nicht aendern (Zeitzone, Stunde,
+ *   Datum), werden pro Bit aufaddiert (begrenzt, damit eine Aenderung
+ *   durchkommt). Beim Stundenwechsel werden die Stunde und die Zeitzone,
+ *   beim Tageswechsel auch das Datum verworfen.
+ * - Die Minute zaehlt jede Minute weiter. Hier wird fuer jede der 60 moeglichen
+ *   Minuten aufaddiert, wie gut die empfangenen Bits (mit Paritaet) zu ihr
+ *   passen, und die Kandidaten werden jede Minute um eins weitergeschoben.
+ * Ein Telegramm gibt es erst, wenn jedes Bit und die beste Minute genug
+ * Vorsprung haben (MYDCF77_ACCUMULATOR_THRESHOLD).
+ *
+ * @mc       Arduino/RBBB
+ * @autor    agent / agent _AT_ local
+ *           Vorlage von: Christian Aschoff / caschoff _AT_ mac _DOT_ com
+ * @version  1.1
+ * @created  18.10.2026
+ * @updated  18.10.2026
+ *
+ * Versionshistorie:
+ * V 1.0:  - Erstellt.
+ * V 1.1:  - Das Telegramm als 64-Bit-Wort (wie MyDCF77::_telegram).
+ */
+#include "DCF77Accumulator.h"
+
+// #define DEBUG
+#include "Debug.h"
+
+// Die Summe pro Bit ist auf 4 sichere Telegramme begrenzt, eine Aenderung
+// (z.B. der Zeitzone) kommt also nach wenigen Minuten durch.
+#define DCF77_ACC_MAX_EVIDENCE (4 * 127)
+// Die Minuten-Kandidaten liegen hoechstens so weit unter dem besten.
+#define DCF77_ACC_MIN_SCORE (-16 * 127)
+
+// Bits im Telegramm.
+#define DCF77_ACC_BIT_Z1 17
+#define DCF77_ACC_BIT_Z2 18
+#define DCF77_ACC_BIT_LEAP 19
+#define DCF77_ACC_BIT_MINUTE 21
+#define DCF77_ACC_BIT_HOUR 29
+#define DCF77_ACC_BIT_P2 35
+#define DCF77_ACC_BIT_DATE 36
+
+DCF77Accumulator::DCF77Accumulator() {
+    reset();
+}
+
+/**
+ * Alles vergessen (z.B. wenn der DCF77Demodulator ausgerastet ist und nicht
+ * mehr bekannt ist, wieviele Minuten vergangen sind).
+ */
+void DCF77Accumulator::reset() {
+    _clearEvidence(DCF77_ACC_FIRST_BIT, MYDCF77_TELEGRAMMLAENGE - 1);
+    for (byte i = 0; i < 60; i++) {
+        _minuteScores[i] = 0;
+    }
+    _minuteOffset = 0;
+    _bestMinute = 0;
+    _minuteStable = false;
+    _telegrams = 0;
+}
+
+/**
+ * Das Telegramm der gerade vergangenen Minute dazunehmen. Das vorherige
+ * Telegramm muss genau eine Minute davor gewesen sein.
+ *
+ * @param softBits Die weichen Bits 0-58: -127 (sicher 0) bis +127 (sicher 1), 0 = unbekannt.
+ */
+void DCF77Accumulator::addTelegram(int8_t *softBits) {
+    if (_telegrams > 0) {
+        if (_bestMinute == 59) {
+            // Stundenwechsel (soweit die Minute schon stimmt)...
+            if (_hardValue(DCF77_ACC_BIT_HOUR, DCF77_ACC_BIT_P2 - 1) == 23) {
+                DEBUG_PRINTLN(F("DCF77Accumulator: new day."));
+                _clearEvidence(DCF77_ACC_BIT_DATE, MYDCF77_TELEGRAMMLAENGE - 1);
+            }
+            _clearEvidence(DCF77_ACC_BIT_HOUR, DCF77_ACC_BIT_P2);
+            _clearEvidence(DCF77_ACC_BIT_Z1, DCF77_ACC_BIT_Z2);
+        }
+        // alle Kandidaten sind jetzt eine Minute spaeter...
+        _minuteOffset = (_minuteOffset + 1) % 60;
+    }
+    if (_telegrams < 255) {
+        _telegrams++;
+    }
+
+    for (byte i = DCF77_ACC_FIRST_BIT; i < MYDCF77_TELEGRAMMLAENGE; i++) {
+        if ((i < DCF77_ACC_BIT_MINUTE) || (i >= DCF77_ACC_BIT_HOUR)) {
+            int *evidence = &_evidence[i - DCF77_ACC_FIRST_BIT];
+            *evidence = constrain(*evidence + softBits[i], -DCF77_ACC_MAX_EVIDENCE, DCF77_ACC_MAX_EVIDENCE);
+        }
+    }
+
+    int best = -32767;
+    byte bestIndex = 0;
+    for (byte j = 0; j < 60; j++) {
+        _minuteScores[j] += _score((j + _minuteOffset) % 60, softBits);
+        if (_minuteScores[j] > best) {
+            best = _minuteScores[j];
+            bestIndex = j;
+        }
+    }
+    for (byte j = 0; j < 60; j++) {
+        _minuteScores[j] = max(_minuteScores[j] - best, DCF77_ACC_MIN_SCORE);
+    }
+    byte bestMinute = (bestIndex + _minuteOffset) % 60;
+    // hat die Minute wie erwartet eins weitergezaehlt?
+    _minuteStable = (_telegrams > 1) && (bestMinute == (_bestMinute + 1) % 60);
+    _bestMinute = bestMinute;
+
+    DEBUG_PRINT(F("DCF77Accumulator: minute "));
+    DEBUG_PRINT(_bestMinute);
+    DEBUG_PRINT(F(", margin "));
+    DEBUG_PRINTLN(-_secondBestScore());
+}
+
+/**
+ * Das zusammengesetzte Telegramm bekommen (Bit n ist Sekunde n, wie MyDCF77::_telegram).
+ * Die Paritaeten und Bereiche prueft danach MyDCF77::decode().
+ *
+ * @return TRUE, wenn alle Bits und die Minute sicher genug sind und die Minute
+ *         schon in der Minute davor vorne lag.
+ */
+boolean DCF77Accumulator::getTelegram(uint64_t *telegram) {
+    if (!_minuteStable || (-_secondBestScore() < 2 * MYDCF77_ACCUMULATOR_THRESHOLD)) {
+        return false;
+    }
+    for (byte i = DCF77_ACC_FIRST_BIT; i < MYDCF77_TELEGRAMMLAENGE; i++) {
+        if ((i < DCF77_ACC_BIT_MINUTE) || (i >= DCF77_ACC_BIT_HOUR)) {
+            int evidence = _evidence[i - DCF77_ACC_FIRST_BIT];
+            if ((i != DCF77_ACC_BIT_LEAP) && (abs(evidence) < MYDCF77_ACCUMULATOR_THRESHOLD)) {
+                return false;
+            }
+        }
+    }
+
+    *telegram = (uint64_t)_minuteBits(_bestMinute) << DCF77_ACC_BIT_MINUTE;
+    for (byte i = DCF77_ACC_FIRST_BIT; i < MYDCF77_TELEGRAMMLAENGE; i++) {
+        if (((i < DCF77_ACC_BIT_MINUTE) || (i >= DCF77_ACC_BIT_HOUR)) && (_evidence[i - DCF77_ACC_FIRST_BIT] > 0)) {
+            *telegram |= (1ULL << i);
+        }
+    }
+    return true;
+}
+
+/**
+ * Die Bits 21-28 zu einer Minute: BCD, Bit 7 ist die Paritaet P1.
+ */
+byte DCF77Accumulator::_minuteBits(byte minute) {
+    byte bcd = ((minute / 10) << 4) | (minute % 10);
+    return bcd | (__builtin_parity(bcd) << 7);
+}
+
+/**
+ * Wie gut passen die weichen Bits 21-28 zu einer Minute?
+ */
+int DCF77Accumulator::_score(byte minute, int8_t *softBits) {
+    byte minuteBits = _minuteBits(minute);
+    int score = 0;
+    for (byte i = 0; i < 8; i++) {
+        if (minuteBits & (1 << i)) {
+            score += softBits[DCF77_ACC_BIT_MINUTE + i];
+        } else {
+            score -= softBits[DCF77_ACC_BIT_MINUTE + i];
+        }
+    }
+    return score;
+}
+
+/**
+ * Die Summen der Bits from-to (Telegramm-Positionen) vergessen.
+ */
+void DCF77Accumulator::_clearEvidence(byte from, byte to) {
+    for (byte i = from; i <= to; i++) {
+        _evidence[i - DCF77_ACC_FIRST_BIT] = 0;
+    }
+}
+
+/**
+ * Den BCD-Wert der Bits from-to nach dem bisherigen Stand.
+ */
+byte DCF77Accumulator::_hardValue(byte from, byte to) {
+    byte value = 0;
+    for (byte i = from; i <= to; i++) {
+        if (_evidence[i - DCF77_ACC_FIRST_BIT] > 0) {
+            byte k = i - from;
+            value += (k < 4) ? (1 << k) : (10 << (k - 4));
+        }
+    }
+    return value;
+}
+
+/**
+ * Der zweitbeste Minuten-Kandidat (der beste steht auf 0).
+ */
+int DCF77Accumulator::_secondBestScore() {
+    int second = DCF77_ACC_MIN_SCORE;
+    boolean bestSeen = false;
+    for (byte j = 0; j < 60; j++) {
+        if ((_minuteScores[j] == 0) && !bestSeen) {
+            bestSeen = true;
+        } else if (_minuteScores[j] > second) {
+            second = _minuteScores[j];
+        }
+    }
+    return second;
+}
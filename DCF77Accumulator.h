@@ -0,0 +1,63 @@
+/**
+ * DCF77Accumulator
+ * Sammelt die weichen Bits (DCF77Demodulator) ueber mehrere Minuten, damit
+ * auch bei schlechtem Empfang ein Telegramm zustande kommt:
+ * - Die Bits, die sich von Minute zu Minute nicht aendern (Zeitzone, Stunde,
+ *   Datum), werden pro Bit aufaddiert (begrenzt, damit eine Aenderung
+ *   durchkommt). Beim Stundenwechsel werden die Stunde und die Zeitzone,
+ *   beim Tageswechsel auch das Datum verworfen.
+ * - Die Minute zaehlt jede Minute weiter. Hier wird fuer jede der 60 moeglichen
+ *   Minuten aufaddiert, wie gut die empfangenen Bits (mit Paritaet) zu ihr
+ *   passen, und die Kandidaten werden jede Minute um eins weitergeschoben.
+ * Ein Telegramm gibt es erst, wenn jedes Bit und die beste Minute genug
+ * Vorsprung haben (MYDCF77_ACCUMULATOR_THRESHOLD).
+ *
+ * @mc       Arduino/RBBB
+ * @autor    agent / agent _AT_ local
+ *           Vorlage von: Christian Aschoff / caschoff _AT_ mac _DOT_ com
+ * @version  1.1
+ * @created  18.10.2026
+ * @updated  18.10.2026
+ *
+ * Versionshistorie:
+ * V 1.0:  - Erstellt.
+ * V 1.1:  - Das Telegramm als 64-Bit-Wort (wie MyDCF77::_telegram).
+ */
+#ifndef DCF77ACCUMULATOR_H
+#define DCF77ACCUMULATOR_H
+
+#include "Arduino.h"
+#include "Configuration.h"
+
+// Aufaddiert werden die Bits 17-58 (die Minute 21-28 aber ueber die Kandidaten).
+#define DCF77_ACC_FIRST_BIT 17
+#define DCF77_ACC_BITS (MYDCF77_TELEGRAMMLAENGE - DCF77_ACC_FIRST_BIT)
+
+class DCF77Accumulator {
+public:
+    DCF77Accumulator();
+
+    void reset();
+
+    void addTelegram(int8_t *softBits);
+    boolean getTelegram(uint64_t *telegram);
+
+private:
+    // Die Summe der weichen Bits 17-58.
+    int _evidence[DCF77_ACC_BITS];
+    // Wie gut die Minuten gepasst haben (0 = der beste Kandidat, die anderen darunter).
+    // _minuteScores[j] gehoert zur Minute (j + _minuteOffset) % 60.
+    int _minuteScores[60];
+    byte _minuteOffset;
+    byte _bestMinute;
+    boolean _minuteStable;
+    byte _telegrams;
+
+    byte _minuteBits(byte minute);
+    int _score(byte minute, int8_t *softBits);
+    void _clearEvidence(byte from, byte to);
+    byte _hardValue(byte from, byte to);
+    int _secondBestScore();
+};
+
+#endif
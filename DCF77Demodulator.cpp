@@ -0,0 +1,214 @@
+/**
+ * DCF77Demodulator
+ * Demodulator fuer das DCF77-Signal mit Korrelationsfilter und Software-PLL.
+ * Das Signal kommt als Pegel (0-255, Anteil HIGH) pro 10ms-Slot herein und
+ * wird mit Schablonen fuer den Sekundenimpuls verglichen:
+ * - Phase: 100ms Signal gegen die 100ms davor (unabhaengig vom Grundpegel,
+ *   den z.B. Stoerungen der LED-Stripes anheben). Die Position des Maximums
+ *   fuehrt eine PLL (Phase und Frequenz) nach.
+ * - Bit: der Pegel der zweiten 100ms gegen die ersten 100ms (Impuls) und
+ *   die 100ms vor der Sekunde (Grundpegel). Das Ergebnis ist ein weiches Bit
+ *   von -127 (sicher 0) ueber 0 (unsicher) bis +127 (sicher 1).
+ *
+ * @mc       Arduino/RBBB
+ * @autor    agent / agent _AT_ local
+ *           Vorlage von: Christian Aschoff / caschoff _AT_ mac _DOT_ com
+ * @version  1.0
+ * @created  18.10.2026
+ *
+ * Versionshistorie:
+ * V 1.0:  - Erstellt.
+ */
+#include "DCF77Demodulator.h"
+
+// #define DEBUG
+#include "Debug.h"
+
+// Eingerastet wird 30 Slots nach dem Beginn der Sekunde ausgewertet, der Impuls
+// wird also 30 Slots zurueck erwartet und in +/- 10 Slots darum gesucht.
+#define DCF77_DEMOD_EXPECTED 30
+#define DCF77_DEMOD_WINDOW 10
+
+// Nicht eingerastet wird alle 50 Slots im ganzen Puffer gesucht (Impulse 19-108 Slots zurueck).
+#define DCF77_DEMOD_SEARCH_FROM 19
+#define DCF77_DEMOD_SEARCH_TO 108
+#define DCF77_DEMOD_SEARCH_SLOTS 50
+
+// So viele Sekunden muss der Impuls an der erwarteten Stelle (+/- 2 Slots) sein.
+#define DCF77_DEMOD_LOCK_SECONDS 3
+// Nach so vielen Sekunden ohne Impuls (mehr als die Minutenmarke) ist die PLL ausgerastet.
+#define DCF77_DEMOD_MAX_MISSED 3
+// Der kleinste Impuls: 1/8 des vollen Pegels ueber 10 Slots.
+#define DCF77_DEMOD_MIN_PULSE 320
+
+DCF77Demodulator::DCF77Demodulator() {
+    reset();
+}
+
+/**
+ * Ausgerastet neu anfangen.
+ */
+void DCF77Demodulator::reset() {
+    for (byte i = 0; i < DCF77_DEMOD_RING; i++) {
+        _slots[i] = 0;
+    }
+    _write = 0;
+    _countdown = DCF77_DEMOD_SEARCH_SLOTS;
+    _lockCount = 0;
+    _missed = 0;
+    _locked = false;
+    _phase = 0;
+    _frequency = 0;
+    _amplitude = 0;
+    _softBit = 0;
+    _minuteMark = false;
+}
+
+/**
+ * Den naechsten Slot uebernehmen.
+ *
+ * @param level Der Anteil HIGH im Slot (0-255, nicht invertiert).
+ * @return TRUE, wenn eine Sekunde ausgewertet wurde (getSoftBit(), isMinuteMark()).
+ */
+boolean DCF77Demodulator::addSlot(byte level) {
+    _slots[_write & (DCF77_DEMOD_RING - 1)] = level;
+    _write++;
+    if (--_countdown != 0) {
+        return false;
+    }
+    boolean locked = _locked;
+    _evaluate();
+    return locked && _locked;
+}
+
+/**
+ * Das weiche Bit der zuletzt ausgewerteten Sekunde: -127 (sicher 0) bis +127 (sicher 1).
+ */
+int8_t DCF77Demodulator::getSoftBit() {
+    return _softBit;
+}
+
+/**
+ * Hatte die zuletzt ausgewertete Sekunde keinen Impuls (Sekunde 59)?
+ */
+boolean DCF77Demodulator::isMinuteMark() {
+    return _minuteMark;
+}
+
+boolean DCF77Demodulator::isLocked() {
+    return _locked;
+}
+
+/**
+ * Wieviele Slots (10ms) bis zum Beginn der naechsten Sekunde?
+ */
+byte DCF77Demodulator::getSlotsToSecondStart() {
+    return _countdown - DCF77_DEMOD_EXPECTED;
+}
+
+/**
+ * Der Slot, der vor back Slots geschrieben wurde (0 = der neueste).
+ */
+byte DCF77Demodulator::_slot(byte back) {
+    return _slots[(byte)(_write - 1 - back) & (DCF77_DEMOD_RING - 1)];
+}
+
+/**
+ * Die Summe der 10 Slots (100ms), die vor back Slots beginnen.
+ */
+int DCF77Demodulator::_sum(byte back) {
+    int sum = 0;
+    for (byte i = 0; i < 10; i++) {
+        sum += _slot(back - i);
+    }
+    return sum;
+}
+
+/**
+ * Den Beginn des Impulses suchen: das Maximum von 100ms Signal minus die 100ms davor.
+ *
+ * @param from, to Der Bereich (Slots zurueck).
+ * @param peak Die Hoehe des Maximums.
+ * @return Der Beginn des Impulses (Slots zurueck).
+ */
+byte DCF77Demodulator::_findPulse(byte from, byte to, int *peak) {
+    byte best = from;
+    *peak = -32767;
+    for (byte back = from; back <= to; back++) {
+        int correlation = _sum(back) - _sum(back + 10);
+        if (correlation > *peak) {
+            *peak = correlation;
+            best = back;
+        }
+    }
+    return best;
+}
+
+/**
+ * Auswertung: nicht eingerastet den Impuls suchen, eingerastet die PLL
+ * nachfuehren und das weiche Bit bestimmen.
+ */
+void DCF77Demodulator::_evaluate() {
+    int peak;
+    if (!_locked) {
+        byte back = _findPulse(DCF77_DEMOD_SEARCH_FROM, DCF77_DEMOD_SEARCH_TO, &peak);
+        if (peak < DCF77_DEMOD_MIN_PULSE) {
+            _lockCount = 0;
+            _countdown = DCF77_DEMOD_SEARCH_SLOTS;
+            return;
+        }
+        if ((_lockCount > 0) && (abs(back - DCF77_DEMOD_EXPECTED) <= 2)) {
+            _lockCount++;
+        } else {
+            _lockCount = 1;
+        }
+        // die naechste Sekunde so auswerten, dass ihr Impuls an der erwarteten Stelle liegt...
+        _countdown = DCF77_DEMOD_SLOTS_PER_SECOND + DCF77_DEMOD_EXPECTED - back;
+        if (_lockCount >= DCF77_DEMOD_LOCK_SECONDS) {
+            DEBUG_PRINTLN(F("DCF77Demodulator: locked."));
+            _locked = true;
+            _missed = 0;
+            _phase = 0;
+            _frequency = 0;
+            _amplitude = peak;
+        }
+        return;
+    }
+
+    byte back = _findPulse(DCF77_DEMOD_EXPECTED - DCF77_DEMOD_WINDOW, DCF77_DEMOD_EXPECTED + DCF77_DEMOD_WINDOW, &peak);
+    int error = 0;
+    if ((peak >= DCF77_DEMOD_MIN_PULSE) && (peak >= _amplitude / 3)) {
+        _minuteMark = false;
+        _missed = 0;
+        _amplitude += (peak - _amplitude) / 8;
+        // Impuls frueher als erwartet (weiter zurueck): die naechste Auswertung kommt frueher...
+        error = (back - DCF77_DEMOD_EXPECTED) * 16;
+        _frequency = constrain(_frequency + error / 32, -16, 16);
+    } else {
+        // kein Impuls: Minutenmarke oder Aussetzer...
+        _minuteMark = true;
+        _missed++;
+        if (_missed > DCF77_DEMOD_MAX_MISSED) {
+            DEBUG_PRINTLN(F("DCF77Demodulator: lost lock."));
+            _locked = false;
+            _lockCount = 0;
+            _countdown = DCF77_DEMOD_SEARCH_SLOTS;
+            return;
+        }
+    }
+
+    _phase += error / 4 + _frequency;
+    int shift = _phase / 16;
+    _phase -= shift * 16;
+    _countdown = DCF77_DEMOD_SLOTS_PER_SECOND - shift;
+
+    // das weiche Bit an der Stelle, an der die PLL den Impuls erwartet...
+    int pulse = _sum(DCF77_DEMOD_EXPECTED);
+    int second = _sum(DCF77_DEMOD_EXPECTED - 10);
+    int base = _sum(DCF77_DEMOD_EXPECTED + 10);
+    if (_minuteMark || (pulse - base <= 0)) {
+        _softBit = 0;
+    } else {
+        _softBit = constrain(127L * (2 * second - pulse - base) / (pulse - base), -127, 127);
+    }
+}
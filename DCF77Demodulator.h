@@ -0,0 +1,75 @@
+/**
+ * DCF77Demodulator
+ * Demodulator fuer das DCF77-Signal mit Korrelationsfilter und Software-PLL.
+ * Das Signal kommt als Pegel (0-255, Anteil HIGH) pro 10ms-Slot herein und
+ * wird mit Schablonen fuer den Sekundenimpuls verglichen:
+ * - Phase: 100ms Signal gegen die 100ms davor (unabhaengig vom Grundpegel,
+ *   den z.B. Stoerungen der LED-Stripes anheben). Die Position des Maximums
+ *   fuehrt eine PLL (Phase und Frequenz) nach.
+ * - Bit: der Pegel der zweiten 100ms gegen die ersten 100ms (Impuls) und
+ *   die 100ms vor der Sekunde (Grundpegel). Das Ergebnis ist ein weiches Bit
+ *   von -127 (sicher 0) ueber 0 (unsicher) bis +127 (sicher 1).
+ *
+ * @mc       Arduino/RBBB
+ * @autor    agent / agent _AT_ local
+ *           Vorlage von: Christian Aschoff / caschoff _AT_ mac _DOT_ com
+ * @version  1.0
+ * @created  18.10.2026
+ *
+ * Versionshistorie:
+ * V 1.0:  - Erstellt.
+ */
+#ifndef DCF77DEMODULATOR_H
+#define DCF77DEMODULATOR_H
+
+#include "Arduino.h"
+#include "Configuration.h"
+
+// Ein Slot ist 10ms lang, eine Sekunde hat 100 Slots.
+#define DCF77_DEMOD_SLOT_MICROS 10000
+#define DCF77_DEMOD_SLOTS_PER_SECOND 100
+// Der Ringpuffer der Slots (Zweierpotenz).
+#define DCF77_DEMOD_RING 128
+
+class DCF77Demodulator {
+public:
+    DCF77Demodulator();
+
+    void reset();
+
+    boolean addSlot(byte level);
+
+    int8_t getSoftBit();
+    boolean isMinuteMark();
+    boolean isLocked();
+    byte getSlotsToSecondStart();
+
+private:
+    byte _slots[DCF77_DEMOD_RING];
+    byte _write;
+
+    // Slots bis zur naechsten Auswertung.
+    byte _countdown;
+    // Aufeinanderfolgende Sekunden mit Impuls an der erwarteten Stelle (beim Einrasten)
+    // bzw. ohne Impuls (eingerastet).
+    byte _lockCount;
+    byte _missed;
+    boolean _locked;
+
+    // Die PLL: Phase (Rest unter einem Slot) und Frequenz in 1/16 Slot.
+    int _phase;
+    int _frequency;
+
+    // Die mittlere Hoehe des Impulses (Summe ueber 10 Slots).
+    int _amplitude;
+
+    int8_t _softBit;
+    boolean _minuteMark;
+
+    byte _slot(byte back);
+    int _sum(byte back);
+    byte _findPulse(byte from, byte to, int *peak);
+    void _evaluate();
+};
+
+#endif
@@ -0,0 +1,135 @@
+/**
+ * DCF77Recorder
+ * Zeichnet das rohe DCF77-Signal binaer ueber MYDCF77_RECORDER_SERIAL auf,
+ * damit sich Empfangsprobleme am Rechner nachstellen lassen (DCF77Replay).
+ * Das Format steht in DCF77Recorder.h.
+ *
+ * @mc       Arduino/RBBB
+ * @autor    agent / agent _AT_ local
+ *           Vorlage von: Christian Aschoff / caschoff _AT_ mac _DOT_ com
+ * @version  1.0
+ * @created  18.10.2026
+ *
+ * Versionshistorie:
+ * V 1.0:  - Erstellt.
+ */
+#include "DCF77Recorder.h"
+
+#ifdef MYDCF77_EDGE_CAPTURE
+#define DCF77_RECORDING_FLAGS DCF77_RECORDING_FLAG_EDGES
+#elif defined(MYDCF77_SIGNAL_IS_ANALOG)
+#define DCF77_RECORDING_FLAGS DCF77_RECORDING_FLAG_ANALOG
+#else
+#define DCF77_RECORDING_FLAGS 0
+#endif
+
+DCF77Recorder::DCF77Recorder() {
+    _started = false;
+    _level = false;
+    _lastTime = 0;
+    _units = 0;
+    _droppedWords = 0;
+    _timePending = false;
+}
+
+/**
+ * Den Pegel aufzeichnen. Ein Wort kommt nur bei einer Flanke, nach einer
+ * langen Pause oder mit der RTC-Zeit, sonst kostet der Aufruf fast nichts.
+ *
+ * @param time Der Zeitpunkt (micros(), nicht kleiner als beim letzten Aufruf).
+ * @param level Der Pegel am Pin (HIGH = TRUE, nicht invertiert).
+ */
+void DCF77Recorder::record(unsigned long time, boolean level) {
+    if (!_started) {
+        _level = level;
+        _lastTime = time;
+        _started = _writeHeaderAndTime();
+        return;
+    }
+    unsigned long units = (time - _lastTime) >> DCF77_RECORDING_UNIT_SHIFT;
+    if ((level == _level) && (units < DCF77_RECORDING_MAX_DELTA) && !_timePending) {
+        return;
+    }
+    // lange Pausen in Stuecken...
+    while (units >= DCF77_RECORDING_MAX_DELTA) {
+        if (!_writeLevel(_level, DCF77_RECORDING_MAX_DELTA)) {
+            return;
+        }
+        units -= DCF77_RECORDING_MAX_DELTA;
+    }
+    // mit der RTC-Zeit auch ohne Flanke bis jetzt, aber nur, wenn Kopf und Zeit danach
+    // auch passen (sonst frisst das Wort bei jedem Aufruf den Sendepuffer, der Kopf kommt nie)...
+    boolean timeFits = _timePending && (MYDCF77_RECORDER_SERIAL.availableForWrite()
+                                        >= 2 + DCF77_RECORDING_HEADER_LENGTH + 2 + DCF77_RECORDING_TIME_LENGTH);
+    if ((level != _level) || timeFits) {
+        if (!_writeLevel(level, units)) {
+            return;
+        }
+    }
+    if (timeFits) {
+        _writeHeaderAndTime();
+    }
+}
+
+/**
+ * Die RTC-Zeit beim naechsten record() in die Aufzeichnung schreiben
+ * (einmal pro Minute, fuer den DCF77Helper beim Abspielen).
+ */
+void DCF77Recorder::setTime(TimeStamp *rtc, byte seconds) {
+    _time[0] = rtc->getYear();
+    _time[1] = rtc->getMonth();
+    _time[2] = rtc->getDate();
+    _time[3] = rtc->getDayOfWeek();
+    _time[4] = rtc->getHours();
+    _time[5] = rtc->getMinutes();
+    _time[6] = seconds;
+    _timePending = true;
+}
+
+/**
+ * Ein Pegel-Wort schreiben, wenn im Sendepuffer Platz ist.
+ */
+boolean DCF77Recorder::_writeLevel(boolean level, unsigned int units) {
+    if (MYDCF77_RECORDER_SERIAL.availableForWrite() < 2) {
+        if (_droppedWords < 255) {
+            _droppedWords++;
+        }
+        return false;
+    }
+    _writeWord((level ? 0x8000 : 0) | units);
+    _level = level;
+    _lastTime += (unsigned long)units << DCF77_RECORDING_UNIT_SHIFT;
+    _units += units;
+    return true;
+}
+
+/**
+ * Kopf, aktuellen Pegel und (wenn vorhanden) die RTC-Zeit schreiben,
+ * wenn im Sendepuffer Platz ist.
+ */
+boolean DCF77Recorder::_writeHeaderAndTime() {
+    if (MYDCF77_RECORDER_SERIAL.availableForWrite() < DCF77_RECORDING_HEADER_LENGTH + 2 + DCF77_RECORDING_TIME_LENGTH) {
+        return false;
+    }
+    _writeWord(DCF77_RECORDING_HEADER);
+    MYDCF77_RECORDER_SERIAL.write('D');
+    MYDCF77_RECORDER_SERIAL.write('C');
+    MYDCF77_RECORDER_SERIAL.write('F');
+    MYDCF77_RECORDER_SERIAL.write(DCF77_RECORDING_VERSION);
+    MYDCF77_RECORDER_SERIAL.write(DCF77_RECORDING_FLAGS);
+    _writeWord(_units);
+    _writeWord(_units >> 16);
+    _writeWord(_level ? 0x8000 : 0);
+    if (_timePending) {
+        _writeWord(DCF77_RECORDING_TIME);
+        MYDCF77_RECORDER_SERIAL.write(_time, sizeof(_time));
+        MYDCF77_RECORDER_SERIAL.write(_droppedWords);
+        _timePending = false;
+    }
+    return true;
+}
+
+void DCF77Recorder::_writeWord(word w) {
+    MYDCF77_RECORDER_SERIAL.write(lowByte(w));
+    MYDCF77_RECORDER_SERIAL.write(highByte(w));
+}
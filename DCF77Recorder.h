@@ -0,0 +1,79 @@
+/**
+ * DCF77Recorder
+ * Zeichnet das rohe DCF77-Signal binaer ueber MYDCF77_RECORDER_SERIAL auf,
+ * damit sich Empfangsprobleme am Rechner nachstellen lassen (DCF77Replay).
+ *
+ * Format (Worte little endian):
+ * - Pegel-Wort: Bit 15 ist der Pegel (HIGH = 1, nicht invertiert), Bit 0-14
+ *   der Abstand zum vorigen Pegel-Wort in Einheiten von 64us (hoechstens
+ *   0x7FFE, ca. 2,1s). Ist der Pegel gleich geblieben, war es keine Flanke,
+ *   sondern nur eine Pause.
+ * - Kopf: 0xFFFF, 'D', 'C', 'F', Version, Flags, Zeit (32 Bit, die Summe aller
+ *   Abstaende seit dem Start in 64us, also die Zeit des vorigen Pegel-Worts).
+ *   Danach kommt ein Pegel-Wort mit Abstand 0 (der aktuelle Pegel).
+ * - RTC-Zeit: 0x7FFF, Jahr, Monat, Tag, Wochentag, Stunde, Minute, Sekunde,
+ *   verlorene Worte (bis 255) - zur Zeit des vorigen Pegel-Worts.
+ * Die RTC-Zeit kommt einmal pro Minute, immer mit Kopf davor, in eine
+ * laufende Aufzeichnung kann man also einsteigen. Ist der Sendepuffer voll,
+ * kommt eine Flanke verspaetet und die verlorenen Worte zaehlen hoch.
+ * Geschrieben wird auf MYDCF77_RECORDER_SERIAL (Configuration.h). Kommen dort
+ * andere Ausgaben dazwischen, liest DCF77Replay ab dem naechsten Kopf wieder
+ * richtig, mit der Zeit aus dem Kopf.
+ *
+ * @mc       Arduino/RBBB
+ * @autor    agent / agent _AT_ local
+ *           Vorlage von: Christian Aschoff / caschoff _AT_ mac _DOT_ com
+ * @version  1.0
+ * @created  18.10.2026
+ *
+ * Versionshistorie:
+ * V 1.0:  - Erstellt.
+ */
+#ifndef DCF77RECORDER_H
+#define DCF77RECORDER_H
+
+#include "Arduino.h"
+#include "Configuration.h"
+#include "TimeStamp.h"
+
+#define DCF77_RECORDING_VERSION 2
+#define DCF77_RECORDING_UNIT_SHIFT 6
+#define DCF77_RECORDING_MAX_DELTA 0x7FFE
+
+// Die Worte fuer Kopf und RTC-Zeit (kommen als Abstand nicht vor).
+#define DCF77_RECORDING_HEADER 0xFFFF
+#define DCF77_RECORDING_TIME 0x7FFF
+// Laenge in Bytes, mit Wort.
+#define DCF77_RECORDING_HEADER_LENGTH 11
+#define DCF77_RECORDING_TIME_LENGTH 10
+
+// Flags im Kopf.
+#define DCF77_RECORDING_FLAG_EDGES 0x01
+#define DCF77_RECORDING_FLAG_ANALOG 0x02
+
+class DCF77Recorder {
+public:
+    DCF77Recorder();
+
+    void record(unsigned long time, boolean level);
+    void setTime(TimeStamp *rtc, byte seconds);
+
+private:
+    boolean _started;
+    // Pegel und Zeit (micros(), auf die Einheit genau) des letzten Pegel-Worts.
+    boolean _level;
+    unsigned long _lastTime;
+    // Die Summe aller geschriebenen Abstaende (fuer den Kopf).
+    unsigned long _units;
+    byte _droppedWords;
+
+    // Die RTC-Zeit fuer den naechsten Aufruf von record().
+    boolean _timePending;
+    byte _time[7];
+
+    boolean _writeLevel(boolean level, unsigned int units);
+    boolean _writeHeaderAndTime();
+    void _writeWord(word w);
+};
+
+#endif
@@ -0,0 +1,158 @@
+/**
+ * DCF77Replay
+ * Liest eine Aufzeichnung des DCF77Recorder Byte fuer Byte, z.B. um sie am
+ * Rechner mit voller Geschwindigkeit durch MyDCF77 und DCF77Helper zu
+ * schicken. Das Format steht in DCF77Recorder.h.
+ *
+ * @mc       Arduino/RBBB
+ * @autor    agent / agent _AT_ local
+ *           Vorlage von: Christian Aschoff / caschoff _AT_ mac _DOT_ com
+ * @version  1.0
+ * @created  18.10.2026
+ *
+ * Versionshistorie:
+ * V 1.0:  - Erstellt.
+ */
+#include "DCF77Replay.h"
+
+DCF77Replay::DCF77Replay() {
+    for (byte i = 0; i < DCF77_RECORDING_HEADER_LENGTH; i++) {
+        _window[i] = 0;
+        _buffer[i] = 0;
+    }
+    for (byte i = 0; i < DCF77_RECORDING_TIME_LENGTH - 2; i++) {
+        _rtc[i] = 0;
+    }
+    _count = 0;
+    _synced = false;
+    _headers = 0;
+    _resyncs = 0;
+    _firstUnits = 0;
+    _time = 0;
+    _level = false;
+    _flags = 0;
+}
+
+/**
+ * Das naechste Byte der Aufzeichnung lesen.
+ *
+ * @return DCF77_REPLAY_NONE, solange ein Wort unvollstaendig ist, sonst was gelesen wurde.
+ */
+byte DCF77Replay::feed(byte b) {
+    // die letzten Bytes immer nach einem Kopf durchsuchen, auch mitten in einem Wort...
+    for (byte i = 1; i < DCF77_RECORDING_HEADER_LENGTH; i++) {
+        _window[i - 1] = _window[i];
+    }
+    _window[DCF77_RECORDING_HEADER_LENGTH - 1] = b;
+    if (_isHeader()) {
+        // ...passt er nicht zum gelesenen Wort, war die Aufzeichnung kaputt...
+        if ((_headers > 0) && (!_synced || (_count != DCF77_RECORDING_HEADER_LENGTH - 1))) {
+            _resyncs++;
+        }
+        unsigned long units = _window[7] | ((unsigned long)_window[8] << 8)
+            | ((unsigned long)_window[9] << 16) | ((unsigned long)_window[10] << 24);
+        if (_headers == 0) {
+            _firstUnits = units;
+        }
+        _headers++;
+        _synced = true;
+        _count = 0;
+        _flags = _window[6];
+        _time = (unsigned long)(uint32_t)(units - _firstUnits) << DCF77_RECORDING_UNIT_SHIFT;
+        return DCF77_REPLAY_HEADER;
+    }
+    if (!_synced) {
+        return DCF77_REPLAY_NONE;
+    }
+
+    _buffer[_count++] = b;
+    if (_count < 2) {
+        return DCF77_REPLAY_NONE;
+    }
+    word w = _buffer[0] | (_buffer[1] << 8);
+    if (w == DCF77_RECORDING_HEADER) {
+        if (_count < DCF77_RECORDING_HEADER_LENGTH) {
+            return DCF77_REPLAY_NONE;
+        }
+        // kein Kopf (oben), also Aufzeichnung kaputt (z.B. andere Ausgaben dazwischen), neu suchen...
+        _count = 0;
+        _synced = false;
+        return DCF77_REPLAY_NONE;
+    }
+    if (w == DCF77_RECORDING_TIME) {
+        if (_count < DCF77_RECORDING_TIME_LENGTH) {
+            return DCF77_REPLAY_NONE;
+        }
+        _count = 0;
+        for (byte i = 0; i < DCF77_RECORDING_TIME_LENGTH - 2; i++) {
+            _rtc[i] = _buffer[i + 2];
+        }
+        return DCF77_REPLAY_TIME;
+    }
+    _count = 0;
+    _time += (unsigned long)(w & 0x7FFF) << DCF77_RECORDING_UNIT_SHIFT;
+    _level = (w & 0x8000) != 0;
+    return DCF77_REPLAY_LEVEL;
+}
+
+/**
+ * Die Zeit des letzten Kopfs oder Pegel-Worts in us seit dem ersten Kopf (laeuft
+ * wie micros() ueber).
+ */
+unsigned long DCF77Replay::getTime() {
+    return _time;
+}
+
+/**
+ * Der Pegel ab dem letzten Pegel-Wort (HIGH = TRUE, nicht invertiert).
+ */
+boolean DCF77Replay::getLevel() {
+    return _level;
+}
+
+/**
+ * Die Flags aus dem letzten Kopf (DCF77_RECORDING_FLAG_EDGES, DCF77_RECORDING_FLAG_ANALOG).
+ */
+byte DCF77Replay::getFlags() {
+    return _flags;
+}
+
+/**
+ * Die RTC-Zeit aus dem letzten DCF77_REPLAY_TIME.
+ */
+void DCF77Replay::getRtc(TimeStamp *rtc) {
+    rtc->set(_rtc[5], _rtc[4], _rtc[2], _rtc[3], _rtc[1], _rtc[0]);
+}
+
+byte DCF77Replay::getRtcSeconds() {
+    return _rtc[6];
+}
+
+/**
+ * Wieviele Worte der DCF77Recorder bis zum letzten DCF77_REPLAY_TIME wegen
+ * eines vollen Sendepuffers verspaetet schreiben musste (bis 255).
+ */
+byte DCF77Replay::getDroppedWords() {
+    return _rtc[7];
+}
+
+/**
+ * Wieviele Koepfe gelesen wurden.
+ */
+unsigned long DCF77Replay::getHeaders() {
+    return _headers;
+}
+
+/**
+ * Wie oft die Aufzeichnung kaputt war und erst ab dem naechsten Kopf weiter
+ * gelesen werden konnte.
+ */
+unsigned long DCF77Replay::getResyncs() {
+    return _resyncs;
+}
+
+boolean DCF77Replay::_isHeader() {
+    return (_window[0] == 0xFF) && (_window[1] == 0xFF)
+        && (_window[2] == 'D') && (_window[3] == 'C') && (_window[4] == 'F')
+        && (_window[5] == DCF77_RECORDING_VERSION);
+}
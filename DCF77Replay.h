@@ -0,0 +1,73 @@
+/**
+ * DCF77Replay
+ * Liest eine Aufzeichnung des DCF77Recorder Byte fuer Byte, z.B. um sie am
+ * Rechner mit voller Geschwindigkeit durch MyDCF77 und DCF77Helper zu
+ * schicken (host/tools/Dcf77ReplayTool.cpp, dcf77_replay).
+ * Ein Kopf wird an jeder Stelle erkannt, auch mitten in einem Wort: bis zum
+ * ersten Kopf wird alles ueberlesen (Textausgaben beim Start, Einstieg in eine
+ * laufende Aufzeichnung), und kommen andere Ausgaben dazwischen, geht es ab
+ * dem naechsten Kopf mit dessen Zeit weiter. Was dazwischen als Pegel-Wort
+ * gelesen wurde, ist Unsinn, getTime() kann dann zurueckspringen.
+ *
+ * @mc       Arduino/RBBB
+ * @autor    agent / agent _AT_ local
+ *           Vorlage von: Christian Aschoff / caschoff _AT_ mac _DOT_ com
+ * @version  1.0
+ * @created  18.10.2026
+ *
+ * Versionshistorie:
+ * V 1.0:  - Erstellt.
+ */
+#ifndef DCF77REPLAY_H
+#define DCF77REPLAY_H
+
+#include "Arduino.h"
+#include "TimeStamp.h"
+#include "DCF77Recorder.h"
+
+// Was feed() gelesen hat.
+#define DCF77_REPLAY_NONE 0
+#define DCF77_REPLAY_HEADER 1
+#define DCF77_REPLAY_LEVEL 2
+#define DCF77_REPLAY_TIME 3
+
+class DCF77Replay {
+public:
+    DCF77Replay();
+
+    byte feed(byte b);
+
+    unsigned long getTime();
+    boolean getLevel();
+    byte getFlags();
+
+    void getRtc(TimeStamp *rtc);
+    byte getRtcSeconds();
+    byte getDroppedWords();
+
+    unsigned long getHeaders();
+    unsigned long getResyncs();
+
+private:
+    // Die letzten Bytes, um einen Kopf an jeder Stelle zu erkennen.
+    byte _window[DCF77_RECORDING_HEADER_LENGTH];
+    // Das aktuelle Wort (der Kopf ist das laengste).
+    byte _buffer[DCF77_RECORDING_HEADER_LENGTH];
+    byte _count;
+    boolean _synced;
+    unsigned long _headers;
+    unsigned long _resyncs;
+    // Die Zeit aus dem ersten Kopf (in 64us).
+    unsigned long _firstUnits;
+
+    // Die Zeit (us seit dem ersten Kopf) und der Pegel nach dem letzten Kopf oder Pegel-Wort.
+    unsigned long _time;
+    boolean _level;
+    byte _flags;
+    // Jahr, Monat, Tag, Wochentag, Stunde, Minute, Sekunde, verlorene Worte.
+    byte _rtc[DCF77_RECORDING_TIME_LENGTH - 2];
+
+    boolean _isHeader();
+};
+
+#endif
@@ -5,9 +5,9 @@
  *
  * @mc       Arduino/RBBB
  * @autor    Christian Aschoff / caschoff _AT_ mac _DOT_ com
- * @version  1.5
+ * @version  1.8
  * @created  18.1.2013
- * @updated  16.2.2015
+ * @updated  18.10.2026
  *
  * Versionshistorie:
  * V 1.0:  - Erstellt.
@@ -16,13 +16,21 @@
  * V 1.3:  - Anpassung auf Helligkeit in Prozent.
  * V 1.4:  - Getter fuer Helligkeit eingefuehrt.
  * V 1.5:  - Unterstuetzung fuer die alte Arduino-IDE (bis 1.0.6) entfernt.
+ * V 1.6:  - Der zuletzt geschriebene Bildspeicher wird gemerkt, die Treiber bekommen die
+ *           geaenderten Zeilen und Pixel (_getChangedRows(), _getChangedPixels()).
+ * V 1.7:  - Optionale Intensitaet (0-255) pro Pixel (LED_DRIVER_INTENSITY), die LED-Stripes verrechnen sie mit der Farbe.
+ * V 1.8:  - Optionale Farbpalette mit 16 Plaetzen und einem Farbplatz pro Pixel (LED_DRIVER_PALETTE).
  */
 #include "LedDriver.h"
 
 void LedDriver::setColor(byte red, byte green, byte blue) {
-    _red = red;
-    _green = green;
-    _blue = blue;
+    if ((red != _red) || (green != _green) || (blue != _blue)) {
+        _red = red;
+        _green = green;
+        _blue = blue;
+        // neue Farbe, also alle Pixel neu schreiben...
+        _invalidateLastMatrix();
+    }
 }
 
 byte LedDriver::getRed() {
@@ -44,3 +52,256 @@ void LedDriver::setPixelInScreenBuffer(byte x, byte y, word matrix[16]) {
 boolean LedDriver::getPixelFromScreenBuffer(byte x, byte y, word matrix[16]) {
     return (matrix[y] & (0b1000000000000000 >> x)) == (0b1000000000000000 >> x);
 }
+
+/**
+ * Welche Zeilen haben sich gegenueber dem zuletzt geschriebenen Bildspeicher
+ * geaendert? Ist nichts gemerkt (am Anfang, nach _invalidateLastMatrix()),
+ * gelten alle Zeilen als geaendert.
+ *
+ * @return Bitmaske, Bit y steht fuer Zeile y.
+ */
+word LedDriver::_getChangedRows(word matrix[16]) {
+    if (!_lastMatrixValid) {
+        return (1 << LED_DRIVER_ROWS) - 1;
+    }
+    word rows = 0;
+    for (byte y = 0; y < LED_DRIVER_ROWS; y++) {
+#ifdef LED_DRIVER_PIXEL_PLANES
+        if ((matrix[y] != _lastMatrix[y]) || _pixelsChanged[y]) {
+#else
+        if (matrix[y] != _lastMatrix[y]) {
+#endif
+            rows |= 1 << y;
+        }
+    }
+    return rows;
+}
+
+/**
+ * Welche Pixel der Zeile y haben sich gegenueber dem zuletzt geschriebenen
+ * Bildspeicher geaendert (XOR)? Ist nichts gemerkt, gelten alle als geaendert.
+ */
+word LedDriver::_getChangedPixels(byte y, word matrix[16]) {
+    if (!_lastMatrixValid) {
+        return 0b1111111111111111;
+    }
+#ifdef LED_DRIVER_PIXEL_PLANES
+    return (matrix[y] ^ _lastMatrix[y]) | _pixelsChanged[y];
+#else
+    return matrix[y] ^ _lastMatrix[y];
+#endif
+}
+
+/**
+ * Den geschriebenen Bildspeicher fuer den naechsten Vergleich merken.
+ */
+void LedDriver::_storeLastMatrix(word matrix[16]) {
+    for (byte y = 0; y < LED_DRIVER_ROWS; y++) {
+        _lastMatrix[y] = matrix[y];
+#ifdef LED_DRIVER_PIXEL_PLANES
+        _pixelsChanged[y] = 0;
+#endif
+    }
+    _lastMatrixValid = true;
+}
+
+/**
+ * Der Inhalt der LEDs passt nicht mehr zum gemerkten Bildspeicher
+ * (geloescht, neue Farbe, neue Helligkeit), beim naechsten Schreiben
+ * also alle Pixel neu setzen.
+ */
+void LedDriver::_invalidateLastMatrix() {
+    _lastMatrixValid = false;
+}
+
+/**
+ * Passt der gemerkte Bildspeicher noch zu den LEDs? Wenn nicht, schreibt
+ * der naechste Aufruf alle Pixel neu.
+ */
+boolean LedDriver::_isLastMatrixValid() {
+    return _lastMatrixValid;
+}
+
+#ifdef LED_DRIVER_PIXEL_PLANES
+/**
+ * Einen Pixel (Index wie bei LED_DRIVER_PIXELS) fuer das naechste Schreiben
+ * als geaendert markieren.
+ */
+void LedDriver::_markPixelChanged(byte index) {
+    if (index < LED_DRIVER_PIXEL_CORNERS) {
+        _pixelsChanged[index / 11] |= 0b1000000000000000 >> (index % 11);
+    } else if (index < LED_DRIVER_PIXEL_ALARM) {
+        // Ecke 1, 2, 3, 4 steht in Zeile 1, 0, 3, 2...
+        _pixelsChanged[(index - LED_DRIVER_PIXEL_CORNERS) ^ 1] |= 0b0000000000011111;
+    } else {
+        _pixelsChanged[4] |= 0b0000000000011111;
+    }
+}
+#endif
+
+/**
+ * Die Farbe eines Farbplatzes (ohne LED_DRIVER_PALETTE gibt es nur Platz 0,
+ * die Farbe aus setColor()).
+ */
+byte LedDriver::getPaletteRed(byte slot) {
+#ifdef LED_DRIVER_PALETTE
+    if (slot != 0) {
+        return _palette[slot - 1][0];
+    }
+#endif
+    return _red;
+}
+
+byte LedDriver::getPaletteGreen(byte slot) {
+#ifdef LED_DRIVER_PALETTE
+    if (slot != 0) {
+        return _palette[slot - 1][1];
+    }
+#endif
+    return _green;
+}
+
+byte LedDriver::getPaletteBlue(byte slot) {
+#ifdef LED_DRIVER_PALETTE
+    if (slot != 0) {
+        return _palette[slot - 1][2];
+    }
+#endif
+    return _blue;
+}
+
+#ifdef LED_DRIVER_INTENSITY
+/**
+ * Die Intensitaet (0-255) eines Buchstabens setzen. Sie gilt, solange der
+ * Pixel im Bildspeicher eingeschaltet ist, und wird von den LED-Stripes mit
+ * Farbe und Helligkeit verrechnet. Die anderen Treiber ignorieren sie.
+ */
+void LedDriver::setPixelIntensity(byte x, byte y, byte intensity) {
+    _setIntensity(y * 11 + x, intensity);
+}
+
+/**
+ * Die Intensitaet einer Eck-LED setzen (corner 0-3 fuer Ecke 1-4).
+ */
+void LedDriver::setCornerIntensity(byte corner, byte intensity) {
+    _setIntensity(LED_DRIVER_PIXEL_CORNERS + corner, intensity);
+}
+
+/**
+ * Die Intensitaet der Alarm-LED setzen.
+ */
+void LedDriver::setAlarmLedIntensity(byte intensity) {
+    _setIntensity(LED_DRIVER_PIXEL_ALARM, intensity);
+}
+
+/**
+ * Alle Intensitaeten setzen (255 = wie ohne Intensitaet).
+ */
+void LedDriver::setAllIntensities(byte intensity) {
+    for (byte i = 0; i < LED_DRIVER_PIXELS; i++) {
+        _setIntensity(i, intensity);
+    }
+}
+
+byte LedDriver::_getIntensity(byte index) {
+    return _intensity[index];
+}
+
+/**
+ * Einen (schon auf die Helligkeit skalierten) Farbanteil mit einer Intensitaet verrechnen.
+ */
+byte LedDriver::_scaleIntensity(byte colorPart, byte intensity) {
+    return ((word)colorPart * (intensity + 1)) >> 8;
+}
+
+void LedDriver::_setIntensity(byte index, byte intensity) {
+    if (_intensity[index] != intensity) {
+        _intensity[index] = intensity;
+        _markPixelChanged(index);
+    }
+}
+#endif
+
+#ifdef LED_DRIVER_PALETTE
+/**
+ * Die Farbe eines Farbplatzes setzen. Platz 0 ist die normale Farbe (setColor()).
+ * Die LED-Stripes skalieren die Palette nur, wenn sich Farben oder Helligkeit
+ * aendern, und nicht fuer jeden Pixel.
+ */
+void LedDriver::setPaletteColor(byte slot, byte red, byte green, byte blue) {
+    if (slot == 0) {
+        setColor(red, green, blue);
+    } else if (slot < LED_DRIVER_PALETTE_SIZE) {
+        byte *color = _palette[slot - 1];
+        if ((red != color[0]) || (green != color[1]) || (blue != color[2])) {
+            color[0] = red;
+            color[1] = green;
+            color[2] = blue;
+            // neue Farbe, also alle Pixel neu schreiben...
+            _invalidateLastMatrix();
+        }
+    }
+}
+
+/**
+ * Den Farbplatz eines Buchstabens setzen.
+ */
+void LedDriver::setPixelPaletteSlot(byte x, byte y, byte slot) {
+    _setPaletteSlot(y * 11 + x, slot);
+}
+
+/**
+ * Den Farbplatz einer Eck-LED setzen (corner 0-3 fuer Ecke 1-4).
+ */
+void LedDriver::setCornerPaletteSlot(byte corner, byte slot) {
+    _setPaletteSlot(LED_DRIVER_PIXEL_CORNERS + corner, slot);
+}
+
+/**
+ * Den Farbplatz der Alarm-LED setzen.
+ */
+void LedDriver::setAlarmLedPaletteSlot(byte slot) {
+    _setPaletteSlot(LED_DRIVER_PIXEL_ALARM, slot);
+}
+
+/**
+ * Allen eingeschalteten Pixeln eines Bildspeichers (z.B. den Stunden-Woertern)
+ * einen Farbplatz geben.
+ */
+void LedDriver::setPaletteSlotForScreenBuffer(word matrix[16], byte slot) {
+    for (byte y = 0; y < LED_DRIVER_ROWS; y++) {
+        word row = matrix[y];
+        for (byte x = 0; x < 11; x++) {
+            if (row & (0b1000000000000000 >> x)) {
+                _setPaletteSlot(y * 11 + x, slot);
+            }
+        }
+    }
+    for (byte i = 0; i < 4; i++) {
+        if (matrix[i ^ 1] & 0b0000000000011111) {
+            _setPaletteSlot(LED_DRIVER_PIXEL_CORNERS + i, slot);
+        }
+    }
+    if (matrix[4] & 0b0000000000011111) {
+        _setPaletteSlot(LED_DRIVER_PIXEL_ALARM, slot);
+    }
+}
+
+byte LedDriver::_getPaletteSlot(byte index) {
+    byte slots = _paletteSlots[index >> 1];
+    return (index & 1) ? (slots >> 4) : (slots & 0x0F);
+}
+
+void LedDriver::_setPaletteSlot(byte index, byte slot) {
+    slot &= 0x0F;
+    if (_getPaletteSlot(index) != slot) {
+        byte *slots = &_paletteSlots[index >> 1];
+        if (index & 1) {
+            *slots = (*slots & 0x0F) | (slot << 4);
+        } else {
+            *slots = (*slots & 0xF0) | slot;
+        }
+        _markPixelChanged(index);
+    }
+}
+#endif
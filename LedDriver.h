@@ -5,9 +5,9 @@
  *
  * @mc       Arduino/RBBB
  * @autor    Christian Aschoff / caschoff _AT_ mac _DOT_ com
- * @version  1.5
+ * @version  1.8
  * @created  18.1.2013
- * @updated  16.2.2015
+ * @updated  18.10.2026
  *
  * Versionshistorie:
  * V 1.0:  - Erstellt.
@@ -16,11 +16,40 @@
  * V 1.3:  - Anpassung auf Helligkeit in Prozent.
  * V 1.4:  - Getter fuer Helligkeit eingefuehrt.
  * V 1.5:  - Unterstuetzung fuer die alte Arduino-IDE (bis 1.0.6) entfernt.
+ * V 1.6:  - Der zuletzt geschriebene Bildspeicher wird gemerkt, die Treiber bekommen die
+ *           geaenderten Zeilen und Pixel (_getChangedRows(), _getChangedPixels()).
+ * V 1.7:  - Optionale Intensitaet (0-255) pro Pixel (LED_DRIVER_INTENSITY), die LED-Stripes verrechnen sie mit der Farbe.
+ * V 1.8:  - Optionale Farbpalette mit 16 Plaetzen und einem Farbplatz pro Pixel (LED_DRIVER_PALETTE).
  */
 #ifndef LEDDRIVER_H
 #define LEDDRIVER_H
 
 #include "Arduino.h"
+#include "Configuration.h"
+
+/**
+ * Die Anzahl der Zeilen, die fuer den Vergleich mit dem zuletzt
+ * geschriebenen Bildspeicher gemerkt werden (10 Zeilen, die Eck-LEDs
+ * und die Alarm-LED stecken in den Bits 0-4 der Zeilen 0-4).
+ */
+#define LED_DRIVER_ROWS 10
+
+/**
+ * Die Pixel fuer Intensitaet und Palette: 110 Buchstaben (Index y * 11 + x),
+ * dahinter die vier Eck-LEDs (Ecke 1-4) und die Alarm-LED.
+ */
+#define LED_DRIVER_PIXEL_CORNERS 110
+#define LED_DRIVER_PIXEL_ALARM   114
+#define LED_DRIVER_PIXELS        115
+
+/**
+ * Die Anzahl der Farbplaetze der Palette (Platz 0 ist die Farbe aus setColor()).
+ */
+#define LED_DRIVER_PALETTE_SIZE 16
+
+#if defined(LED_DRIVER_INTENSITY) || defined(LED_DRIVER_PALETTE)
+#define LED_DRIVER_PIXEL_PLANES
+#endif
 
 class LedDriver {
 public:
@@ -48,8 +77,71 @@ public:
     void setPixelInScreenBuffer(byte x, byte y, word matrix[16]);
     boolean getPixelFromScreenBuffer(byte x, byte y, word matrix[16]);
 
+#ifdef LED_DRIVER_INTENSITY
+    void setPixelIntensity(byte x, byte y, byte intensity);
+    void setCornerIntensity(byte corner, byte intensity);
+    void setAlarmLedIntensity(byte intensity);
+    void setAllIntensities(byte intensity);
+#endif
+
+    byte getPaletteRed(byte slot);
+    byte getPaletteGreen(byte slot);
+    byte getPaletteBlue(byte slot);
+
+#ifdef LED_DRIVER_PALETTE
+    void setPaletteColor(byte slot, byte red, byte green, byte blue);
+
+    void setPixelPaletteSlot(byte x, byte y, byte slot);
+    void setCornerPaletteSlot(byte corner, byte slot);
+    void setAlarmLedPaletteSlot(byte slot);
+    void setPaletteSlotForScreenBuffer(word matrix[16], byte slot);
+#endif
+
+protected:
+    word _getChangedRows(word matrix[16]);
+    word _getChangedPixels(byte y, word matrix[16]);
+    void _storeLastMatrix(word matrix[16]);
+    void _invalidateLastMatrix();
+    boolean _isLastMatrixValid();
+
+#ifdef LED_DRIVER_INTENSITY
+    byte _getIntensity(byte index);
+    byte _scaleIntensity(byte colorPart, byte intensity);
+#endif
+
+#ifdef LED_DRIVER_PALETTE
+    byte _getPaletteSlot(byte index);
+#endif
+
 private:
     byte _red, _green, _blue;
+
+    // Die LedDriver sind global angelegt, _lastMatrixValid ist also am Anfang FALSE.
+    // Zusaetzlich setzt clearData() der Treiber den Merker zurueck.
+    word _lastMatrix[LED_DRIVER_ROWS];
+    boolean _lastMatrixValid;
+
+#ifdef LED_DRIVER_PIXEL_PLANES
+    // Pixel, deren Intensitaet oder Farbplatz sich seit dem letzten Schreiben geaendert hat (wie im Bildspeicher).
+    word _pixelsChanged[LED_DRIVER_ROWS];
+
+    void _markPixelChanged(byte index);
+#endif
+
+#ifdef LED_DRIVER_INTENSITY
+    byte _intensity[LED_DRIVER_PIXELS];
+
+    void _setIntensity(byte index, byte intensity);
+#endif
+
+#ifdef LED_DRIVER_PALETTE
+    // Farbplaetze 1-15, Platz 0 ist _red, _green, _blue.
+    byte _palette[LED_DRIVER_PALETTE_SIZE - 1][3];
+    // zwei Pixel pro Byte (4 Bit pro Farbplatz), die Global-Initialisierung ergibt ueberall Platz 0.
+    byte _paletteSlots[(LED_DRIVER_PIXELS + 1) / 2];
+
+    void _setPaletteSlot(byte index, byte slot);
+#endif
 };
 
 #endif
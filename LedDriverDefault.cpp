@@ -4,9 +4,9 @@
  *
  * @mc       Arduino/RBBB
  * @autor    Christian Aschoff / caschoff _AT_ mac _DOT_ com
- * @version  1.4
+ * @version  1.6
  * @created  18.1.2013
- * @updated  18.1.2015
+ * @updated  18.10.2026
  *
  * Versionshistorie:
  * V 1.0:  - Erstellt.
@@ -15,6 +15,11 @@
  * V 1.2:  - Anpassung Helligkeit 0-100%
  * V 1.3:  - Getter fuer Helligkeit nachgezogen.
  * V 1.4:  - Unterstuetzung fuer die alte Arduino-IDE (bis 1.0.6) entfernt.
+ * V 1.5:  - Optionales Multiplexen per Timer1-Interrupt mit doppeltem Bildspeicher und
+ *           Helligkeit per Binary Code Modulation (LED_DRIVER_DEFAULT_TIMER).
+ *         - Der Interrupt schreibt vorbereitete Bytes mit shiftOutBytesFromInterrupt(), ohne Interrupts freizugeben.
+ * V 1.6:  - Spalten und Zeile mit einem shiftOut() (mit SHIFTREGISTER_SPI als 32 Bit am Stueck).
+ *         - init() startet die Shift-Register (ShiftRegister::begin()).
  */
 #include "LedDriverDefault.h"
 #include "Configuration.h"
@@ -29,6 +34,27 @@
 #define DISPLAY_SHIFT  0+
 #endif
 
+#ifdef LED_DRIVER_DEFAULT_TIMER
+#ifndef TIMSK1
+#error "LED_DRIVER_DEFAULT_TIMER braucht den Timer1 eines AVR."
+#endif
+#ifdef MYDCF77_QUIET_SUSPEND_MULTIPLEXING
+#error "MYDCF77_QUIET_SUSPEND_MULTIPLEXING geht nicht mit LED_DRIVER_DEFAULT_TIMER, der Timer1-Interrupt multiplext immer weiter."
+#endif
+
+// Timer1 laeuft mit Prescaler 8, das sind die Takte der kuerzesten Zeitscheibe...
+#define LED_DRIVER_DEFAULT_BCM_TICKS (LED_DRIVER_DEFAULT_BCM_MICROS * (F_CPU / 8000000UL))
+
+// Der Treiber, den die Interrupt-Routine bedient.
+static LedDriverDefault *timerDriver;
+
+#ifdef LED_DRIVER_DEFAULT
+ISR(TIMER1_COMPA_vect) {
+    timerDriver->nextSlice();
+}
+#endif
+#endif
+
 /**
  * Initialisierung.
  *
@@ -44,6 +70,18 @@ LedDriverDefault::LedDriverDefault(byte data, byte clock, byte latch, byte outpu
     pinMode(_outputEnablePin, OUTPUT);
     digitalWrite(_outputEnablePin, HIGH);
     _linesToWrite = linesToWrite;
+
+#ifdef LED_DRIVER_DEFAULT_TIMER
+    _outputEnableBit = digitalPinToBitMask(outputEnable);
+    _outputEnableOut = portOutputRegister(digitalPinToPort(outputEnable));
+    memset(_frames, 0, sizeof(_frames));
+    _displayFrame = 0;
+    _swapPending = false;
+    _bcmLevel = 0;
+    _bcmRow = 0;
+    _bcmBit = LED_DRIVER_DEFAULT_BCM_BITS;
+    timerDriver = this;
+#endif
 }
 
 /**
@@ -52,6 +90,7 @@ LedDriverDefault::LedDriverDefault(byte data, byte clock, byte latch, byte outpu
  * Ausgangszustand gebracht werden.
  */
 void LedDriverDefault::init() {
+    _shiftRegister->begin();
 }
 
 void LedDriverDefault::printSignature() {
@@ -65,6 +104,12 @@ void LedDriverDefault::printSignature() {
  *                  FALSE, wenn es ein Refresh-Aufruf war.
  */
 void LedDriverDefault::writeScreenBufferToMatrix(word matrix[16], boolean onChange) {
+#ifdef LED_DRIVER_DEFAULT_TIMER
+    // das Multiplexen macht der Timer-Interrupt, hier kommt nur ein neues Bild in den zweiten Puffer...
+    if (onChange) {
+        _queueFrame(matrix);
+    }
+#else
     word row = 1;
 
     // Jetzt die Daten...
@@ -76,8 +121,7 @@ void LedDriverDefault::writeScreenBufferToMatrix(word matrix[16], boolean onChan
 #endif
             // Zeile einschalten...
             _shiftRegister->prepareShiftregisterWrite();
-            _shiftRegister->shiftOut(~matrix[DISPLAY_SHIFT k]);
-            _shiftRegister->shiftOut(row);
+            _shiftRegister->shiftOut(~matrix[DISPLAY_SHIFT k], row);
             _shiftRegister->finishShiftregisterWrite();
 
             // hier kann man versuchen, das Taktverhaeltnis zu aendern (Anzeit)...
@@ -88,8 +132,7 @@ void LedDriverDefault::writeScreenBufferToMatrix(word matrix[16], boolean onChan
 
             // Zeile ausschalten (einfach ganze Matrix gegenlaeufig schalten)...
             _shiftRegister->prepareShiftregisterWrite();
-            _shiftRegister->shiftOut(65535);
-            _shiftRegister->shiftOut(0);
+            _shiftRegister->shiftOut(65535, 0);
             _shiftRegister->finishShiftregisterWrite();
 
             // hier kann man versuchen, das Taktverhaeltnis zu aendern (Auszeit)...
@@ -104,6 +147,7 @@ void LedDriverDefault::writeScreenBufferToMatrix(word matrix[16], boolean onChan
 
         row = row << 1;
     }
+#endif
 }
 
 /**
@@ -113,6 +157,10 @@ void LedDriverDefault::writeScreenBufferToMatrix(word matrix[16], boolean onChan
  */
 void LedDriverDefault::setBrightness(byte brightnessInPercent) {
     _brightnessInPercent = brightnessInPercent;
+#ifdef LED_DRIVER_DEFAULT_TIMER
+    // gerundet, damit auch 1% noch leuchtet...
+    _bcmLevel = ((word) _brightnessInPercent * ((1 << LED_DRIVER_DEFAULT_BCM_BITS) - 1) + 50) / 100;
+#endif
 }
 
 /**
@@ -136,6 +184,10 @@ void LedDriverDefault::setLinesToWrite(byte linesToWrite) {
  * Das Display ausschalten.
  */
 void LedDriverDefault::shutDown() {
+#ifdef LED_DRIVER_DEFAULT_TIMER
+    // keine Interrupts mehr, die OutputEnable wieder einschalten koennten...
+    TIMSK1 &= ~_BV(OCIE1A);
+#endif
     digitalWrite(_outputEnablePin, HIGH);
 }
 
@@ -143,15 +195,94 @@ void LedDriverDefault::shutDown() {
  * Das Display einschalten.
  */
 void LedDriverDefault::wakeUp() {
+#ifdef LED_DRIVER_DEFAULT_TIMER
+    // Timer1 im CTC-Modus mit Prescaler 8, OutputEnable schaltet ab jetzt der Interrupt...
+    noInterrupts();
+    TCCR1A = 0;
+    TCCR1B = _BV(WGM12) | _BV(CS11);
+    OCR1A = LED_DRIVER_DEFAULT_BCM_TICKS - 1;
+    TCNT1 = 0;
+    TIFR1 = _BV(OCF1A);
+    TIMSK1 |= _BV(OCIE1A);
+    interrupts();
+#else
     digitalWrite(_outputEnablePin, LOW);
+#endif
 }
 
 /**
  * Den Dateninhalt des LED-Treibers loeschen.
  */
 void LedDriverDefault::clearData() {
+#ifdef LED_DRIVER_DEFAULT_TIMER
+    word empty[16] = {0};
+    _queueFrame(empty);
+#else
     _shiftRegister->prepareShiftregisterWrite();
-    _shiftRegister->shiftOut(65535);
-    _shiftRegister->shiftOut(0);
+    _shiftRegister->shiftOut(65535, 0);
     _shiftRegister->finishShiftregisterWrite();
+#endif
+}
+
+#ifdef LED_DRIVER_DEFAULT_TIMER
+/**
+ * Ein Bild in den Puffer legen, den der Interrupt gerade nicht zeigt. Der
+ * Interrupt wechselt erst am Anfang des naechsten Durchlaufs (Zeile 0) auf
+ * das neue Bild, es gibt also keine halben Bilder.
+ * Jede Zeile steht schon so im Puffer, wie sie in die Shift-Register geht
+ * (Spalten invertiert, dann die Zeile, jeweils Low-Byte zuerst), der
+ * Interrupt muss nichts mehr rechnen.
+ */
+void LedDriverDefault::_queueFrame(word matrix[16]) {
+    // erst den Wechsel verbieten, dann ist _displayFrame fest...
+    _swapPending = false;
+    byte (*frame)[4] = _frames[_displayFrame ^ 1];
+    for (byte k = 0; k < _linesToWrite; k++) {
+        word columns = ~matrix[DISPLAY_SHIFT k];
+        word row = 1 << k;
+        frame[k][0] = lowByte(columns);
+        frame[k][1] = highByte(columns);
+        frame[k][2] = lowByte(row);
+        frame[k][3] = highByte(row);
+    }
+    _swapPending = true;
 }
+
+/**
+ * Die naechste Zeitscheibe (aus der Interrupt-Routine von Timer1).
+ * Am Anfang einer Zeile werden die vorbereiteten Bytes der Zeile bei
+ * ausgeschaltetem OutputEnable in die Shift-Register geschrieben, dann folgen die Zeitscheiben 1, 2, 4... mal
+ * LED_DRIVER_DEFAULT_BCM_TICKS lang, OutputEnable ist an, wenn das
+ * entsprechende Bit der Helligkeit gesetzt ist.
+ */
+void LedDriverDefault::nextSlice() {
+    if (_bcmBit == LED_DRIVER_DEFAULT_BCM_BITS) {
+        // Zeile fertig, dunkel schalten und die naechste schreiben...
+        *_outputEnableOut |= _outputEnableBit;
+
+        _bcmRow++;
+        if (_bcmRow >= _linesToWrite) {
+            _bcmRow = 0;
+        }
+        if ((_bcmRow == 0) && _swapPending) {
+            _displayFrame ^= 1;
+            _swapPending = false;
+        }
+        // ...ohne cli()/sei(), die Interrupts bleiben bis zum Ende gesperrt...
+        _shiftRegister->shiftOutBytesFromInterrupt(_frames[_displayFrame][_bcmRow], 4);
+
+        // die erste Zeitscheibe beginnt jetzt...
+        _bcmBit = 0;
+        TCNT1 = 0;
+        TIFR1 = _BV(OCF1A);
+    }
+
+    if (_bcmLevel & (1 << _bcmBit)) {
+        *_outputEnableOut &= ~_outputEnableBit;
+    } else {
+        *_outputEnableOut |= _outputEnableBit;
+    }
+    OCR1A = (LED_DRIVER_DEFAULT_BCM_TICKS << _bcmBit) - 1;
+    _bcmBit++;
+}
+#endif
@@ -4,9 +4,9 @@
  *
  * @mc       Arduino/RBBB
  * @autor    Christian Aschoff / caschoff _AT_ mac _DOT_ com
- * @version  1.4
+ * @version  1.6
  * @created  18.1.2013
- * @updated  18.1.2015
+ * @updated  18.10.2026
  *
  * Versionshistorie:
  * V 1.0:  - Erstellt.
@@ -15,6 +15,10 @@
  * V 1.2:  - Anpassung Helligkeit 0-100%
  * V 1.3:  - Getter fuer Helligkeit nachgezogen.
  * V 1.4:  - Unterstuetzung fuer die alte Arduino-IDE (bis 1.0.6) entfernt.
+ * V 1.5:  - Optionales Multiplexen per Timer1-Interrupt mit doppeltem Bildspeicher und
+ *           Helligkeit per Binary Code Modulation (LED_DRIVER_DEFAULT_TIMER).
+ *         - Der Interrupt schreibt vorbereitete Bytes mit shiftOutBytesFromInterrupt(), ohne Interrupts freizugeben.
+ * V 1.6:  - Spalten und Zeile mit einem shiftOut() (mit SHIFTREGISTER_SPI als 32 Bit am Stueck).
  */
 #ifndef LED_DRIVER_DEFAULT_H
 #define LED_DRIVER_DEFAULT_H
@@ -23,6 +27,11 @@
 #include "ShiftRegister.h"
 #include "LedDriver.h"
 
+#ifdef LED_DRIVER_DEFAULT_TIMER
+// Die Zeilen, die der Treiber maximal multiplext.
+#define LED_DRIVER_DEFAULT_MAX_LINES 16
+#endif
+
 class LedDriverDefault : public LedDriver {
 public:
     LedDriverDefault(byte data, byte clock, byte latch, byte outputEnable, byte linesToWrite);
@@ -43,14 +52,37 @@ public:
 
     void clearData();
 
+#ifdef LED_DRIVER_DEFAULT_TIMER
+    // Nur fuer die Interrupt-Routine von Timer1.
+    void nextSlice();
+#endif
+
 private:
     byte _brightnessInPercent;
 
-    byte _linesToWrite;
+    volatile byte _linesToWrite;
 
     byte _outputEnablePin;
 
     ShiftRegister *_shiftRegister;
+
+#ifdef LED_DRIVER_DEFAULT_TIMER
+    // Doppelter Bildspeicher: einen zeigt der Interrupt, in den anderen kommt das naechste Bild.
+    // Pro Zeile die vier Bytes fuer die Shift-Register (siehe _queueFrame()).
+    byte _frames[2][LED_DRIVER_DEFAULT_MAX_LINES][4];
+    volatile byte _displayFrame;
+    volatile boolean _swapPending;
+
+    // Die Helligkeit als BCM-Wert (ein Bit pro Zeitscheibe).
+    volatile byte _bcmLevel;
+    byte _bcmRow;
+    byte _bcmBit;
+
+    uint8_t _outputEnableBit;
+    volatile uint8_t *_outputEnableOut;
+
+    void _queueFrame(word matrix[16]);
+#endif
 };
 
 #endif
@@ -4,26 +4,48 @@
  *
  * @mc       Arduino/RBBB
  * @autor    Christian Aschoff / caschoff _AT_ mac _DOT_ com
- * @version  1.1
+ * @version  1.8
  * @created  9.2.2015
- * @updated  16.2.2015
+ * @updated  18.10.2026
  *
  * Versionshistorie:
  * V 1.0:  - Erstellt.
  * V 1.1:  - Unterstuetzung fuer die alte Arduino-IDE (bis 1.0.6) entfernt.
+ * V 1.2:  - Nur noch die geaenderten Pixel schreiben (siehe LedDriver::_getChangedRows()).
+ * V 1.3:  - Optionale Intensitaet pro Pixel (LED_DRIVER_INTENSITY).
+ * V 1.4:  - Optionale Farbpalette (LED_DRIVER_PALETTE), vorskaliert bei neuer Farbe oder Helligkeit.
+ * V 1.5:  - Verkabelung als Tabelle im PROGMEM (LedDriverLayouts.h) statt _setPixel().
+ * V 1.6:  - Zeichnen, Helligkeit und Farben aus dem gemeinsamen StripLedDriver-Template.
+ * V 1.7:  - Optionale Helligkeit ueber das 5-Bit-Helligkeitsfeld der APA102 (LED_DRIVER_DOTSTAR_GLOBAL_BRIGHTNESS).
+ *         - DotStarStrip: Ausgabe mit gesperrten Interrupts pro Byte (ATOMIC_BLOCK), getGlobalBrightness().
+ *         - DotStarStrip erbt protected von Adafruit_DotStar, show() ist nicht ueber einen Adafruit_DotStar* erreichbar.
+ * V 1.8:  - Das Helligkeitsfeld geht in die Strom-Begrenzung ein.
  *
  * Verkabelung: Einspeisung oben links, dann schlangenfoermig runter,
  * dann Ecke unten links, oben links, oben rechts, unten rechts.
- *
  */
 #include "LedDriverDotStar.h"
 #include "Configuration.h"
+#include "LedDriverLayouts.h"
+#ifdef LED_DRIVER_DOTSTAR_GLOBAL_BRIGHTNESS
+#include <util/atomic.h>
+#endif
 
 // #define DEBUG
 #include "Debug.h"
 
 #define NUM_PIXEL 114
 
+// Ab dieser Helligkeit (in Prozent) aendert sich nur noch das Helligkeitsfeld, die Farben bleiben voll.
+#define DOTSTAR_FIELD_ONLY_FROM 25
+
+/**
+ * Die Verkabelung: Pixel-Index -> Position im Streifen (siehe LedDriverLayouts.h).
+ */
+const byte layoutDotStar[] = {
+    LED_DRIVER_LAYOUT(layoutSerpentine)
+};
+
 /**
  * Initialisierung.
  *
@@ -32,179 +54,144 @@
 LedDriverDotStar::LedDriverDotStar(byte dataPin, byte clockPin) {
     _dataPin = dataPin;
     _clockPin = clockPin;
-    _strip = new Adafruit_DotStar(NUM_PIXEL, _dataPin, _clockPin, DOTSTAR_BGR);
+    _strip = new LedDriverDotStarStrip(NUM_PIXEL, _dataPin, _clockPin, DOTSTAR_BGR);
     _strip->begin();
     setColor(250, 255, 200);
 }
 
-/**
- * init() wird im Hauptprogramm in init() aufgerufen.
- * Hier sollten die LED-Treiber in eine definierten
- * Ausgangszustand gebracht werden.
- */
-void LedDriverDotStar::init() {
-    setBrightness(50);
-    clearData();
-    wakeUp();
-}
-
 void LedDriverDotStar::printSignature() {
     Serial.println(F("DotStar - APA102"));
 }
 
+#ifdef LED_DRIVER_DOTSTAR_GLOBAL_BRIGHTNESS
 /**
- * Den Bildschirm-Puffer auf die LED-Matrix schreiben.
- *
- * @param onChange: TRUE, wenn es Aenderungen in dem Bildschirm-Puffer gab,
- *                  FALSE, wenn es ein Refresh-Aufruf war.
+ * Den Bildschirm-Puffer auf die LED-Matrix schreiben. Hat sich nur das
+ * Helligkeitsfeld geaendert, wird der Streifen ohne neue Farben ausgegeben.
  */
 void LedDriverDotStar::writeScreenBufferToMatrix(word matrix[16], boolean onChange) {
-    if (onChange || _dirty) {
-        _dirty = false;
-        _clear();
-
-        uint32_t color = _strip->Color(_brightnessScaleColor(getRed()), _brightnessScaleColor(getGreen()), _brightnessScaleColor(getBlue()));
-
-        for (byte y = 0; y < 10; y++) {
-            for (byte x = 5; x < 16; x++) {
-                word t = 1 << x;
-                if ((matrix[y] & t) == t) {
-                    _setPixel(15 - x, y, color);
-                }
-            }
-        }
-
-        // wir muessen die Eck-LEDs umsetzten...
-        if ((matrix[1] & 0b0000000000011111) == 0b0000000000011111) {
-            _setPixel(110, color); // 1
-        }
-        if ((matrix[0] & 0b0000000000011111) == 0b0000000000011111) {
-            _setPixel(111, color); // 2
-        }
-        if ((matrix[3] & 0b0000000000011111) == 0b0000000000011111) {
-            _setPixel(112, color); // 3
-        }
-        if ((matrix[2] & 0b0000000000011111) == 0b0000000000011111) {
-            _setPixel(113, color); // 4
-        }
-
+    StripLedDriver::writeScreenBufferToMatrix(matrix, onChange);
+    if (_strip->isGlobalBrightnessChanged()) {
         _strip->show();
     }
 }
 
 /**
- * Die Helligkeit des Displays anpassen.
+ * Die Helligkeit des Displays anpassen. Der grobe Teil geht in das
+ * Helligkeitsfeld (0-31), der feine Teil in die Farben. Ab DOTSTAR_FIELD_ONLY_FROM
+ * bleiben die Farben voll, ein neuer Wert ist dann nur ein neues Helligkeitsfeld.
+ * Darunter ist das Feld so klein wie moeglich und die Farben behalten
+ * trotzdem genug Stufen (bei 1%: Feld 1, Farben 31%).
  *
  * @param brightnessInPercent Die Helligkeit.
  */
 void LedDriverDotStar::setBrightness(byte brightnessInPercent) {
-    if (brightnessInPercent != _brightnessInPercent) {
-        _brightnessInPercent = brightnessInPercent;
-        _dirty = true;
+    _requestedBrightness = brightnessInPercent;
+
+    byte field;
+    byte colorInPercent;
+    if (brightnessInPercent >= DOTSTAR_FIELD_ONLY_FROM) {
+        field = (brightnessInPercent * 31 + 50) / 100;
+        colorInPercent = 100;
+    } else {
+        field = (brightnessInPercent * 31 + 99) / 100;
+        colorInPercent = (field == 0) ? 0 : (brightnessInPercent * 31 + field / 2) / field;
     }
+    _strip->setGlobalBrightness(field);
+#ifdef LED_DRIVER_CURRENT_LIMIT
+    // das Feld begrenzt den Strom schon, die Farben duerfen entsprechend heller sein...
+    _setCurrentScale(field);
+#endif
+    // setzt nur dann alle Pixel neu, wenn sich der Anteil der Farben aendert...
+    StripLedDriver::setBrightness(colorInPercent);
 }
 
 /**
  * Die aktuelle Helligkeit bekommen.
  */
 byte LedDriverDotStar::getBrightness() {
-    return _brightnessInPercent;
+    return _requestedBrightness;
 }
 
 /**
- * Anpassung der Groesse des Bildspeichers.
- *
- * @param linesToWrite Wieviel Zeilen aus dem Bildspeicher sollen
- *                     geschrieben werden?
+ * Initialisierung des Streifens mit eigener Ausgabe (Bit-Banging auf Data und Clock).
  */
-void LedDriverDotStar::setLinesToWrite(byte linesToWrite) {
+DotStarStrip::DotStarStrip(uint16_t numPixels, uint8_t dataPin, uint8_t clockPin, uint8_t order) : Adafruit_DotStar(numPixels, dataPin, clockPin, order) {
+    _globalBrightness = 31;
+    _globalBrightnessChanged = false;
+
+    _dataBit = digitalPinToBitMask(dataPin);
+    _dataOut = portOutputRegister(digitalPinToPort(dataPin));
+    _clockBit = digitalPinToBitMask(clockPin);
+    _clockOut = portOutputRegister(digitalPinToPort(clockPin));
 }
 
 /**
- * Das Display ausschalten.
+ * Das Helligkeitsfeld fuer alle LEDs setzen (0-31).
  */
-void LedDriverDotStar::shutDown() {
-    _clear();
-    _strip->show();
+void DotStarStrip::setGlobalBrightness(byte globalBrightness) {
+    if (globalBrightness != _globalBrightness) {
+        _globalBrightness = globalBrightness;
+        _globalBrightnessChanged = true;
+    }
 }
 
 /**
- * Das Display einschalten.
+ * Das Helligkeitsfeld fuer alle LEDs (0-31).
  */
-void LedDriverDotStar::wakeUp() {
+byte DotStarStrip::getGlobalBrightness() {
+    return _globalBrightness;
 }
 
 /**
- * Den Dateninhalt des LED-Treibers loeschen.
+ * TRUE, wenn das Helligkeitsfeld seit dem letzten show() geaendert wurde.
  */
-void LedDriverDotStar::clearData() {
-    _clear();
-    _strip->show();
+boolean DotStarStrip::isGlobalBrightnessChanged() {
+    return _globalBrightnessChanged;
 }
 
 /**
- * Einen X/Y-koordinierten Pixel in der Matrix setzen.
+ * Den Streifen ausgeben: Start-Frame (32 Bit 0), pro LED das Helligkeitsfeld
+ * (0b111 + 5 Bit) und die drei Farben aus dem Puffer der Bibliothek (schon in
+ * der Reihenfolge des Streifens), dann das End-Frame wie bei Adafruit_DotStar.
  */
-void LedDriverDotStar::_setPixel(byte x, byte y, uint32_t c) {
-    _setPixel(x + (y * 11), c);
-}
+void DotStarStrip::show() {
+    const uint8_t *pixels = getPixels();
+    uint16_t n = numPixels();
+    byte header = 0b11100000 | _globalBrightness;
 
-/**
- * Einen Pixel im Streifen setzten (die Eck-LEDs sind am Ende).
- */
-void LedDriverDotStar::_setPixel(byte num, uint32_t c) {
-    if (num < 110) {
-        if ((num / 11) % 2 == 0) {
-            _strip->setPixelColor(num, c);
-        } else {
-            _strip->setPixelColor(((num / 11) * 11) + 10 - (num % 11), c);
-        }
-    } else {
-        switch (num) {
-            case 110:
-                _strip->setPixelColor(111, c);
-                break;
-            case 111:
-                _strip->setPixelColor(112, c);
-                break;
-            case 112:
-                _strip->setPixelColor(113, c);
-                break;
-            case 113:
-                _strip->setPixelColor(110, c);
-                break;
-        }
+    for (byte i = 0; i < 4; i++) {
+        _out(0);
     }
-}
-
-/**
- * Funktion fuer saubere 'Regenbogen'-Farben.
- * Kopiert aus den Adafruit-Beispielen (strand).
- */
-uint32_t LedDriverDotStar::_wheel(byte wheelPos) {
-    if (wheelPos < 85) {
-        return _strip->Color(wheelPos * 3, 255 - wheelPos * 3, 0);
-    } else if (wheelPos < 170) {
-        wheelPos -= 85;
-        return _strip->Color(255 - wheelPos * 3, 0, wheelPos * 3);
-    } else {
-        wheelPos -= 170;
-        return _strip->Color(0, wheelPos * 3, 255 - wheelPos * 3);
+    for (uint16_t i = 0; i < n; i++) {
+        _out(header);
+        _out(*pixels++);
+        _out(*pixels++);
+        _out(*pixels++);
     }
+    for (uint16_t i = 0; i < (n + 15) / 16; i++) {
+        _out(0xFF);
+    }
+    _globalBrightnessChanged = false;
 }
 
 /**
- * Hilfsfunktion fuer das Skalieren der Farben.
- */
-byte LedDriverDotStar::_brightnessScaleColor(byte colorPart) {
-    return map(_brightnessInPercent, 0, 100, 0, colorPart);
-}
-
-/**
- * Streifen loeschen.
+ * Ein Byte ausgeben, hoechstes Bit zuerst, Daten werden mit der steigenden Flanke uebernommen.
+ * Die Zugriffe auf die Ports sind Lesen-Aendern-Schreiben: ein Interrupt, der
+ * dazwischen einen anderen Pin desselben Ports schaltet, wuerde ueberschrieben.
+ * Deshalb sind die Interrupts fuer ein Byte gesperrt (ca. 3us bei 16 MHz),
+ * nicht fuer den ganzen Streifen.
  */
-void LedDriverDotStar::_clear() {
-    for (byte i = 0; i < NUM_PIXEL; i++) {
-        _strip->setPixelColor(i, 0);
+void DotStarStrip::_out(byte data) {
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+        for (byte bit = 0b10000000; bit != 0; bit >>= 1) {
+            if (data & bit) {
+                *_dataOut |= _dataBit;
+            } else {
+                *_dataOut &= ~_dataBit;
+            }
+            *_clockOut |= _clockBit;
+            *_clockOut &= ~_clockBit;
+        }
     }
 }
+#endif
@@ -4,61 +4,98 @@
  *
  * @mc       Arduino/RBBB
  * @autor    Christian Aschoff / caschoff _AT_ mac _DOT_ com
- * @version  1.1
+ * @version  1.7
  * @created  9.2.2015
- * @updated  16.2.2015
+ * @updated  18.10.2026
  *
  * Versionshistorie:
  * V 1.0:  - Erstellt.
  * V 1.1:  - Unterstuetzung fuer die alte Arduino-IDE (bis 1.0.6) entfernt.
+ * V 1.2:  - Nur noch die geaenderten Pixel schreiben (siehe LedDriver::_getChangedRows()).
+ * V 1.3:  - Optionale Intensitaet pro Pixel (LED_DRIVER_INTENSITY).
+ * V 1.4:  - Optionale Farbpalette (LED_DRIVER_PALETTE), vorskaliert bei neuer Farbe oder Helligkeit.
+ * V 1.5:  - Verkabelung als Tabelle im PROGMEM (LedDriverLayouts.h) statt _setPixel().
+ * V 1.6:  - Zeichnen, Helligkeit und Farben aus dem gemeinsamen StripLedDriver-Template.
+ * V 1.7:  - Optionale Helligkeit ueber das 5-Bit-Helligkeitsfeld der APA102 (LED_DRIVER_DOTSTAR_GLOBAL_BRIGHTNESS).
+ *         - DotStarStrip: Ausgabe mit gesperrten Interrupts pro Byte (ATOMIC_BLOCK), getGlobalBrightness().
+ *         - DotStarStrip erbt protected von Adafruit_DotStar, show() ist nicht ueber einen Adafruit_DotStar* erreichbar.
  *
  * Verkabelung: Einspeisung oben links, dann schlangenfoermig runter,
  * dann Ecke unten links, oben links, oben rechts, unten rechts.
- *
  */
 #ifndef LED_DRIVER_DOTSTAR_H
 #define LED_DRIVER_DOTSTAR_H
 
 #include "Arduino.h"
-#include "LedDriver.h"
+#include "StripLedDriver.h"
 #include <Adafruit_DotStar.h>
 
-class LedDriverDotStar : public LedDriver {
-public:
-    LedDriverDotStar(byte dataPin, byte clockPin);
-
-    void init();
+extern const byte layoutDotStar[] PROGMEM;
 
-    void printSignature();
+#ifdef LED_DRIVER_DOTSTAR_GLOBAL_BRIGHTNESS
+/**
+ * Adafruit_DotStar schreibt in das Helligkeitsfeld vor jeder LED immer 31 (0xFF).
+ * DotStarStrip benutzt den Pixel-Puffer der Bibliothek, gibt den Streifen aber
+ * selbst aus, mit dem Wert aus setGlobalBrightness() im Helligkeitsfeld.
+ *
+ * Adafruit_DotStar::show() ist nicht virtuell, ueber einen Adafruit_DotStar*
+ * kaeme der Streifen wieder mit 31 raus. Deshalb wird protected geerbt: ein
+ * DotStarStrip laesst sich nicht in einen Adafruit_DotStar* umwandeln, nach
+ * aussen gibt es nur die Methoden unten (StripLedDriver benutzt den Streifen
+ * nur ueber seinen Typ-Parameter Strip).
+ */
+class DotStarStrip : protected Adafruit_DotStar {
+public:
+    DotStarStrip(uint16_t numPixels, uint8_t dataPin, uint8_t clockPin, uint8_t order);
 
-    void writeScreenBufferToMatrix(word matrix[16], boolean onChange);
+    using Adafruit_DotStar::begin;
+    using Adafruit_DotStar::setPixelColor;
+    using Adafruit_DotStar::getPixelColor;
+    using Adafruit_DotStar::numPixels;
+    using Adafruit_DotStar::Color;
 
-    void setBrightness(byte brightnessInPercent);
-    byte getBrightness();
+    void setGlobalBrightness(byte globalBrightness);
+    byte getGlobalBrightness();
+    boolean isGlobalBrightnessChanged();
 
-    void setLinesToWrite(byte linesToWrite);
+    void show();
 
-    void shutDown();
-    void wakeUp();
+private:
+    byte _globalBrightness;
+    boolean _globalBrightnessChanged;
 
-    void clearData();
+    uint8_t _dataBit;
+    volatile uint8_t *_dataOut;
+    uint8_t _clockBit;
+    volatile uint8_t *_clockOut;
 
-private:
-    byte _brightnessInPercent;
+    void _out(byte data);
+};
 
-    boolean _dirty;
+typedef DotStarStrip LedDriverDotStarStrip;
+#else
+typedef Adafruit_DotStar LedDriverDotStarStrip;
+#endif
 
-    void _setPixel(byte x, byte y, uint32_t c);
-    void _setPixel(byte num, uint32_t c);
+class LedDriverDotStar : public StripLedDriver<LedDriverDotStarStrip, layoutDotStar, STRIP_COLOR_RGB, 8> {
+public:
+    LedDriverDotStar(byte dataPin, byte clockPin);
 
-    uint32_t _wheel(byte wheelPos);
+    void printSignature();
 
-    void _clear();
+#ifdef LED_DRIVER_DOTSTAR_GLOBAL_BRIGHTNESS
+    void writeScreenBufferToMatrix(word matrix[16], boolean onChange);
 
-    byte _brightnessScaleColor(byte colorPart);
+    void setBrightness(byte brightnessInPercent);
+    byte getBrightness();
+#endif
 
+private:
     byte _dataPin, _clockPin;
-    Adafruit_DotStar *_strip;
+
+#ifdef LED_DRIVER_DOTSTAR_GLOBAL_BRIGHTNESS
+    byte _requestedBrightness;
+#endif
 };
 
 #endif
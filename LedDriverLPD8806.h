@@ -4,13 +4,19 @@
  *
  * @mc       Arduino/RBBB
  * @autor    Christian Aschoff / caschoff _AT_ mac _DOT_ com
- * @version  1.1
+ * @version  1.7
  * @created  9.2.2015
- * @updated  16.2.2015
+ * @updated  18.10.2026
  *
  * Versionshistorie:
  * V 1.0:  - Erstellt.
  * V 1.1:  - Unterstuetzung fuer die alte Arduino-IDE (bis 1.0.6) entfernt.
+ * V 1.2:  - _setPixel(num) auch mit LPD_ALT_LAYOUT deklariert (wird dort definiert).
+ * V 1.3:  - Nur noch die geaenderten Pixel schreiben (siehe LedDriver::_getChangedRows()).
+ * V 1.4:  - Optionale Intensitaet pro Pixel (LED_DRIVER_INTENSITY).
+ * V 1.5:  - Optionale Farbpalette (LED_DRIVER_PALETTE), vorskaliert bei neuer Farbe oder Helligkeit.
+ * V 1.6:  - Verkabelung (beide Layouts) als Tabelle im PROGMEM (LedDriverLayouts.h) statt _setPixel() und _setEcke().
+ * V 1.7:  - Zeichnen, Helligkeit und Farben aus dem gemeinsamen StripLedDriver-Template.
  *
  * Verkabelung: Einspeisung oben links, dann schlangenfoermig runter,
  * dann Ecke unten links, oben links, oben rechts, unten rechts.
@@ -22,50 +28,18 @@
 #define LED_DRIVER_LPD8806_H
 
 #include "Arduino.h"
-#include "LedDriver.h"
+#include "StripLedDriver.h"
 #include <LPD8806.h>
 
-class LedDriverLPD8806 : public LedDriver {
+extern const byte layoutLPD8806[] PROGMEM;
+
+class LedDriverLPD8806 : public StripLedDriver<LPD8806, layoutLPD8806, STRIP_COLOR_RBG, 7> {
 public:
     LedDriverLPD8806(byte dataPin, byte clockPin);
 
-    void init();
-
-    void printSignature();
-
-    void writeScreenBufferToMatrix(word matrix[16], boolean onChange);
-
-    void setBrightness(byte brightnessInPercent);
-    byte getBrightness();
-
-    void setLinesToWrite(byte linesToWrite);
-
-    void shutDown();
-    void wakeUp();
     void test();
 
-    void clearData();
-
-private:
-    byte _brightnessInPercent;
-
-    boolean _dirty;
-
-    void _setPixel(byte x, byte y, uint32_t c);
-
-    void _setEcke(uint8_t ecke, uint32_t c);
-
-#ifndef LPD_ALT_LAYOUT
-    void _setPixel(byte num, uint32_t c);
-#endif
-
-    uint32_t _wheel(byte wheelPos);
-
-    void _clear();
-
-    byte _brightnessScaleColor(byte colorPart);
-
-    LPD8806 *_strip;
+    void printSignature();
 };
 
 #endif
@@ -0,0 +1,76 @@
+/**
+ * LedDriverLayouts
+ * Die Verkabelung der LED-Stripes als Tabellen im PROGMEM: Pixel-Index
+ * (y * 11 + x fuer die Buchstaben, 110-113 fuer Ecke 1-4, wie bei
+ * LED_DRIVER_PIXEL_CORNERS) -> Position im Streifen.
+ * Die Tabellen werden beim Kompilieren aus den constexpr-Funktionen unten
+ * erzeugt, die Treiber muessen also zur Laufzeit nicht mehr rechnen
+ * (keine Divisionen, kein Modulo, keine Fallunterscheidungen pro Pixel).
+ *
+ * Die Tabellen selbst legen die Treiber mit LED_DRIVER_LAYOUT(funktion) an.
+ *
+ * @mc       Arduino/RBBB
+ * @autor    agent / agent _AT_ local
+ *           Vorlage von: Christian Aschoff / caschoff _AT_ mac _DOT_ com
+ * @version  1.0
+ * @created  18.10.2026
+ *
+ * Versionshistorie:
+ * V 1.0:  - Erstellt aus den _setPixel()-Funktionen von LedDriverNeoPixel, LedDriverDotStar und LedDriverLPD8806.
+ */
+#ifndef LED_DRIVER_LAYOUTS_H
+#define LED_DRIVER_LAYOUTS_H
+
+#include "Arduino.h"
+
+/**
+ * NeoPixel und DotStar: Einspeisung oben links, dann schlangenfoermig runter,
+ * dann Ecke unten links, oben links, oben rechts, unten rechts.
+ */
+constexpr byte layoutSerpentine(byte num) {
+    return (num < 110) ? ((((num / 11) % 2) == 0) ? num : ((num / 11) * 11 + 10 - (num % 11)))
+                       : ((num == 113) ? 110 : num + 1);
+}
+
+/**
+ * LPD8806: wie layoutSerpentine, aber mit 12 LEDs pro Zeile
+ * (LPD8806-Streifen kann man nur in Vielfachen von 2 trennen).
+ */
+constexpr byte layoutLpd8806(byte num) {
+    return (num < 110) ? ((((num / 11) % 2) == 0) ? (num + num / 11) : ((num / 11) * 12 + 11 - (num % 11)))
+                       : ((num == 113) ? 120 : 122 + (num - 110) * 2);
+}
+
+/**
+ * LPD8806 mit LPD_ALT_LAYOUT: Einspeisung unten, die unterste Zeile beginnt
+ * bei LED 2, die Zeilen 1-8 bei y * 12 + 4, die oberste bei y * 12 + 6
+ * (jeweils von unten gezaehlt), ungerade Zeilen laufen rueckwaerts (x = 11 - x).
+ * Die Ecken haengen zwischen den Zeilen.
+ */
+constexpr byte layoutLpd8806AltRow(byte x, byte y) {
+    return (y == 0) ? (2 + x) : ((y <= 8) ? (y * 12 + 4 + x) : (y * 12 + 6 + x));
+}
+
+constexpr byte layoutLpd8806AltCorner(byte corner) {
+    return (corner == 0) ? 1 : ((corner == 1) ? (2 + 12 + 1) : ((corner == 2) ? (2 * 2 + 9 * 12 + 1) : (10 * 12 + 3 * 2 + 1)));
+}
+
+constexpr byte layoutLpd8806Alt(byte num) {
+    return (num < 110) ? layoutLpd8806AltRow((((9 - num / 11) % 2) == 1) ? (11 - num % 11) : (num % 11), 9 - num / 11)
+                       : layoutLpd8806AltCorner(num - 110);
+}
+
+#define LED_DRIVER_LAYOUT_ROW(f, y) \
+    f((y) * 11 + 0), f((y) * 11 + 1), f((y) * 11 + 2), f((y) * 11 + 3), f((y) * 11 + 4), f((y) * 11 + 5), \
+    f((y) * 11 + 6), f((y) * 11 + 7), f((y) * 11 + 8), f((y) * 11 + 9), f((y) * 11 + 10)
+
+/**
+ * Die Initialisierung einer Tabelle mit 114 Eintraegen (110 Buchstaben, 4 Ecken).
+ */
+#define LED_DRIVER_LAYOUT(f) \
+    LED_DRIVER_LAYOUT_ROW(f, 0), LED_DRIVER_LAYOUT_ROW(f, 1), LED_DRIVER_LAYOUT_ROW(f, 2), \
+    LED_DRIVER_LAYOUT_ROW(f, 3), LED_DRIVER_LAYOUT_ROW(f, 4), LED_DRIVER_LAYOUT_ROW(f, 5), \
+    LED_DRIVER_LAYOUT_ROW(f, 6), LED_DRIVER_LAYOUT_ROW(f, 7), LED_DRIVER_LAYOUT_ROW(f, 8), \
+    LED_DRIVER_LAYOUT_ROW(f, 9), f(110), f(111), f(112), f(113)
+
+#endif
@@ -7,14 +7,19 @@
  *
  * @mc       Arduino/RBBB
  * @autor    Christian Aschoff / caschoff _AT_ mac _DOT_ com
- * @version  1.2
+ * @version  1.7
  * @created  5.1.2015
- * @updated  16.2.2015
+ * @updated  18.10.2026
  *
  * Versionshistorie:
  * V 1.0:  - Erstellt.
  * V 1.1:  - Getter fuer Helligkeit nachgezogen.
  * V 1.2:  - Unterstuetzung fuer die alte Arduino-IDE (bis 1.0.6) entfernt.
+ * V 1.3:  - Nur noch die geaenderten Pixel schreiben (siehe LedDriver::_getChangedRows()).
+ * V 1.4:  - Optionale Intensitaet pro Pixel (LED_DRIVER_INTENSITY).
+ * V 1.5:  - Optionale Farbpalette (LED_DRIVER_PALETTE), vorskaliert bei neuer Farbe oder Helligkeit.
+ * V 1.6:  - Verkabelung als Tabelle im PROGMEM (LedDriverLayouts.h) statt _setPixel().
+ * V 1.7:  - Zeichnen, Helligkeit und Farben aus dem gemeinsamen StripLedDriver-Template.
  *
  * Verkabelung: Einspeisung oben links, dann schlangenfoermig runter,
  * dann Ecke unten links, oben links, oben rechts, unten rechts.
@@ -22,12 +27,20 @@
  */
 #include "LedDriverNeoPixel.h"
 #include "Configuration.h"
+#include "LedDriverLayouts.h"
 
 // #define DEBUG
 #include "Debug.h"
 
 #define NUM_PIXEL 114
 
+/**
+ * Die Verkabelung: Pixel-Index -> Position im Streifen (siehe LedDriverLayouts.h).
+ */
+const byte layoutNeoPixel[] = {
+    LED_DRIVER_LAYOUT(layoutSerpentine)
+};
+
 /**
  * Initialisierung.
  *
@@ -40,165 +53,6 @@ LedDriverNeoPixel::LedDriverNeoPixel(byte dataPin) {
     setColor(250, 255, 200);
 }
 
-/**
- * init() wird im Hauptprogramm in init() aufgerufen.
- * Hier sollten die LED-Treiber in eine definierten
- * Ausgangszustand gebracht werden.
- */
-void LedDriverNeoPixel::init() {
-    setBrightness(50);
-    clearData();
-    wakeUp();
-}
-
 void LedDriverNeoPixel::printSignature() {
     Serial.println(F("NeoPixel - WS2812B"));
 }
-
-/**
- * Den Bildschirm-Puffer auf die LED-Matrix schreiben.
- *
- * @param onChange: TRUE, wenn es Aenderungen in dem Bildschirm-Puffer gab,
- *                  FALSE, wenn es ein Refresh-Aufruf war.
- */
-void LedDriverNeoPixel::writeScreenBufferToMatrix(word matrix[16], boolean onChange) {
-    if (onChange || _dirty) {
-        _dirty = false;
-        _strip->clear();
-
-        uint32_t color = _strip->Color(_brightnessScaleColor(getRed()), _brightnessScaleColor(getGreen()), _brightnessScaleColor(getBlue()));
-
-        for (byte y = 0; y < 10; y++) {
-            for (byte x = 5; x < 16; x++) {
-                word t = 1 << x;
-                if ((matrix[y] & t) == t) {
-                    _setPixel(15 - x, y, color);
-                }
-            }
-        }
-
-        // wir muessen die Eck-LEDs umsetzten...
-        if ((matrix[1] & 0b0000000000011111) == 0b0000000000011111) {
-            _setPixel(110, color); // 1
-        }
-        if ((matrix[0] & 0b0000000000011111) == 0b0000000000011111) {
-            _setPixel(111, color); // 2
-        }
-        if ((matrix[3] & 0b0000000000011111) == 0b0000000000011111) {
-            _setPixel(112, color); // 3
-        }
-        if ((matrix[2] & 0b0000000000011111) == 0b0000000000011111) {
-            _setPixel(113, color); // 4
-        }
-
-        _strip->show();
-    }
-}
-
-/**
- * Die Helligkeit des Displays anpassen.
- *
- * @param brightnessInPercent Die Helligkeit.
- */
-void LedDriverNeoPixel::setBrightness(byte brightnessInPercent) {
-    if (brightnessInPercent != _brightnessInPercent) {
-        _brightnessInPercent = brightnessInPercent;
-        _dirty = true;
-    }
-}
-
-/**
- * Die aktuelle Helligkeit bekommen.
- */
-byte LedDriverNeoPixel::getBrightness() {
-    return _brightnessInPercent;
-}
-
-/**
- * Anpassung der Groesse des Bildspeichers.
- *
- * @param linesToWrite Wieviel Zeilen aus dem Bildspeicher sollen
- *                     geschrieben werden?
- */
-void LedDriverNeoPixel::setLinesToWrite(byte linesToWrite) {
-}
-
-/**
- * Das Display ausschalten.
- */
-void LedDriverNeoPixel::shutDown() {
-    _strip->clear();
-    _strip->show();
-}
-
-/**
- * Das Display einschalten.
- */
-void LedDriverNeoPixel::wakeUp() {
-}
-
-/**
- * Den Dateninhalt des LED-Treibers loeschen.
- */
-void LedDriverNeoPixel::clearData() {
-    _strip->clear();
-    _strip->show();
-}
-
-/**
- * Einen X/Y-koordinierten Pixel in der Matrix setzen.
- */
-void LedDriverNeoPixel::_setPixel(byte x, byte y, uint32_t c) {
-    _setPixel(x + (y * 11), c);
-}
-
-/**
- * Einen Pixel im Streifen setzten (die Eck-LEDs sind am Ende).
- */
-void LedDriverNeoPixel::_setPixel(byte num, uint32_t c) {
-    if (num < 110) {
-        if ((num / 11) % 2 == 0) {
-            _strip->setPixelColor(num, c);
-        } else {
-            _strip->setPixelColor(((num / 11) * 11) + 10 - (num % 11), c);
-        }
-    } else {
-        switch (num) {
-            case 110:
-                _strip->setPixelColor(111, c);
-                break;
-            case 111:
-                _strip->setPixelColor(112, c);
-                break;
-            case 112:
-                _strip->setPixelColor(113, c);
-                break;
-            case 113:
-                _strip->setPixelColor(110, c);
-                break;
-        }
-    }
-}
-
-/**
- * Funktion fuer saubere 'Regenbogen'-Farben.
- * Kopiert aus den Adafruit-Beispielen (strand).
- */
-uint32_t LedDriverNeoPixel::_wheel(byte wheelPos) {
-    if (wheelPos < 85) {
-        return _strip->Color(wheelPos * 3, 255 - wheelPos * 3, 0);
-    } else if (wheelPos < 170) {
-        wheelPos -= 85;
-        return _strip->Color(255 - wheelPos * 3, 0, wheelPos * 3);
-    } else {
-        wheelPos -= 170;
-        return _strip->Color(0, wheelPos * 3, 255 - wheelPos * 3);
-    }
-}
-
-/**
- * Hilfsfunktion fuer das Skalieren der Farben.
- */
-byte LedDriverNeoPixel::_brightnessScaleColor(byte colorPart) {
-    return map(_brightnessInPercent, 0, 100, 0, colorPart);
-}
@@ -7,14 +7,19 @@
  *
  * @mc       Arduino/RBBB
  * @autor    Christian Aschoff / caschoff _AT_ mac _DOT_ com
- * @version  1.2
+ * @version  1.7
  * @created  5.1.2015
- * @updated  16.2.2015
+ * @updated  18.10.2026
  *
  * Versionshistorie:
  * V 1.0:  - Erstellt.
  * V 1.1:  - Getter fuer Helligkeit nachgezogen.
  * V 1.2:  - Unterstuetzung fuer die alte Arduino-IDE (bis 1.0.6) entfernt.
+ * V 1.3:  - Nur noch die geaenderten Pixel schreiben (siehe LedDriver::_getChangedRows()).
+ * V 1.4:  - Optionale Intensitaet pro Pixel (LED_DRIVER_INTENSITY).
+ * V 1.5:  - Optionale Farbpalette (LED_DRIVER_PALETTE), vorskaliert bei neuer Farbe oder Helligkeit.
+ * V 1.6:  - Verkabelung als Tabelle im PROGMEM (LedDriverLayouts.h) statt _setPixel().
+ * V 1.7:  - Zeichnen, Helligkeit und Farben aus dem gemeinsamen StripLedDriver-Template.
  *
  * Verkabelung: Einspeisung oben links, dann schlangenfoermig runter,
  * dann Ecke unten links, oben links, oben rechts, unten rechts.
@@ -24,43 +29,19 @@
 #define LED_DRIVER_NEOPIXEL_H
 
 #include "Arduino.h"
-#include "LedDriver.h"
+#include "StripLedDriver.h"
 #include <Adafruit_NeoPixel.h>
 
-class LedDriverNeoPixel : public LedDriver {
+extern const byte layoutNeoPixel[] PROGMEM;
+
+class LedDriverNeoPixel : public StripLedDriver<Adafruit_NeoPixel, layoutNeoPixel, STRIP_COLOR_RGB, 8> {
 public:
     LedDriverNeoPixel(byte dataPin);
 
-    void init();
-
     void printSignature();
 
-    void writeScreenBufferToMatrix(word matrix[16], boolean onChange);
-
-    void setBrightness(byte brightnessInPercent);
-    byte getBrightness();
-
-    void setLinesToWrite(byte linesToWrite);
-
-    void shutDown();
-    void wakeUp();
-
-    void clearData();
-
 private:
-    byte _brightnessInPercent;
-
-    boolean _dirty;
-
-    void _setPixel(byte x, byte y, uint32_t c);
-    void _setPixel(byte num, uint32_t c);
-
-    uint32_t _wheel(byte wheelPos);
-
-    byte _brightnessScaleColor(byte colorPart);
-
     byte _dataPin;
-    Adafruit_NeoPixel *_strip;
 };
 
 #endif
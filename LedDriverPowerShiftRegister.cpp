@@ -4,15 +4,18 @@
  *
  * @mc       Arduino/RBBB
  * @autor    Christian Aschoff / caschoff _AT_ mac _DOT_ com
- * @version  1.3
+ * @version  1.5
  * @created  13.8.2013
- * @updated  16.2.2015
+ * @updated  18.10.2026
  *
  * Versionshistorie:
  * V 1.0:  - Erstellt.
  * V 1.1:  - Anpassung auf Helligkeit 0-100%
  * V 1.2:  - Getter fuer Helligkeit nachgezogen.
  * V 1.3:  - Unterstuetzung fuer die alte Arduino-IDE (bis 1.0.6) entfernt.
+ * V 1.4:  - init() startet die Shift-Register (ShiftRegister::begin()).
+ * V 1.5:  - Der Bitstrom wird per Bit-Transposition am Stueck berechnet und byteweise
+ *           ausgegeben (mit SHIFTREGISTER_SPI ueber Hardware-SPI).
  */
 #include "LedDriverPowerShiftRegister.h"
 
@@ -41,6 +44,7 @@ LedDriverPowerShiftRegister::LedDriverPowerShiftRegister(byte data, byte clock,
  * Ausgangszustand gebracht werden.
  */
 void LedDriverPowerShiftRegister::init() {
+    _shiftRegister->begin();
 }
 
 void LedDriverPowerShiftRegister::printSignature() {
@@ -55,34 +59,56 @@ void LedDriverPowerShiftRegister::printSignature() {
  */
 void LedDriverPowerShiftRegister::writeScreenBufferToMatrix(word matrix[16], boolean onChange) {
     if (onChange) {
-        _shiftRegister->prepareShiftregisterWrite();
-
-        // die letzten 6 Outputs sind frei - padding
-        for (byte p = 0; p < 6; p++) {
-            _shiftRegister->shiftOutABit(false);
+        // Spalten statt Zeilen: nach der Transposition steht Spalte x in a[x],
+        // die Zeile y in Bit 15 - y (die Ecken stehen als Spalte 11 in a[11])...
+        word a[16];
+        for (byte y = 0; y < 16; y++) {
+            a[y] = (y < 10) ? matrix[y] : 0;
         }
-
-        // dann Ecken...
-        // unten links...
-        _shiftRegister->shiftOutABit(getPixelFromScreenBuffer(11, 3, matrix));
-        // unten rechts...
-        _shiftRegister->shiftOutABit(getPixelFromScreenBuffer(11, 2, matrix));
-        // oben rechts...
-        _shiftRegister->shiftOutABit(getPixelFromScreenBuffer(11, 1, matrix));
-        // oben links...
-        _shiftRegister->shiftOutABit(getPixelFromScreenBuffer(11, 0, matrix));
-
-        // dann weiter...
-        for (int x = 10; x >= 0; x--) {
-            for (int y = 9; y >= 0; y--) {
-                _shiftRegister->shiftOutABit(getPixelFromScreenBuffer(x, y, matrix));
+        _transpose(a);
+
+        // Der Bitstrom besteht aus 12 Stuecken zu 10 Bit (das erste Bit kommt zuerst raus):
+        // die letzten 6 Outputs sind frei (padding), dann die Ecken unten links,
+        // unten rechts, oben rechts, oben links, dann die Spalten 10 bis 0, jeweils
+        // von Zeile 9 bis Zeile 0...
+        byte stream[POWER_SHIFT_REGISTER_BYTES];
+        byte pos = 0;
+        unsigned long bits = (a[11] >> 12) << 6;
+        byte count = 10;
+        for (char x = 10; x >= -1; x--) {
+            while (count >= 8) {
+                stream[pos++] = bits;
+                bits >>= 8;
+                count -= 8;
+            }
+            if (x >= 0) {
+                bits |= (unsigned long) (a[(byte) x] >> 6) << count;
+                count += 10;
             }
         }
 
+        _shiftRegister->prepareShiftregisterWrite();
+        _shiftRegister->shiftOutBytes(stream, POWER_SHIFT_REGISTER_BYTES);
         _shiftRegister->finishShiftregisterWrite();
     }
 }
 
+/**
+ * Eine 16x16-Bitmatrix transponieren (Bit 15 - x von a[y] landet in Bit 15 - y von a[x]).
+ * Statt 256 einzelner Bits werden in vier Runden Bloecke von 8, 4, 2 und 1 Bit
+ * mit Masken und Shifts vertauscht (siehe Hacker's Delight, transpose32).
+ */
+void LedDriverPowerShiftRegister::_transpose(word a[16]) {
+    word m = 0x00FF;
+    for (byte j = 8; j != 0; j >>= 1, m ^= (m << j)) {
+        for (byte k = 0; k < 16; k = (k + j + 1) & ~j) {
+            word t = (a[k] ^ (a[k + j] >> j)) & m;
+            a[k] ^= t;
+            a[k + j] ^= (t << j);
+        }
+    }
+}
+
 /**
  * Die Helligkeit des Displays anpassen.
  *
@@ -4,15 +4,17 @@
  *
  * @mc       Arduino/RBBB
  * @autor    Christian Aschoff / caschoff _AT_ mac _DOT_ com
- * @version  1.3
+ * @version  1.4
  * @created  13.8.2013
- * @updated  16.2.2015
+ * @updated  18.10.2026
  *
  * Versionshistorie:
  * V 1.0:  - Erstellt.
  * V 1.1:  - Anpassung auf Helligkeit 0-100%
  * V 1.2:  - Getter fuer Helligkeit nachgezogen.
  * V 1.3:  - Unterstuetzung fuer die alte Arduino-IDE (bis 1.0.6) entfernt.
+ * V 1.4:  - Der Bitstrom wird per Bit-Transposition am Stueck berechnet und byteweise
+ *           ausgegeben (mit SHIFTREGISTER_SPI ueber Hardware-SPI).
  */
 #ifndef LED_DRIVER_POWER_SHIFT_REGISTER_H
 #define LED_DRIVER_POWER_SHIFT_REGISTER_H
@@ -21,6 +23,9 @@
 #include "LedDriver.h"
 #include "ShiftRegister.h"
 
+// Die Laenge des Bitstroms in Bytes (6 freie Ausgaenge, 4 Ecken, 110 Buchstaben).
+#define POWER_SHIFT_REGISTER_BYTES 15
+
 class LedDriverPowerShiftRegister : public LedDriver {
 public:
     LedDriverPowerShiftRegister(byte data, byte clock, byte latch, byte outputEnable);
@@ -49,6 +54,8 @@ private:
     byte _outputEnable;
 
     ShiftRegister *_shiftRegister;
+
+    void _transpose(word a[16]);
 };
 
 #endif
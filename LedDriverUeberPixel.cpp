@@ -4,9 +4,9 @@
  *
  * @mc       Arduino/RBBB
  * @autor    Christian Aschoff / caschoff _AT_ mac _DOT_ com
- * @version  1.4
+ * @version  1.6
  * @created  18.1.2013
- * @updated  16.2.2015
+ * @updated  18.10.2026
  *
  * Versionshistorie:
  * V 1.0:  - Erstellt.
@@ -15,12 +15,22 @@
  * V 1.2:  - Anpassung auf Helligkeit 0-100%
  * V 1.3:  - Getter fuer Helligkeit nachgezogen.
  * V 1.4:  - Unterstuetzung fuer die alte Arduino-IDE (bis 1.0.6) entfernt.
+ * V 1.5:  - Nur noch die geaenderten Pixel schreiben (siehe LedDriver::_getChangedRows()).
+ * V 1.6:  - Schattenkopie der 4x8 Digit-Register, der Bildspeicher wird in einem Durchlauf
+ *           umgesetzt und nur geaenderte Digits werden geschrieben, fuer alle vier MAX7219 mit einem Latch.
+ *
+ * Verkabelung: Die Buchstaben links (x = 0-5) haengen am 1. (oben) und 3. (unten) MAX7219,
+ * die rechts (x = 6-10) am 2. und 4., jeweils x als Digit und y als Segment (Bit 7 = oberste Zeile).
+ * Die Ecken 1-4 haengen am 1.-4. MAX7219 an Digit 6, 5, 6, 5, Segment 5.
  */
 #include "LedDriverUeberPixel.h"
 
 // #define DEBUG
 #include "Debug.h"
 
+// Der Opcode fuer Digit 0 (die Digits 0-7 haben die Opcodes 1-8).
+#define MAX7219_OP_DIGIT0 1
+
 /**
  * Initialisierung.
  *
@@ -29,7 +39,11 @@
  * @param latch Pin, an dem die Latch-Line haengt.
  */
 LedDriverUeberPixel::LedDriverUeberPixel(byte data, byte clock, byte load) {
+    _dataPin = data;
+    _clockPin = clock;
+    _loadPin = load;
     _ledControl = new LedControl(data, clock, load, 4);
+    memset(_reg, 0xFF, sizeof(_reg));
 }
 
 /**
@@ -48,6 +62,8 @@ void LedDriverUeberPixel::init() {
     delay(250);
     _ledControl->setLed(3, 5, 5, true); // 4
     delay(250);
+    memset(_reg, 0xFF, sizeof(_reg));
+    _invalidateLastMatrix();
 }
 
 void LedDriverUeberPixel::printSignature() {
@@ -62,37 +78,48 @@ void LedDriverUeberPixel::printSignature() {
  */
 void LedDriverUeberPixel::writeScreenBufferToMatrix(word matrix[16], boolean onChange) {
     if (onChange) {
+        // nichts geaendert, nichts zu schreiben...
+        if (_getChangedRows(matrix) == 0) {
+            return;
+        }
+
+        // den Bildspeicher in einem Durchlauf in die Digit-Register umsetzen...
+        byte regs[4][8];
+        memset(regs, 0, sizeof(regs));
         for (byte y = 0; y < 10; y++) {
-            for (byte x = 5; x < 16; x++) {
-                word t = 1 << x;
-                if ((matrix[y] & t) == t) {
-                    _setPixel(15 - x, y, true);
-                } else {
-                    _setPixel(15 - x, y, false);
+            byte segment = 0b10000000 >> ((y < 5) ? y : y - 5);
+            byte left = (y < 5) ? 0 : 2;
+            word pixels = matrix[y];
+            for (byte x = 0; x < 11; x++, pixels <<= 1) {
+                if (pixels & 0b1000000000000000) {
+                    if (x < 6) {
+                        regs[left][x] |= segment;
+                    } else {
+                        regs[left + 1][x - 6] |= segment;
+                    }
                 }
             }
         }
-        // wir muessen die Eck-LEDs umsetzten...
-        if ((matrix[1] & 0b0000000000011111) == 0b0000000000011111) {
-            _ledControl->setLed(0, 6, 5, true); // 1
-        } else {
-            _ledControl->setLed(0, 6, 5, false); // 1
-        }
-        if ((matrix[0] & 0b0000000000011111) == 0b0000000000011111) {
-            _ledControl->setLed(1, 5, 5, true); // 2
-        } else {
-            _ledControl->setLed(1, 5, 5, false); // 2
-        }
-        if ((matrix[3] & 0b0000000000011111) == 0b0000000000011111) {
-            _ledControl->setLed(2, 6, 5, true); // 3
-        } else {
-            _ledControl->setLed(2, 6, 5, false); // 3
+
+        // wir muessen die Eck-LEDs umsetzten (Ecke 1, 2, 3, 4 steht in Zeile 1, 0, 3, 2
+        // und haengt am 1., 2., 3., 4. MAX7219 an Digit 6, 5, 6, 5)...
+        for (byte i = 0; i < 4; i++) {
+            if ((matrix[i ^ 1] & 0b0000000000011111) == 0b0000000000011111) {
+                regs[i][(i & 1) ? 5 : 6] |= 0b00000100;
+            }
         }
-        if ((matrix[2] & 0b0000000000011111) == 0b0000000000011111) {
-            _ledControl->setLed(3, 5, 5, true); // 4
-        } else {
-            _ledControl->setLed(3, 5, 5, false); // 4
+
+        // nur die Digits schreiben, die sich bei mindestens einem MAX7219 geaendert haben...
+        for (byte digit = 0; digit < 8; digit++) {
+            for (byte i = 0; i < 4; i++) {
+                if (regs[i][digit] != _reg[i][digit]) {
+                    _writeDigit(digit, regs);
+                    break;
+                }
+            }
         }
+
+        _storeLastMatrix(matrix);
     }
 }
 
@@ -160,29 +187,21 @@ void LedDriverUeberPixel::clearData() {
     for (byte i = 0; i < 4; i++) {
         _ledControl->clearDisplay(i);
     }
+    memset(_reg, 0, sizeof(_reg));
+    _invalidateLastMatrix();
 }
 
 /**
- * Einen X/Y-koordinierten Pixel in der Matrix setzen.
+ * Ein Digit bei allen vier MAX7219 mit einem Latch schreiben (und in der
+ * Schattenkopie merken). Die Kette bekommt wie bei LedControl zuerst die
+ * Daten fuer den letzten MAX7219, jeweils Opcode und Wert, MSB zuerst.
  */
-void LedDriverUeberPixel::_setPixel(byte x, byte y, boolean state) {
-    // 1. MAX7219
-    if ((x < 6) && (y < 5)) {
-        _ledControl->setLed(0, x, y, state);
-    }
-
-    // 2. MAX7219
-    if ((x < 6) && (y > 4) && (y < 10)) {
-        _ledControl->setLed(2, x, y - 5, state);
-    }
-
-    // 3. MAX7219
-    if ((x > 5) && (x < 11) && (y < 5)) {
-        _ledControl->setLed(1, x - 6, y, state);
-    }
-
-    // 4. MAX7219
-    if ((x > 5) && (x < 11) && (y > 4) && (y < 10)) {
-        _ledControl->setLed(3, x - 6, y - 5, state);
+void LedDriverUeberPixel::_writeDigit(byte digit, byte regs[4][8]) {
+    digitalWrite(_loadPin, LOW);
+    for (char i = 3; i >= 0; i--) {
+        shiftOut(_dataPin, _clockPin, MSBFIRST, MAX7219_OP_DIGIT0 + digit);
+        shiftOut(_dataPin, _clockPin, MSBFIRST, regs[(byte) i][digit]);
+        _reg[(byte) i][digit] = regs[(byte) i][digit];
     }
+    digitalWrite(_loadPin, HIGH);
 }
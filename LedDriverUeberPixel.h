@@ -4,9 +4,9 @@
  *
  * @mc       Arduino/RBBB
  * @autor    Christian Aschoff / caschoff _AT_ mac _DOT_ com
- * @version  1.4
+ * @version  1.6
  * @created  18.1.2013
- * @updated  16.2.2015
+ * @updated  18.10.2026
  *
  * Versionshistorie:
  * V 1.0:  - Erstellt.
@@ -15,6 +15,9 @@
  * V 1.2:  - Anpassung auf Helligkeit 0-100%
  * V 1.3:  - Getter fuer Helligkeit nachgezogen.
  * V 1.4:  - Unterstuetzung fuer die alte Arduino-IDE (bis 1.0.6) entfernt.
+ * V 1.5:  - Nur noch die geaenderten Pixel schreiben (siehe LedDriver::_getChangedRows()).
+ * V 1.6:  - Schattenkopie der 4x8 Digit-Register, der Bildspeicher wird in einem Durchlauf
+ *           umgesetzt und nur geaenderte Digits werden geschrieben, fuer alle vier MAX7219 mit einem Latch.
  */
 #ifndef LED_DRIVER_UEBERPIXEL_H
 #define LED_DRIVER_UEBERPIXEL_H
@@ -44,10 +47,17 @@ public:
     void clearData();
 
 private:
-    void _setPixel(byte x, byte y, boolean state);
-
     byte _brightnessInPercent;
 
+    byte _dataPin;
+    byte _clockPin;
+    byte _loadPin;
+
+    // Schattenkopie der Digit-Register der vier MAX7219 (0xFF: unbekannt).
+    byte _reg[4][8];
+
+    void _writeDigit(byte digit, byte regs[4][8]);
+
     LedControl *_ledControl;
 };
 
@@ -12,9 +12,9 @@
  * @mc       Arduino/RBBB
  * @autor    Andreas Mueller
  *           Vorlage von: Christian Aschoff / caschoff _AT_ mac _DOT_ com
- * @version  1.2
+ * @version  1.8
  * @created  21.3.2016
- * @updated  14.04.2016
+ * @updated  18.10.2026
  *
  * Versionshistorie:
  * V 1.0:   * Signalauswertealgoritmus komplett neu geschrieben! *
@@ -28,8 +28,26 @@
  * V 1.1:   - Funktion für EXT_MODE_DCF_DEBUG eingeführt.
  *          - Umschaltung von Timer1 auf Timer2 in Header-Datei möglich. (Entfällt ab V 1.2)
  * V 1.2:   * Die Driftkorrektur benötigt keinen Timer mehr! *
+ * V 1.3:   - Ruhige Bins der Sekunde (ohne DCF77-Impuls) für die LED-Updates (MYDCF77_QUIET_WINDOWS):
+ *            isQuietWindow(), getMillisToQuietWindow().
+ * V 1.4:   - Flanken per Interrupt mit Zeitstempel in einem Ringpuffer (MYDCF77_EDGE_CAPTURE),
+ *            die Bins bekommen dann die Dauer des Signals statt gezählter Abfragen.
+ *          - consumeEdges() hält nach einer Synchronisation an, bis poll() sie gemeldet hat
+ *            (nach einem Hänger hat die nächste Sekunde die Zeit sonst schon gelöscht).
+ * V 1.5:   - Optional Bits aus dem DCF77Demodulator (Korrelationsfilter, PLL, weiche Bits)
+ *            statt aus den Bins (MYDCF77_MATCHED_FILTER).
+ * V 1.6:   - Optional die weichen Bits über mehrere Minuten sammeln (DCF77Accumulator,
+ *            MYDCF77_ACCUMULATOR), Aussetzer und verpasste Minutenmarken werden dafür ausgeglichen.
+ * V 1.7:   - Das Telegramm als 64-Bit-Wort statt ein Byte pro Bit, dazu ein Ringpuffer der
+ *            letzten Telegramme (getTelegram()).
+ *          - decode() mit Masken, Tabelle für die BCD-Zehner und Paritäten über popcount,
+ *            der Tag wird gegen die Länge des Monats geprüft.
+ *          - Die Prüfungen ohne die weichen Bits als statisches decodeTelegram().
+ * V 1.8:   - Das rohe Signal binär über Serial aufzeichnen (DCF77Recorder, MYDCF77_RECORDER),
+ *            recordTime() für die RTC-Zeit.
  */
 #include "MyDCF77.h"
+#include <avr/pgmspace.h>
 
 //#define DEBUG
 #include "Debug.h"
@@ -39,7 +57,60 @@
 // Höhe des Signalgraphen, wenn DEBUG_SIGNAL gesetzt (Default: 40.)
 #define DEBUG_SIGNAL_VIS_HEIGHT 40.
 
-byte MyDCF77::DCF77Factors[] = {1, 2, 4, 8, 10, 20, 40, 80};
+// Ein Feld des Telegramms: length (höchstens 8) Bits ab Sekunde from.
+#define MYDCF77_FIELD(telegram, from, length) ((byte)((telegram) >> (from)) & (byte)((1 << (length)) - 1))
+// Die Sekunden from bis to als Maske (für die Paritäten).
+#define MYDCF77_MASK(from, to) (((2ULL << (to)) - 1) & ~((1ULL << (from)) - 1))
+
+// Die Zehner der BCD-Felder (obere 4 Bit).
+extern const byte dcf77Tens[16] PROGMEM;
+const byte dcf77Tens[16] = {0, 10, 20, 30, 40, 50, 60, 70, 80, 90, 100, 110, 120, 130, 140, 150};
+
+// Die Tage der Monate 1-12 (Februar ohne Schaltjahr).
+extern const byte dcf77DaysPerMonth[13] PROGMEM;
+const byte dcf77DaysPerMonth[13] = {0, 31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+
+/**
+ * Ein BCD-Feld umrechnen, 0xFF bei einer Einerstelle über 9.
+ */
+static byte dcf77Bcd(byte bcd) {
+    if ((bcd & 0x0F) > 9) {
+        return 0xFF;
+    }
+    return pgm_read_byte_near(&dcf77Tens[bcd >> 4]) + (bcd & 0x0F);
+}
+
+#ifdef MYDCF77_EDGE_CAPTURE
+// Der Empfänger, dessen Flanken die Interrupt-Routine aufzeichnet.
+static MyDCF77 *edgeCaptureDcf77;
+
+static void dcf77Edge() {
+    edgeCaptureDcf77->captureEdge();
+}
+
+#ifdef __AVR__
+/*
+ * Pins ohne externen Interrupt (z. B. Pin 9 am ATmega328) laufen über den
+ * Pin-Change-Interrupt ihrer Gruppe. Achtung: verträgt sich nicht mit
+ * Bibliotheken, die diese Vektoren selbst belegen (z. B. SoftwareSerial).
+ */
+#ifdef PCINT0_vect
+ISR(PCINT0_vect) {
+    dcf77Edge();
+}
+#endif
+#ifdef PCINT1_vect
+ISR(PCINT1_vect) {
+    dcf77Edge();
+}
+#endif
+#ifdef PCINT2_vect
+ISR(PCINT2_vect) {
+    dcf77Edge();
+}
+#endif
+#endif
+#endif
 
 /**
  * Initialisierung mit dem Pin, an dem das Signal des Empfaengers anliegt
@@ -56,11 +127,47 @@ MyDCF77::MyDCF77(byte signalPin, byte statusLedPin) : TimeStamp(0, 0, 0, 0, 0, 0
 
     clearBits();
     clearBins();
+    for (byte i = 0; i < MYDCF77_TELEGRAM_RING; i++) {
+        _recentTelegrams[i] = 0;
+    }
 
     _dcf77Freq = 1000000/MYDCF77_SIGNAL_BINS;
     _dcf77LastTime = micros();
+#ifdef MYDCF77_MATCHED_FILTER
+    _slotStart = _dcf77LastTime;
+#ifndef MYDCF77_EDGE_CAPTURE
+    _lastSampleTime = _dcf77LastTime;
+#endif
+#endif
+
+#ifdef MYDCF77_EDGE_CAPTURE
+    _captureLevel = (digitalRead(_signalPin) == HIGH);
+    _edgeLevel = _captureLevel;
+    _integratedTo = _dcf77LastTime;
+    edgeCaptureDcf77 = this;
+    if (digitalPinToInterrupt(_signalPin) != NOT_AN_INTERRUPT) {
+        attachInterrupt(digitalPinToInterrupt(_signalPin), dcf77Edge, CHANGE);
+    }
+#ifdef __AVR__
+    else {
+        // kein externer Interrupt an diesem Pin, also Pin-Change-Interrupt...
+        *digitalPinToPCMSK(_signalPin) |= bit(digitalPinToPCMSKbit(_signalPin));
+        PCICR |= bit(digitalPinToPCICRbit(_signalPin));
+    }
+#endif
+#endif
 }
 
+#ifdef MYDCF77_RECORDER
+/**
+ * Die Zeit der RTC in die Aufzeichnung schreiben (beim nächsten poll()).
+ * Einmal pro Minute aufrufen, damit beim Abspielen der DCF77Helper die RTC hat.
+ */
+void MyDCF77::recordTime(TimeStamp *rtc, byte seconds) {
+    _recorder.setTime(rtc, seconds);
+}
+#endif
+
 /**
  * Die LED ein- oder ausschalten.
  */
@@ -99,16 +206,29 @@ boolean MyDCF77::signal(boolean signalIsInverted) {
 boolean MyDCF77::poll(boolean signalIsInverted) {
     boolean retVal = false;
 
+#ifdef MYDCF77_EDGE_CAPTURE
+    consumeEdges(signalIsInverted);
+#else
     if (micros() - _dcf77LastTime >= _dcf77Freq) {
         _dcf77LastTime += _dcf77Freq;
         newCycle();
     }
+#endif
 
     if (!_updateFromDCF77) {
         retVal = true;
         _updateFromDCF77 = -1;
     }
 
+#if defined(MYDCF77_MATCHED_FILTER) && !defined(MYDCF77_EDGE_CAPTURE)
+    sampleSlot(signal(signalIsInverted));
+#endif
+
+#if defined(MYDCF77_RECORDER) && !defined(MYDCF77_EDGE_CAPTURE)
+    _recorder.record(micros(), signal(false));
+#endif
+
+#ifndef MYDCF77_EDGE_CAPTURE
     if (_binsPointer >= 0) {             
         if (signal(signalIsInverted)) {
             // Array an _binsPointer-Position wird mit Messwerten gefüllt
@@ -116,10 +236,250 @@ boolean MyDCF77::poll(boolean signalIsInverted) {
         }   
         _nPolls++;   
     }
+#endif
        
     return retVal;
 }
 
+#ifdef MYDCF77_EDGE_CAPTURE
+/**
+ * Eine Flanke aufzeichnen. Wird von der Interrupt-Routine aufgerufen, beim
+ * Pin-Change-Interrupt auch für die anderen Pins der Gruppe (dann ist der
+ * Pegel unverändert und es passiert nichts).
+ */
+void MyDCF77::captureEdge() {
+    boolean level = (digitalRead(_signalPin) == HIGH);
+    if (level != _captureLevel) {
+        _captureLevel = level;
+        pushEdge(micros(), level);
+    }
+}
+
+/**
+ * Eine Flanke in den Ringpuffer schreiben. Nur aus der Interrupt-Routine
+ * aufrufen oder (zum Abspielen aufgezeichneter Flanken) ohne aktiven Interrupt.
+ *
+ * @param time Der Zeitpunkt der Flanke (micros()).
+ * @param level Der Pegel am Pin nach der Flanke (HIGH = TRUE, nicht invertiert).
+ * @return FALSE, wenn der Puffer voll war und die Flanke verloren ist.
+ */
+boolean MyDCF77::pushEdge(unsigned long time, boolean level) {
+    byte next = (_edgeHead + 1) & (MYDCF77_EDGE_BUFFER - 1);
+    if (next == _edgeTail) {
+        if (_droppedEdges < 255) {
+            _droppedEdges++;
+        }
+        return false;
+    }
+    _edges[_edgeHead] = (time & ~1UL) | level;
+    _edgeHead = next;
+    return true;
+}
+
+/**
+ * Die Anzahl der Flanken, die wegen eines vollen Puffers verloren gingen (bis 255).
+ */
+byte MyDCF77::getDroppedEdges() {
+    return _droppedEdges;
+}
+
+/**
+ * Die Flanken aus dem Ringpuffer und die Grenzen der Bins in ihrer
+ * zeitlichen Reihenfolge abarbeiten. Wie lange poll() auf sich warten
+ * lässt, spielt damit keine Rolle mehr, nur der Puffer darf nicht überlaufen.
+ * Jede Flanke trägt ihren Pegel, nach einer verlorenen Flanke stimmt der
+ * Pegel also ab der nächsten wieder. Nach einer Synchronisation geht es erst
+ * beim nächsten poll() weiter.
+ */
+void MyDCF77::consumeEdges(boolean signalIsInverted) {
+    unsigned long now = micros();
+    // nach einer Synchronisation erst poll() melden lassen, sonst könnte die
+    // nächste Sekunde (z. B. eine Minutenmarke ohne Empfang) die Zeit wieder löschen...
+    while (_updateFromDCF77 != 0) {
+        unsigned long boundary = _dcf77LastTime + _dcf77Freq;
+        if (_edgeTail != _edgeHead) {
+            unsigned long edge = _edges[_edgeTail];
+            if ((long)(edge - boundary) < 0) {
+                integrateSignal(edge, _edgeLevel != signalIsInverted);
+                _edgeLevel = edge & 1;
+#ifdef MYDCF77_RECORDER
+                _recorder.record(edge & ~1UL, _edgeLevel);
+#endif
+                _edgeTail = (_edgeTail + 1) & (MYDCF77_EDGE_BUFFER - 1);
+                continue;
+            }
+        }
+        if ((long)(now - boundary) < 0) {
+#ifdef MYDCF77_RECORDER
+            // alle Flanken bis now sind durch, Pausen und die RTC-Zeit gehen jetzt...
+            _recorder.record(now, _edgeLevel);
+#endif
+            break;
+        }
+        integrateSignal(boundary, _edgeLevel != signalIsInverted);
+        _dcf77LastTime = boundary;
+        newCycle();
+    }
+}
+
+/**
+ * Die Zeit seit dem letzten Aufruf in den aktuellen Bin übernehmen: _nPolls
+ * zählt die Einheiten (64us), der Bin die Einheiten mit Signal.
+ */
+void MyDCF77::integrateSignal(unsigned long until, boolean high) {
+#ifdef MYDCF77_MATCHED_FILTER
+    integrateSlots(until, high);
+#endif
+    if ((long)(until - _integratedTo) <= 0) {
+        return;
+    }
+    unsigned int units = (until >> MYDCF77_EDGE_UNIT_SHIFT) - (_integratedTo >> MYDCF77_EDGE_UNIT_SHIFT);
+    _integratedTo = until;
+    if (_binsPointer >= 0) {
+        if (high) {
+            _bins[_binsPointer] += units;
+        }
+        _nPolls += units;
+    }
+}
+#endif
+
+#ifdef MYDCF77_MATCHED_FILTER
+#ifndef MYDCF77_EDGE_CAPTURE
+/**
+ * Eine Abfrage (ohne MYDCF77_EDGE_CAPTURE) in den laufenden Slot übernehmen.
+ * Abgelaufene Slots bekommen den Anteil der Abfragen mit Signal. Slots ganz
+ * ohne Abfrage (langsame loop()) bekommen den Pegel der Abfrage, die ihrer
+ * Mitte am nächsten liegt (die letzte davor oder diese).
+ */
+void MyDCF77::sampleSlot(boolean high) {
+    unsigned long now = micros();
+    while (now - _slotStart >= DCF77_DEMOD_SLOT_MICROS) {
+        if (_slotPolls) {
+            feedSlot((unsigned long)_slotHigh * 255 / _slotPolls);
+        } else {
+            unsigned long middle = _slotStart + DCF77_DEMOD_SLOT_MICROS / 2;
+            boolean nearest = (middle - _lastSampleTime < now - middle) ? _lastSample : high;
+            feedSlot(nearest ? 255 : 0);
+        }
+        _slotStart += DCF77_DEMOD_SLOT_MICROS;
+        _slotHigh = 0;
+        _slotPolls = 0;
+    }
+    _slotPolls++;
+    if (high) {
+        _slotHigh++;
+    }
+    _lastSample = high;
+    _lastSampleTime = now;
+}
+#else
+
+/**
+ * Die Zeit seit dem letzten Aufruf (mit MYDCF77_EDGE_CAPTURE) in die Slots
+ * übernehmen, abgelaufene Slots bekommen den Anteil der Zeit mit Signal.
+ */
+void MyDCF77::integrateSlots(unsigned long until, boolean high) {
+    if ((long)(until - _integratedTo) <= 0) {
+        return;
+    }
+    unsigned long from = _integratedTo;
+    while ((long)(until - (_slotStart + DCF77_DEMOD_SLOT_MICROS)) >= 0) {
+        unsigned long end = _slotStart + DCF77_DEMOD_SLOT_MICROS;
+        if (high) {
+            _slotHigh += end - from;
+        }
+        feedSlot((unsigned long)_slotHigh * 255 / DCF77_DEMOD_SLOT_MICROS);
+        _slotStart = end;
+        _slotHigh = 0;
+        from = end;
+    }
+    if (high) {
+        _slotHigh += until - from;
+    }
+}
+#endif
+
+/**
+ * Einen fertigen Slot an den Demodulator geben. Nach jeder ausgewerteten Sekunde
+ * kommt das weiche Bit in das Telegramm, bei der Minutenmarke wird decodiert.
+ * Die Uhr wird zum Beginn der nächsten Sekunde (Sekunde 0) gestellt.
+ *
+ * Mit MYDCF77_ACCUMULATOR müssen die Bits über die Minuten an ihrer Stelle bleiben:
+ * eine Minutenmarke mitten in der Minute ist ein Aussetzer (unsicheres Bit), fehlt
+ * sie nach Sekunde 58, ist sie verpasst worden. Kommt sie dann in der nächsten Minute
+ * wieder an derselben Stelle, war die erste Minutenmarke falsch und es geht dort neu
+ * los. Ausgerastet fängt alles neu an.
+ */
+void MyDCF77::feedSlot(byte level) {
+    if (_updateFromDCF77 > 0) {
+        _updateFromDCF77--;
+    }
+    if (!_demodulator.addSlot(level)) {
+#ifdef MYDCF77_ACCUMULATOR
+        if (_minuteSynced && !_demodulator.isLocked()) {
+            _minuteSynced = false;
+            _accumulator.reset();
+        }
+#endif
+        return;
+    }
+    boolean minuteMark = _demodulator.isMinuteMark();
+#ifdef MYDCF77_ACCUMULATOR
+    boolean forcedMark = false;
+    if (_minuteSynced) {
+        if (minuteMark && (_bitsPointer < MYDCF77_TELEGRAMMLAENGE)) {
+            if ((_bitsPointer == 0) && _forcedMark) {
+                // die echte Minutenmarke nach einer Schaltsekunde...
+                _forcedMark = false;
+                return;
+            }
+            if (_missedMark && (_bitsPointer == _misplacedMark)) {
+                // wieder an derselben Stelle und nicht am Ende: die erste Minutenmarke war ein Aussetzer...
+                DEBUG_PRINTLN(F("Minute mark misplaced, resyncing."));
+                _minuteSynced = false;
+                _accumulator.reset();
+            } else {
+                _misplacedMark = _bitsPointer;
+                minuteMark = false;
+            }
+        } else if (!minuteMark && (_bitsPointer == MYDCF77_TELEGRAMMLAENGE)) {
+            minuteMark = true;
+            forcedMark = true;
+        }
+        if (minuteMark) {
+            _missedMark = forcedMark;
+        }
+    }
+    _forcedMark = forcedMark;
+#endif
+    if (minuteMark) {
+        storeTelegram();
+#ifdef MYDCF77_ACCUMULATOR
+        if (_minuteSynced) {
+            _accumulator.addTelegram(_softBits);
+            if (_accumulator.getTelegram(&_telegram) && decode()) {
+                _updateFromDCF77 = _demodulator.getSlotsToSecondStart();
+            }
+        }
+        _minuteSynced = true;
+#else
+        if (decode()) {
+            _updateFromDCF77 = _demodulator.getSlotsToSecondStart();
+        }
+#endif
+        clearBits();
+        return;
+    }
+    _softBits[_bitsPointer] = _demodulator.getSoftBit();
+    setBit(_bitsPointer, _softBits[_bitsPointer] > 0);
+    _bitsPointer++;
+    if (_bitsPointer > MYDCF77_TELEGRAMMLAENGE) {
+        _bitsPointer = 0;
+    }
+}
+#endif
+
 /**
  * Der ( 1 / MYDCF77_SIGNAL_BINS )-ste Teil einer Sekunde startet.
  * Muss von einem externen Zeitgeber, z. B. einer RTC, aufgerufen werden.
@@ -136,8 +496,10 @@ void MyDCF77::newCycle() {
         // (1s / MYDCF77_SIGNAL_BINS) sind vorbei
         _binsPointer++;
 
+#ifndef MYDCF77_MATCHED_FILTER
         if (_updateFromDCF77 > 0)
             _updateFromDCF77--;
+#endif
         
         // Springe zurück zu Bin 0 und analysiere die letzte Sekunde
         if (_binsPointer >= MYDCF77_SIGNAL_BINS) {
@@ -158,22 +520,26 @@ void MyDCF77::newCycle() {
                isum += _bins[i];
             }
           
-            if (isum > average) {
-                _bits[_bitsPointer] = 1;
-            } else {
-                _bits[_bitsPointer] = 0;
-            }
+#ifdef MYDCF77_QUIET_WINDOWS
+            updateQuietBins(imax);
+#endif
+
+#ifndef MYDCF77_MATCHED_FILTER
+            setBit(_bitsPointer, isum > average);
+#endif
 
             #ifdef DEBUG_SIGNAL
                 OutputSignal(average, imax, isum);
             #endif
 
+#ifndef MYDCF77_MATCHED_FILTER
             _bitsPointer++;
             if (_bitsPointer > MYDCF77_TELEGRAMMLAENGE) {
                 _bitsPointer = 0;
             }
 
             if (!isum) {
+                storeTelegram();
                 if (decode()) {
                   /*
                    * Signal befindet sich zentriert im Sekundenintervall, 
@@ -183,6 +549,7 @@ void MyDCF77::newCycle() {
                 }
                 clearBits();
             }
+#endif
             _binsOffset += ((MYDCF77_SIGNAL_BINS-1)/2) - pos;
             _driftTimer++;
         }
@@ -201,6 +568,9 @@ void MyDCF77::newCycle() {
             _binsOffset /= MYDCF77_DRIFT_CORRECTION_TIME;
             _binsPointer = _binsOffset;
             clearBins();
+#ifdef MYDCF77_QUIET_WINDOWS
+            shiftQuietBins(_binsOffset);
+#endif
             
             if (_binsPointer) {
                 DEBUG_PRINT(F("Driftkorrektur erforderlich! Offset: "));
@@ -234,10 +604,16 @@ void MyDCF77::OutputSignal(unsigned int average, unsigned int imax, unsigned int
     DEBUG_PRINT(F(" Average: "));
     DEBUG_PRINT(average);
     DEBUG_PRINT(F(" Highcount: "));
+#ifdef MYDCF77_EDGE_CAPTURE
+    DEBUG_PRINT(isum);
+    DEBUG_PRINT(F(" Dropped edges: "));
+    DEBUG_PRINTLN(_droppedEdges);
+#else
     DEBUG_PRINTLN(isum);
+#endif
     for (byte i = 0; i < MYDCF77_TELEGRAMMLAENGE; i++) {      
         DEBUG_PRINT(F(" "));
-        DEBUG_PRINT(_bits[i]);
+        DEBUG_PRINT(getBitAtPos(i));
         if (i == _bitsPointer) {
           DEBUG_PRINT(".");
         }
@@ -248,12 +624,112 @@ void MyDCF77::OutputSignal(unsigned int average, unsigned int imax, unsigned int
     DEBUG_FLUSH();
 }
 
+#ifdef MYDCF77_QUIET_WINDOWS
+/**
+ * Liegt der aktuelle Bin ausserhalb des DCF77-Impulses? Dann stoeren
+ * LED-Updates den Empfang nicht. Solange kein Impuls erkannt wurde
+ * (kein Empfang, Dauersignal), ist jeder Bin ruhig.
+ */
+boolean MyDCF77::isQuietWindow() {
+    return isQuietBin(_binsPointer);
+}
+
+/**
+ * Wie lange dauert es (in Millisekunden), bis der naechste ruhige Bin beginnt?
+ *
+ * @return 0, wenn der aktuelle Bin ruhig ist.
+ */
+unsigned int MyDCF77::getMillisToQuietWindow() {
+    if (isQuietWindow()) {
+        return 0;
+    }
+    unsigned long elapsed = micros() - _dcf77LastTime;
+    if (elapsed > _dcf77Freq) {
+        elapsed = _dcf77Freq;
+    }
+    for (byte n = 1; n < MYDCF77_SIGNAL_BINS; n++) {
+        if (isQuietBin(_binsPointer + n)) {
+            // aufgerundet, 0 heisst "jetzt ruhig"...
+            return (n * _dcf77Freq - elapsed + 999) / 1000;
+        }
+    }
+    return 0;
+}
+
+/**
+ * Die ruhigen Bins aus der gerade vergangenen Sekunde bestimmen: alle Bins
+ * mit mehr als einem Viertel des Maximums (der Impuls) und MYDCF77_QUIET_GUARD_BINS
+ * Bins davor und dahinter sind laut. Ab dem Beginn eines Impulses sind es
+ * immer MYDCF77_QUIET_PULSE_BINS, auf eine 0 (100ms) kann eine 1 (200ms) folgen.
+ */
+void MyDCF77::updateQuietBins(unsigned int imax) {
+    if (!imax) {
+        // Minutenmarke oder kein Empfang, die alte Maske bleibt...
+        return;
+    }
+    unsigned long loudBins = 0;
+    byte loudCount = 0;
+    for (byte i = 0; i < MYDCF77_SIGNAL_BINS; i++) {
+        if (_bins[i] > imax / 4) {
+            int last = i;
+            if (_bins[(i + MYDCF77_SIGNAL_BINS - 1) % MYDCF77_SIGNAL_BINS] <= imax / 4) {
+                last += MYDCF77_QUIET_PULSE_BINS - 1;
+            }
+            for (int g = i - MYDCF77_QUIET_GUARD_BINS; g <= last + MYDCF77_QUIET_GUARD_BINS; g++) {
+                loudBins |= 1UL << ((g + MYDCF77_SIGNAL_BINS) % MYDCF77_SIGNAL_BINS);
+            }
+            loudCount++;
+        }
+    }
+    if ((loudCount > MYDCF77_SIGNAL_BINS / 2) || (loudBins == MYDCF77_ALL_BINS)) {
+        // Dauersignal oder Rauschen, da ist kein Impuls zu schuetzen...
+        _quietBins = MYDCF77_ALL_BINS;
+    } else {
+        _quietBins = ~loudBins & MYDCF77_ALL_BINS;
+    }
+}
+
+/**
+ * Die Driftkorrektur verschiebt die Bins um offset, die Maske also mit.
+ */
+void MyDCF77::shiftQuietBins(int offset) {
+    byte shift = ((offset % MYDCF77_SIGNAL_BINS) + MYDCF77_SIGNAL_BINS) % MYDCF77_SIGNAL_BINS;
+    _quietBins = ((_quietBins << shift) | (_quietBins >> (MYDCF77_SIGNAL_BINS - shift))) & MYDCF77_ALL_BINS;
+}
+
+/**
+ * Ist der Bin ruhig? Vor der Driftkorrektur kann der Bin negativ sein,
+ * danach ueber das Ende der Sekunde hinauslaufen.
+ */
+boolean MyDCF77::isQuietBin(int bin) {
+    bin = ((bin % MYDCF77_SIGNAL_BINS) + MYDCF77_SIGNAL_BINS) % MYDCF77_SIGNAL_BINS;
+    return (_quietBins >> bin) & 1;
+}
+#endif
+
 /**
  * Ein Bit im Array zum Debuggen (Anzeigen) bekommen.
  */
 byte MyDCF77::getBitAtPos(byte pos) {
-    return _bits[pos];
+    return bitRead(_telegram, pos);
+}
+
+/**
+ * Ein Telegramm aus dem Ringpuffer bekommen (0 = das der letzten Minutenmarke).
+ * Bit n ist Sekunde n, das Telegramm kann unvollständig oder falsch sein.
+ */
+uint64_t MyDCF77::getTelegram(byte age) {
+    return _recentTelegrams[(byte)(_recentTelegramsHead - 1 - age) & (MYDCF77_TELEGRAM_RING - 1)];
+}
+
+#ifdef MYDCF77_MATCHED_FILTER
+/**
+ * Ein weiches Bit bekommen: -127 (sicher 0) bis +127 (sicher 1), 0 = unsicher.
+ */
+int8_t MyDCF77::getSoftBitAtPos(byte pos) {
+    return _softBits[pos];
 }
+#endif
 
 /*
  * Vergangene Minuten seit der letzten erfolgreichen DCF-Auswertung bekommen.
@@ -290,169 +766,121 @@ byte MyDCF77::getDcf77ErrorCorner(boolean signalIsInverted) {
  * Decodierung des Telegramms...
  */
 boolean MyDCF77::decode() {
-    int c = 0; // bitcount for checkbit
     boolean ok = true;
 
-    DEBUG_PRINTLN(F("Decoding telegram..."));
-    DEBUG_FLUSH();
+#if defined(MYDCF77_MATCHED_FILTER) && !defined(MYDCF77_ACCUMULATOR)
+    for (byte i = 0; i < MYDCF77_TELEGRAMMLAENGE; i++) {
+        if (abs(_softBits[i]) < MYDCF77_MIN_CONFIDENCE) {
+            ok = false;
+            DEBUG_PRINT(F("Bit not confident: "));
+            DEBUG_PRINTLN(i);
+            break;
+        }
+    }
+#endif
 
-    if (_bits[0] != 0) {
-        ok = false;
-        DEBUG_PRINTLN(F("Check-bit M failed."));
-        DEBUG_FLUSH();
+    if (!ok || !decodeTelegram(_telegram, this)) {
+        // discard date...
+        set(0, 0, 0, 0, 0, 0);
+        return false;
     }
+    return true;
+}
 
-    if (_bits[20] != 1) {
+/**
+ * Ein Telegramm pruefen und decodieren (ohne die weichen Bits, auch fuer die
+ * Werkzeuge am Rechner).
+ *
+ * @param telegram Das Telegramm, Bit n ist Sekunde n.
+ * @param time Bekommt die Zeit, wenn das Telegramm gueltig ist, sonst bleibt sie.
+ * @return TRUE, wenn das Telegramm gueltig ist.
+ */
+boolean MyDCF77::decodeTelegram(uint64_t telegram, TimeStamp *time) {
+    boolean ok = true;
+
+    // M immer 0, S immer 1, genau eine Zeitzone (Z1, Z2)...
+    if (bitRead(telegram, 0) || !bitRead(telegram, 20) || (bitRead(telegram, 17) == bitRead(telegram, 18))) {
         ok = false;
-        DEBUG_PRINTLN(F("Check-bit S failed."));
-        DEBUG_FLUSH();
+        DEBUG_PRINTLN(F("Check-bits M, S, Z1/Z2 failed."));
     }
 
-    if (_bits[17] == _bits[18]) {
+    // gerade Paritaet: Minute mit P1, Stunde mit P2, Datum mit P3...
+    if (__builtin_parityll(telegram & MYDCF77_MASK(21, 28))
+            || __builtin_parityll(telegram & MYDCF77_MASK(29, 35))
+            || __builtin_parityll(telegram & MYDCF77_MASK(36, 58))) {
         ok = false;
-        DEBUG_PRINTLN(F("Check Z1 != Z2 failed."));
-        DEBUG_FLUSH();
-    }
-
-    //
-    // minutes
-    //
-    _minutes = 0;
-    c = 0;
-    for (byte i = 21; i <= 27; i++) {
-      if (_bits[i]) {
-        _minutes += _bits[i] * DCF77Factors[i-21];
-        c++;
-      } 
-    }
-    DEBUG_PRINT(F("Minutes: "));
-    DEBUG_PRINTLN(_minutes);
-    DEBUG_FLUSH();
-    if ((c + _bits[28]) % 2 != 0) {
-        ok = false;
-        DEBUG_PRINTLN(F("Check-bit P1: minutes failed."));
-        DEBUG_FLUSH();
-    }
-
-    //
-    // hour
-    //
-    _hours = 0;
-    c = 0;
-    for (byte i = 29; i <= 34; i++) {
-      if (_bits[i]) {
-        _hours += _bits[i] * DCF77Factors[i-29];
-        c++;
-      } 
-    }
-    DEBUG_PRINT(F("Hours: "));
-    DEBUG_PRINTLN(_hours);
-    DEBUG_FLUSH();
-    if ((c + _bits[35]) % 2 != 0) {
-        ok = false;
-        DEBUG_PRINTLN(F("Check-bit P2: hours failed."));
-        DEBUG_FLUSH();
-    }
-
-    //
-    // date
-    //
-    _date = 0;
-    c = 0;
-    for (byte i = 36; i <= 41; i++) {
-      if (_bits[i]) {
-        _date += _bits[i] * DCF77Factors[i-36];
-        c++;
-      } 
-    }
-    DEBUG_PRINT(F("Date: "));
-    DEBUG_PRINTLN(_date);
-    DEBUG_FLUSH();
-
-    //
-    // day of week
-    //
-    _dayOfWeek = 0;
-    for (byte i = 42; i <= 44; i++) {
-      if (_bits[i]) {
-        _dayOfWeek += _bits[i] * DCF77Factors[i-42];
-        c++;
-      } 
-    }
-    DEBUG_PRINT(F("Day of week: "));
-    DEBUG_PRINTLN(_dayOfWeek);
-    DEBUG_FLUSH();
+        DEBUG_PRINTLN(F("Check-bits P1, P2, P3 failed."));
+    }
 
-    //
-    // month
-    //
-    _month = 0;
-    for (byte i = 45; i <= 49; i++) {
-      if (_bits[i]) {
-        _month += _bits[i] * DCF77Factors[i-45];
-        c++;
-      } 
-    }
-    DEBUG_PRINT(F("Month: "));
-    DEBUG_PRINTLN(_month);
+    byte minutes = dcf77Bcd(MYDCF77_FIELD(telegram, 21, 7));
+    byte hours = dcf77Bcd(MYDCF77_FIELD(telegram, 29, 6));
+    byte date = dcf77Bcd(MYDCF77_FIELD(telegram, 36, 6));
+    byte dayOfWeek = MYDCF77_FIELD(telegram, 42, 3);
+    byte month = dcf77Bcd(MYDCF77_FIELD(telegram, 45, 5));
+    byte year = dcf77Bcd(MYDCF77_FIELD(telegram, 50, 8));
+
+    DEBUG_PRINT(F("Decoded: "));
+    DEBUG_PRINT(hours);
+    DEBUG_PRINT(F(":"));
+    DEBUG_PRINT(minutes);
+    DEBUG_PRINT(F(" "));
+    DEBUG_PRINT(date);
+    DEBUG_PRINT(F("."));
+    DEBUG_PRINT(month);
+    DEBUG_PRINT(F("."));
+    DEBUG_PRINT(year);
+    DEBUG_PRINT(F(" day of week "));
+    DEBUG_PRINTLN(dayOfWeek);
     DEBUG_FLUSH();
 
-    //
-    // year
-    //
-    _year = 0;
-    for (byte i = 50; i <= 57; i++) {
-      if (_bits[i]) {
-        _year += _bits[i] * DCF77Factors[i-50];
-        c++;
-      } 
-    }
-    DEBUG_PRINT(F("Year: "));
-    DEBUG_PRINTLN(_year);
-    DEBUG_FLUSH();
-    if ((c + _bits[58]) % 2 != 0) {
+    // ungueltige BCD-Ziffern (0xFF) fallen hier mit heraus...
+    if ((minutes > 59) || (hours > 23) || (year > 99) || (dayOfWeek == 0) || (month == 0) || (month > 12)) {
         ok = false;
-        DEBUG_PRINTLN(F("Check-bit P3: date failed."));
-        DEBUG_FLUSH();
+        DEBUG_PRINTLN(F("Time out of range."));
+    } else {
+        // Schaltjahr (2000-2099: alle 4 Jahre)...
+        byte days = pgm_read_byte_near(&dcf77DaysPerMonth[month]) + (((month == 2) && ((year & 3) == 0)) ? 1 : 0);
+        if ((date == 0) || (date > days)) {
+            ok = false;
+            DEBUG_PRINTLN(F("Date out of range."));
+        }
     }
 
-    if (_minutes > 59) {
-        DEBUG_PRINTLN(F("Minutes out of range."));
-        ok = false;
-    }
-    if (_hours > 23) {
-        DEBUG_PRINTLN(F("Hours out of range."));
-        ok = false;
-    }
-    if (_date > 31) {
-        DEBUG_PRINTLN(F("Date out of range."));
-        ok = false;
-    }
-    if (_month > 12) {
-        DEBUG_PRINTLN(F("Month out of range."));
-        ok = false;
+    if (ok) {
+        time->set(minutes, hours, date, dayOfWeek, month, year);
     }
+    return ok;
+}
 
-    if (!ok) {
-        // discard date...
-        _minutes = 0;
-        _hours = 0;
-        _date = 0;
-        _dayOfWeek = 0;
-        _month = 0;
-        _year = 0;
+/**
+ * Ein Bit des laufenden Telegramms setzen.
+ */
+void MyDCF77::setBit(byte pos, boolean value) {
+    if (value) {
+        _telegram |= (1ULL << pos);
+    } else {
+        _telegram &= ~(1ULL << pos);
     }
+}
 
-    return ok;
+/**
+ * Das laufende Telegramm (bei einer Minutenmarke) in den Ringpuffer legen.
+ */
+void MyDCF77::storeTelegram() {
+    _recentTelegrams[_recentTelegramsHead] = _telegram;
+    _recentTelegramsHead = (_recentTelegramsHead + 1) & (MYDCF77_TELEGRAM_RING - 1);
 }
 
 /*
- * Das Bits-Array loeschen.
+ * Das Telegramm loeschen.
  */
 void MyDCF77::clearBits() {
+    _telegram = 0;
+#ifdef MYDCF77_MATCHED_FILTER
     for (byte i = 0; i < MYDCF77_TELEGRAMMLAENGE; i++) {
-        _bits[i] = 0;
+        _softBits[i] = 0;
     }
+#endif
     _bitsPointer = 0;
 }
 
@@ -12,9 +12,9 @@
  * @mc       Arduino/RBBB
  * @autor    Andreas Mueller
  *           Vorlage von: Christian Aschoff / caschoff _AT_ mac _DOT_ com
- * @version  1.2
+ * @version  1.8
  * @created  21.3.2016
- * @updated  13.04.2016
+ * @updated  18.10.2026
  *
  * Versionshistorie:
  * V 1.0:   * Signalauswertealgoritmus komplett neu geschrieben! *
@@ -28,6 +28,23 @@
  * V 1.1:   - Funktion für EXT_MODE_DCF_DEBUG eingeführt.
  *          - Umschaltung von Timer1 auf Timer2 in Header-Datei möglich.
  * V 1.2:   * Die Driftkorrektur benötigt keinen Timer mehr! *
+ * V 1.3:   - Ruhige Bins der Sekunde (ohne DCF77-Impuls) für die LED-Updates (MYDCF77_QUIET_WINDOWS):
+ *            isQuietWindow(), getMillisToQuietWindow().
+ * V 1.4:   - Flanken per Interrupt mit Zeitstempel in einem Ringpuffer (MYDCF77_EDGE_CAPTURE),
+ *            die Bins bekommen dann die Dauer des Signals statt gezählter Abfragen.
+ *          - consumeEdges() hält nach einer Synchronisation an, bis poll() sie gemeldet hat
+ *            (nach einem Hänger hat die nächste Sekunde die Zeit sonst schon gelöscht).
+ * V 1.5:   - Optional Bits aus dem DCF77Demodulator (Korrelationsfilter, PLL, weiche Bits)
+ *            statt aus den Bins (MYDCF77_MATCHED_FILTER).
+ * V 1.6:   - Optional die weichen Bits über mehrere Minuten sammeln (DCF77Accumulator,
+ *            MYDCF77_ACCUMULATOR), Aussetzer und verpasste Minutenmarken werden dafür ausgeglichen.
+ * V 1.7:   - Das Telegramm als 64-Bit-Wort statt ein Byte pro Bit, dazu ein Ringpuffer der
+ *            letzten Telegramme (getTelegram()).
+ *          - decode() mit Masken, Tabelle für die BCD-Zehner und Paritäten über popcount,
+ *            der Tag wird gegen die Länge des Monats geprüft.
+ *          - Die Prüfungen ohne die weichen Bits als statisches decodeTelegram().
+ * V 1.8:   - Das rohe Signal binär über Serial aufzeichnen (DCF77Recorder, MYDCF77_RECORDER),
+ *            recordTime() für die RTC-Zeit.
  */
 #ifndef MYDCF77_H
 #define MYDCF77_H
@@ -35,6 +52,36 @@
 #include "Arduino.h"
 #include "Configuration.h"
 #include "TimeStamp.h"
+#ifdef MYDCF77_MATCHED_FILTER
+#include "DCF77Demodulator.h"
+#endif
+#ifdef MYDCF77_ACCUMULATOR
+#ifndef MYDCF77_MATCHED_FILTER
+#error "MYDCF77_ACCUMULATOR braucht MYDCF77_MATCHED_FILTER."
+#endif
+#include "DCF77Accumulator.h"
+#endif
+#ifdef MYDCF77_RECORDER
+#include "DCF77Recorder.h"
+#endif
+
+#ifdef MYDCF77_QUIET_WINDOWS
+// Alle Bins einer Sekunde als Bitmaske (MYDCF77_SIGNAL_BINS darf also hoechstens 31 sein).
+#define MYDCF77_ALL_BINS ((1UL << MYDCF77_SIGNAL_BINS) - 1)
+// So viele Bins kann ein 200ms-Impuls belegen (er beginnt bis zu 3/4 Bin nach dem Anfang seines ersten Bins).
+#define MYDCF77_QUIET_PULSE_BINS ((200000UL * MYDCF77_SIGNAL_BINS + 750000UL + 999999UL) / 1000000UL)
+#endif
+
+// Die letzten Telegramme (Zweierpotenz).
+#define MYDCF77_TELEGRAM_RING 4
+
+#ifdef MYDCF77_EDGE_CAPTURE
+#ifdef MYDCF77_SIGNAL_IS_ANALOG
+#error "MYDCF77_EDGE_CAPTURE braucht einen digitalen Pin."
+#endif
+// Die Dauer des Signals zählt in Einheiten von 64us (eine Sekunde sind 15625, passt in unsigned int).
+#define MYDCF77_EDGE_UNIT_SHIFT 6
+#endif
 
 class MyDCF77 : public TimeStamp {
 
@@ -49,25 +96,98 @@ public:
     void setDcf77SuccessSync();
 
     byte getBitAtPos(byte pos);
+    uint64_t getTelegram(byte age);
+#ifdef MYDCF77_MATCHED_FILTER
+    int8_t getSoftBitAtPos(byte pos);
+#endif
     byte getDcf77ErrorCorner(boolean signalIsInverted);
 
     boolean signal(boolean signalIsInverted);
 
+    static boolean decodeTelegram(uint64_t telegram, TimeStamp *time);
+
+#ifdef MYDCF77_QUIET_WINDOWS
+    boolean isQuietWindow();
+    unsigned int getMillisToQuietWindow();
+#endif
+
+#ifdef MYDCF77_RECORDER
+    void recordTime(TimeStamp *rtc, byte seconds);
+#endif
+
+#ifdef MYDCF77_EDGE_CAPTURE
+    void captureEdge();
+    boolean pushEdge(unsigned long time, boolean level);
+    byte getDroppedEdges();
+#endif
+
 private:
     byte _signalPin;
     byte _statusLedPin;
     unsigned int _nPolls = 0;
 
-    static byte DCF77Factors[];
-
     byte _bitsPointer;
-    byte _bits[MYDCF77_TELEGRAMMLAENGE+1];
+    // Das laufende Telegramm: Bit n ist Sekunde n.
+    uint64_t _telegram;
+    // Die Telegramme der letzten Minutenmarken, _recentTelegramsHead zeigt auf das nächste.
+    uint64_t _recentTelegrams[MYDCF77_TELEGRAM_RING];
+    byte _recentTelegramsHead = 0;
     
     unsigned int _bins[MYDCF77_SIGNAL_BINS];
     int _binsPointer = 0;
     int _binsOffset = 0;
     byte _driftTimer = 0;
 
+#ifdef MYDCF77_QUIET_WINDOWS
+    // Ein Bit pro Bin: 1 = kein Impuls in der letzten Sekunde, hier darf das Display schreiben.
+    unsigned long _quietBins = MYDCF77_ALL_BINS;
+#endif
+
+#ifdef MYDCF77_EDGE_CAPTURE
+    // Ringpuffer der Flanken: Zeitstempel (micros()), Bit 0 ist der Pegel nach der Flanke.
+    // Nur die Interrupt-Routine schreibt _edgeHead, nur poll() schreibt _edgeTail.
+    volatile unsigned long _edges[MYDCF77_EDGE_BUFFER];
+    volatile byte _edgeHead = 0;
+    volatile byte _edgeTail = 0;
+    volatile byte _droppedEdges = 0;
+    // Der Pegel der letzten aufgezeichneten Flanke (Interrupt-Seite).
+    volatile boolean _captureLevel;
+    // Der Pegel und Zeitpunkt, bis zu dem die Bins gefüllt sind (poll()-Seite).
+    boolean _edgeLevel;
+    unsigned long _integratedTo;
+#endif
+
+#ifdef MYDCF77_MATCHED_FILTER
+    DCF77Demodulator _demodulator;
+    // Die weichen Bits zu _telegram: -127 (sicher 0) bis +127 (sicher 1).
+    int8_t _softBits[MYDCF77_TELEGRAMMLAENGE+1];
+    // Der laufende 10ms-Slot: Beginn, Zeit (Flanken) bzw. Abfragen mit Signal, Abfragen.
+    unsigned long _slotStart;
+    unsigned int _slotHigh = 0;
+    unsigned int _slotPolls = 0;
+#ifndef MYDCF77_EDGE_CAPTURE
+    // Die letzte Abfrage, für Slots ohne Abfrage.
+    boolean _lastSample = false;
+    unsigned long _lastSampleTime;
+#endif
+#endif
+
+#ifdef MYDCF77_ACCUMULATOR
+    DCF77Accumulator _accumulator;
+    // Die Bits zählen ab einer Minutenmarke (erst dann stimmen die Positionen).
+    boolean _minuteSynced = false;
+    // Die letzte Sekunde war eine verpasste Minutenmarke (oder eine Schaltsekunde).
+    boolean _forcedMark = false;
+    // Die letzte Minutenmarke war eine verpasste, und wo in der Minute eine Marke stattdessen kam.
+    boolean _missedMark = false;
+    byte _misplacedMark = 0xFF;
+#endif
+
+#ifdef MYDCF77_RECORDER
+    DCF77Recorder _recorder;
+#endif
+
+    // Ohne MYDCF77_MATCHED_FILTER in Bins, mit in Slots des DCF77Demodulator.
     int _updateFromDCF77 = -1;
 
     unsigned long _dcf77LastTime;
@@ -82,8 +202,30 @@ private:
 
     boolean decode();
 
+    void setBit(byte pos, boolean value);
+    void storeTelegram();
     void clearBits();
     void clearBins();
+
+#ifdef MYDCF77_EDGE_CAPTURE
+    void consumeEdges(boolean signalIsInverted);
+    void integrateSignal(unsigned long until, boolean high);
+#endif
+
+#ifdef MYDCF77_MATCHED_FILTER
+#ifdef MYDCF77_EDGE_CAPTURE
+    void integrateSlots(unsigned long until, boolean high);
+#else
+    void sampleSlot(boolean high);
+#endif
+    void feedSlot(byte level);
+#endif
+
+#ifdef MYDCF77_QUIET_WINDOWS
+    void updateQuietBins(unsigned int imax);
+    void shiftQuietBins(int offset);
+    boolean isQuietBin(int bin);
+#endif
 };
 
 #endif
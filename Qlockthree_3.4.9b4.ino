@@ -210,6 +210,22 @@
  *                          lässt sich wie folgt umschreiben:
  *                  millis() - _lastPressTime > BUTTON_TRESHOLD  // <-- Jetzt spielt der Überlauf von millis() keine Rolle mehr, weil nur Differenz (zwischen zwei unsigned Variablen) betrachtet wird.
  *          - Fehler in der Nachtschaltung behoben, der das Aufwecken der Uhr verhindert hat.
+ * V 3.4.9b5- Render-Cache (RenderCache): In STD_MODE_NORMAL, EXT_MODE_TIMESET und STD_MODE_ALARM wird der Bildspeicher nur noch neu beschrieben
+ *            und an die LEDs geschickt, wenn sich das Bild geaendert hat (also einmal pro Minute), nicht mehr jede Sekunde.
+ *          - Optionale, nicht blockierende Uebergaenge beim Minutenwechsel (TRANSITION_EFFECT in Configuration.h).
+ *            Die Dauer der Schritte wird im DEBUG-Modus mit den FPS ausgegeben.
+ *          - Optionale eigene Farbe fuer die Stunden-Woerter (LED_DRIVER_PALETTE in Configuration.h).
+ *            Mit TRANSITION_EFFECT wechseln die Farbplaetze mit den Pixeln des Uebergangs (setPaletteSlots()),
+ *            die alten Woerter behalten ihre Farbe, bis sie verschwinden.
+ *          - Optionaler, nicht blockierender Lauftext (TextScroller), z.B. "SYNC OK" nach dem ersten DCF77-Empfang und nach
+ *            einem verlorenen Empfang (TEXT_SCROLLER und TEXT_SCROLLER_SYNC_LOST_MINUTES in Configuration.h).
+ *          - Staben.h, Zahlen.h und ZahlenKlein.h durch den gemeinsamen Zeichen-Atlas Schriften.h ersetzt, alle write*-Funktionen
+ *            nutzen Renderer::writeChar().
+ *          - Optional gehen geaenderte Bilder nur in den ruhigen Bins der Sekunde (ausserhalb des DCF77-Impulses)
+ *            an die LEDs (MYDCF77_QUIET_WINDOWS in Configuration.h), die wartenden Bilder werden gezaehlt.
+ *          - Mit SHIFTREGISTER_SPI haengen die Shift-Register an MOSI, SCK und SS, der Lautsprecher beim
+ *            LED_DRIVER_DEFAULT an A2.
+ *          - Mit MYDCF77_RECORDER entfallen die Startmeldungen, die Aufzeichnung geht auf MYDCF77_RECORDER_SERIAL.
  */
 #include <Wire.h> // Wire library fuer I2C
 #include <avr/pgmspace.h>
@@ -242,11 +258,11 @@
 #include "LDR.h"
 #include "DCF77Helper.h"
 #include "Renderer.h"
-#include "Staben.h"
+#include "RenderCache.h"
+#include "Transition.h"
+#include "TextScroller.h"
 #include "Alarm.h"
 #include "Settings.h"
-#include "Zahlen.h"
-#include "ZahlenKlein.h"
 #ifdef EVENTDAY
     #include "Ereignisse.h"
 #endif
@@ -290,6 +306,24 @@ Settings settings;
  */
 Renderer renderer;
 
+#ifdef TRANSITION_EFFECT
+/**
+ * Die Uebergaenge beim Minutenwechsel (siehe TRANSITION_EFFECT in Configuration.h).
+ */
+Transition transition;
+#endif
+
+#ifdef TEXT_SCROLLER
+/**
+ * Der Lauftext (siehe TEXT_SCROLLER in Configuration.h).
+ */
+TextScroller textScroller;
+
+// Gab es seit dem Einschalten schon einen erfolgreichen DCF77-Empfang, und wann war der letzte?
+boolean dcf77Synced = false;
+unsigned long dcf77LastSyncMillis;
+#endif
+
 /**
  * Der LED-Treiber fuer 74HC595-Shift-Register. Verwendet
  * von der Drei-Lochraster-Platinen-Version und dem
@@ -297,9 +331,15 @@ Renderer renderer;
  *
  * Data: 10; Clock: 12; Latch: 11; OutputEnable: 3
  * LinesToWrite: 10
+ * Mit SHIFTREGISTER_SPI: Data: 11 (MOSI); Clock: 13 (SCK); Latch: 10 (SS);
+ * der Lautsprecher wandert auf A2 (siehe Configuration.h).
  */
 #ifdef LED_DRIVER_DEFAULT
+#ifdef SHIFTREGISTER_SPI
+LedDriverDefault ledDriver(MOSI, SCK, SS, 3, 10);
+#else
 LedDriverDefault ledDriver(10, 12, 11, 3, 10);
+#endif
 
 #define PIN_MODE 7
 #define PIN_M_PLUS 5
@@ -320,8 +360,12 @@ LedDriverDefault ledDriver(10, 12, 11, 3, 10);
 #define PIN_SQW_LED 4
 #define PIN_DCF77_LED 8
 
+#ifdef SHIFTREGISTER_SPI
+#define PIN_SPEAKER A2
+#else
 #define PIN_SPEAKER 13
 #endif
+#endif
 
 /**
  * Der LED-Treiber fuer 4 MAX7219-Treiber wie im Ueberpixel.
@@ -355,9 +399,14 @@ LedDriverUeberPixel ledDriver(5, 6, 7);
 /**
  * Der LED-Treiber fuer Power-Shift-Register.
  * Data: 10; Clock: 11; Load: 12
+ * Mit SHIFTREGISTER_SPI: Data: 11 (MOSI); Clock: 13 (SCK); Latch: 10 (SS).
  */
 #ifdef LED_DRIVER_POWER_SHIFT_REGISTER
+#ifdef SHIFTREGISTER_SPI
+LedDriverPowerShiftRegister ledDriver(MOSI, SCK, SS, 3);
+#else
 LedDriverPowerShiftRegister ledDriver(10, 12, 11, 3);
+#endif
 
 #define PIN_MODE 7
 #define PIN_M_PLUS 5
@@ -517,6 +566,11 @@ MyRTC rtc(0x68, PIN_SQW_LED);
 
 volatile byte helperSeconds;
 
+#ifdef MYDCF77_RECORDER
+// Die RTC-Zeit ist in dieser Minute schon aufgezeichnet.
+boolean dcf77TimeRecorded = false;
+#endif
+
 /**
  * Der Funkempfaenger (DCF77-Signal der PTB Braunschweig).
  */
@@ -618,6 +672,21 @@ word matrix[16];
 // Hilfsvariable, da I2C und Interrupts nicht zusammenspielen
 volatile boolean needsUpdateFromRtc = true;
 
+// Render-Cache: das, was im Bildspeicher steht (siehe renderCacheHit()).
+RenderCache renderCache;
+
+#ifdef LED_DRIVER_PALETTE
+// Die Stunden-Woerter im Bildspeicher (fuer PALETTE_SLOT_HOURS, siehe setPaletteSlots()).
+word hourMatrix[16];
+#endif
+
+#ifdef MYDCF77_QUIET_WINDOWS
+// Ein geaendertes Bild, das noch auf einen ruhigen Bin wartet (siehe writeScreenBuffer()).
+boolean deferredFrame = false;
+// Wie viele geaenderte Bilder mussten auf einen ruhigen Bin warten?
+unsigned long deferredFrames = 0;
+#endif
+
 // Fuer den Bildschirm-Test
 byte x, y;
 
@@ -751,7 +820,12 @@ int freeRam() {
  */
 void setup() {
     Serial.begin(SERIAL_SPEED);
+#ifdef MYDCF77_RECORDER
+    // die Aufzeichnung kommt ohne Startmeldungen...
+    MYDCF77_RECORDER_SERIAL.begin(SERIAL_SPEED);
+#else
     Serial.println(F("Qlockthree is initializing..."));
+#endif
     DEBUG_PRINTLN(F("... and starting in debug-mode..."));
     Serial.flush();
 
@@ -760,6 +834,9 @@ void setup() {
 
     // LED-Treiber initialisieren
     ledDriver.init();
+#ifdef LED_DRIVER_PALETTE
+    ledDriver.setPaletteColor(PALETTE_SLOT_HOURS, PALETTE_HOURS_RED, PALETTE_HOURS_GREEN, PALETTE_HOURS_BLUE);
+#endif
     // Inhalt des Led-Treibers loeschen...
     ledDriver.clearData();
     // und Inhalt des Bildspeichers loeschen
@@ -789,10 +866,12 @@ void setup() {
         delay(100);
     }
 
+#ifndef MYDCF77_RECORDER
     Serial.print(F("Compiled: "));
     Serial.print(F(__TIME__));
     Serial.print(F(" / "));
     Serial.println(F(__DATE__));
+#endif
 
     /*
     // Uhrzeit nach Compile-Zeit stellen...
@@ -810,13 +889,19 @@ void setup() {
     }
 
 #ifdef DS1307
+#ifndef MYDCF77_RECORDER
     Serial.println(F("Uhrentyp ist DS1307."));
+#endif
     rtc.enableSQWOnDS1307();
 #elif defined DS3231
+#ifndef MYDCF77_RECORDER
     Serial.println(F("Uhrentyp ist DS3231."));
+#endif
     rtc.enableSQWOnDS3231();
 #elif defined TEENSYRTC
+#ifndef MYDCF77_RECORDER
     Serial.println(F("Uhrentyp ist Teensy RTC (Freescale MK20)"));
+#endif
 #else
     Definition_des_Uhrtyps_fehlt!
     In der Configuration.h muss der Uhrentyp angegeben werden!
@@ -824,6 +909,7 @@ void setup() {
 
     rtc.writeTime();
     helperSeconds = rtc.getSeconds();
+#ifndef MYDCF77_RECORDER
     Serial.print(F("RTC-Time: "));
     Serial.print(rtc.getHours());
     Serial.print(F(":"));
@@ -836,6 +922,7 @@ void setup() {
     Serial.print(rtc.getMonth());
     Serial.print(F("."));
     Serial.println(rtc.getYear());
+#endif
 
     // Den Interrupt konfigurieren,
     // nicht mehr CHANGE, das sind 2 pro Sekunde,
@@ -847,8 +934,11 @@ void setup() {
    // an einem externen pin geniert. Deshalb normaler Software Timer
    // IntervalTimer ist hochpräziser Timer, Eigentlich unnötig
    rtcTimer.priority(255);
-   if(!rtcTimer.begin(updateFromRtc, 1*1000*1000))
+   if(!rtcTimer.begin(updateFromRtc, 1*1000*1000)) {
+#ifndef MYDCF77_RECORDER
        Serial.printf("Failed to set teensy timer\n");
+#endif
+   }
 #else
     attachInterrupt(0, updateFromRtc, FALLING);
 #endif
@@ -873,6 +963,11 @@ void setup() {
         delay(100);
     }
 
+#ifndef REMOTE_NO_REMOTE
+    irrecv.enableIRIn();
+#endif
+
+#ifndef MYDCF77_RECORDER
     // ein paar Infos ausgeben
     Serial.println(F("... done and ready to rock!"));
 
@@ -885,7 +980,6 @@ void setup() {
 #ifndef REMOTE_NO_REMOTE
     Serial.print(F("Remote: "));
     irTranslator.printSignature();
-    irrecv.enableIRIn();
 #else
     Serial.print(F("Remote: disabled."));
 #endif
@@ -903,6 +997,7 @@ void setup() {
     Serial.println(F(" bytes."));
 
     Serial.flush();
+#endif
 
     // DCF77-Empfaenger einschalten...
     enableDcf(true);
@@ -914,10 +1009,13 @@ void setup() {
 /*
  * Schreibroutinen für Buchstaben und Zahlen
  */
+/**
+ * Die write*-Funktionen geben Zeichen aus dem Zeichen-Atlas aus (Renderer::writeChar()).
+ * posx ist dabei wie frueher die Verschiebung der rechten Spalte des Zeichens (Bit posx),
+ * die linke Spalte ist also 16 - posx - Breite.
+ */
 void write1xyStab(char char1, byte posx, byte posy) {
-    for (byte i = 0; i < 5; i++) {
-        matrix[posy + i] |= pgm_read_byte_near(&(staben[char1 - 'A'][i])) << posx;
-    }
+    renderer.writeChar(SCHRIFT_STABEN, char1, 11 - posx, posy, matrix);
 }
 
 void write2yStaben(char char1, char char2, byte posy) {
@@ -935,9 +1033,7 @@ void write4Staben(char char1, char char2, char char3, char char4) {
 }
 
 void write1xyDigit(byte number, byte posx, byte posy) {
-    for (byte i = 0; i < 7; i++) {
-        matrix[posy + i] |= pgm_read_byte_near(&(ziffern[number][i])) << posx;
-    }
+    renderer.writeChar(SCHRIFT_ZIFFERN, '0' + number, 11 - posx, posy, matrix);
 }
 
 void write2yDigits(byte number, byte posy) {
@@ -946,12 +1042,10 @@ void write2yDigits(byte number, byte posy) {
 }
 
 void write4SmallDigits(byte firstNumber, byte secondNumber) {
-    for (byte i = 0; i < 5; i++) {            
-        matrix[0 + i] |= pgm_read_byte_near(&(ziffernKlein[firstNumber / 10][i])) << 12;
-        matrix[0 + i] |= pgm_read_byte_near(&(ziffernKlein[firstNumber % 10][i])) << 7;
-        matrix[5 + i] |= pgm_read_byte_near(&(ziffernKlein[secondNumber / 10][i])) << 12;
-        matrix[5 + i] |= pgm_read_byte_near(&(ziffernKlein[secondNumber % 10][i])) << 7;
-    }
+    renderer.writeChar(SCHRIFT_ZIFFERN_KLEIN, '0' + firstNumber / 10, 0, 0, matrix);
+    renderer.writeChar(SCHRIFT_ZIFFERN_KLEIN, '0' + firstNumber % 10, 5, 0, matrix);
+    renderer.writeChar(SCHRIFT_ZIFFERN_KLEIN, '0' + secondNumber / 10, 0, 5, matrix);
+    renderer.writeChar(SCHRIFT_ZIFFERN_KLEIN, '0' + secondNumber % 10, 5, 5, matrix);
 }
 
 #ifdef EVENTDAY
@@ -962,6 +1056,85 @@ void write4SmallDigits(byte firstNumber, byte secondNumber) {
     }
 #endif
 
+#ifdef LED_DRIVER_PALETTE
+/**
+ * Farbplaetze verteilen: alles in der normalen Farbe, die Stunden-Woerter
+ * (hourMatrix) in PALETTE_SLOT_HOURS. Waehrend eines Uebergangs kommen die
+ * Stunden-Woerter aus der Transition, passend zum Zwischenbild.
+ */
+void setPaletteSlots() {
+    ledDriver.setPaletteSlotForScreenBuffer(matrix, 0);
+#ifdef TRANSITION_EFFECT
+    if (transition.isRunning()) {
+        word slotMask[16];
+        transition.getSlotMask(slotMask);
+        ledDriver.setPaletteSlotForScreenBuffer(slotMask, PALETTE_SLOT_HOURS);
+        return;
+    }
+#endif
+    ledDriver.setPaletteSlotForScreenBuffer(hourMatrix, PALETTE_SLOT_HOURS);
+}
+#endif
+
+/**
+ * Den Bildspeicher an den LED-Treiber geben.
+ * Mit MYDCF77_QUIET_WINDOWS warten geaenderte Bilder, bis MyDCF77 einen
+ * ruhigen Bin meldet, damit die Updates nicht auf dem DCF77-Impuls landen.
+ * Der LedDriverDefault multiplext weiter, ausser mit MYDCF77_QUIET_SUSPEND_MULTIPLEXING
+ * (mit LED_DRIVER_DEFAULT_TIMER multiplext immer der Interrupt, das geht also nicht zusammen).
+ *
+ * @param onChange TRUE, wenn sich der Bildspeicher geaendert hat.
+ */
+void writeScreenBuffer(boolean onChange) {
+#ifdef MYDCF77_QUIET_WINDOWS
+    if (!dcf77.isQuietWindow()) {
+        if (onChange && !deferredFrame) {
+            deferredFrame = true;
+            deferredFrames++;
+        }
+#if defined(LED_DRIVER_DEFAULT) && !defined(MYDCF77_QUIET_SUSPEND_MULTIPLEXING)
+        ledDriver.writeScreenBufferToMatrix(matrix, false);
+#endif
+        return;
+    }
+    if (deferredFrame) {
+        // jetzt ist es ruhig, also das wartende Bild schreiben...
+        deferredFrame = false;
+        onChange = true;
+    }
+#endif
+    ledDriver.writeScreenBufferToMatrix(matrix, onChange);
+}
+
+/**
+ * Render-Cache pruefen.
+ * Im STD_MODE_NORMAL, EXT_MODE_TIMESET und STD_MODE_ALARM (ohne blinkende Alarmzeit)
+ * aendert sich das Bild nur einmal pro Minute. Steht das Bild schon im Bildspeicher,
+ * muss weder gerendert noch an die LEDs geschickt werden. Das spart bei den
+ * LED-Stripes 59 von 60 show()-Aufrufen und damit auch Stoerungen beim DCF77-Empfang.
+ *
+ * @return TRUE, wenn das Bild fuer die aktuelle Zeit, Sprache, Eck-LED-Richtung,
+ *         Alarm-LED und den aktuellen Modus schon im Bildspeicher steht.
+ */
+boolean renderCacheHit() {
+    byte alarmLed;
+    switch (mode) {
+        case STD_MODE_NORMAL:
+        case EXT_MODE_TIMESET:
+            alarmLed = RENDER_CACHE_ALARM_OFF;
+            break;
+        case STD_MODE_ALARM:
+            alarmLed = (alarm.getShowAlarmTimeTimer() == 0) ? RENDER_CACHE_ALARM_ON : RENDER_CACHE_ALARM_BLINKING;
+            break;
+        default:
+            renderCache.invalidate();
+            return false;
+    }
+
+    return renderCache.hit(mode, rtc.getHours() + settings.getTimeShift(), rtc.getMinutes(), settings.getLanguage(),
+                           settings.getRenderCornersCw(), alarmLed);
+}
+
 /**
  * loop() wird endlos auf alle Ewigkeit vom Microcontroller durchlaufen
  */
@@ -982,6 +1155,22 @@ void loop() {
     if (millis() - lastFpsCheck > 1000) {
         DEBUG_PRINT("FPS: ");
         DEBUG_PRINTLN(frames);
+#ifdef TRANSITION_EFFECT
+        DEBUG_PRINT(F("Transition max. step (us): "));
+        DEBUG_PRINTLN(transition.getMaxStepMicros());
+        transition.resetMaxStepMicros();
+#endif
+#ifdef TEXT_SCROLLER
+        DEBUG_PRINT(F("TextScroller max. column (us): "));
+        DEBUG_PRINTLN(textScroller.getMaxStepMicros());
+        textScroller.resetMaxStepMicros();
+#endif
+#ifdef MYDCF77_QUIET_WINDOWS
+        DEBUG_PRINT(F("Deferred frames: "));
+        DEBUG_PRINT(deferredFrames);
+        DEBUG_PRINT(F(", next quiet window (ms): "));
+        DEBUG_PRINTLN(dcf77.getMillisToQuietWindow());
+#endif
         lastFpsCheck = millis();
         frames = 0;
     }
@@ -1077,10 +1266,41 @@ void loop() {
         #endif  
 
         //
-        // Bildschirmpuffer beschreiben...
+        // Bildschirmpuffer beschreiben, falls das Bild nicht schon drin steht (Render-Cache)...
         //
-        renderer.clearScreenBuffer(matrix);
-        switch (mode) {
+#ifdef TRANSITION_EFFECT
+        byte lastRenderCacheMode = renderCache.getMode();
+#endif
+#ifdef TEXT_SCROLLER
+        // waehrend ein Lauftext laeuft, gehoert ihm die Anzeige...
+        boolean render = !textScroller.isRunning() && !renderCacheHit();
+#else
+        boolean render = !renderCacheHit();
+#endif
+#ifdef TRANSITION_EFFECT
+        // Minutenwechsel in der normalen Zeitanzeige? Dann das alte Bild fuer den Uebergang merken...
+        word lastMatrix[16];
+        boolean startTransition = render && (mode == STD_MODE_NORMAL) && (lastRenderCacheMode == STD_MODE_NORMAL);
+        if (render) {
+            transition.cancel();
+        }
+#ifdef LED_DRIVER_PALETTE
+        word lastHourMatrix[16];
+#endif
+        if (startTransition) {
+            for (byte i = 0; i < 16; i++) {
+                lastMatrix[i] = matrix[i];
+#ifdef LED_DRIVER_PALETTE
+                lastHourMatrix[i] = hourMatrix[i];
+#endif
+            }
+        }
+#endif
+        if (render) {
+            renderer.clearScreenBuffer(matrix);
+        }
+        // bei einem Treffer im Render-Cache passt kein case...
+        switch (render ? mode : RENDER_CACHE_INVALID) {
             case STD_MODE_NORMAL:
             case EXT_MODE_TIMESET:
                 renderer.setMinutes(rtc.getHours() + settings.getTimeShift(), rtc.getMinutes(), settings.getLanguage(), matrix);
@@ -1303,10 +1523,71 @@ void loop() {
                 break;
         }
 
-        // Update mit onChange = true, weil sich hier (aufgrund needsUpdateFromRtc) immer was geaendert hat.
-        // Entweder weil wir eine Sekunde weiter sind, oder weil eine Taste gedrueckt wurde.
-        ledDriver.writeScreenBufferToMatrix(matrix, true);
+        if (render) {
+#ifdef LED_DRIVER_PALETTE
+            // in der Zeitanzeige die Stunden-Woerter fuer PALETTE_SLOT_HOURS...
+            renderer.clearScreenBuffer(hourMatrix);
+            if ((mode == STD_MODE_NORMAL) || (mode == EXT_MODE_TIMESET)) {
+                renderer.setHours(rtc.getHours() + settings.getTimeShift(), rtc.getMinutes(), settings.getLanguage(), hourMatrix);
+            }
+#endif
+
+#ifdef TRANSITION_EFFECT
+            if (startTransition) {
+                // Uebergang starten, der erste Schritt kommt sofort...
+                transition.begin(lastMatrix, matrix, TRANSITION_EFFECT);
+#ifdef LED_DRIVER_PALETTE
+                // die Farbplaetze wechseln mit den Pixeln, nicht schon vor dem Uebergang...
+                transition.setSlotMasks(lastHourMatrix, hourMatrix);
+#endif
+                transition.step(matrix);
+            }
+#endif
+
+#ifdef LED_DRIVER_PALETTE
+            setPaletteSlots();
+#endif
+
+            // Update mit onChange = true, weil sich hier (aufgrund needsUpdateFromRtc) immer was geaendert hat.
+            // Entweder weil wir eine Sekunde weiter sind, oder weil eine Taste gedrueckt wurde.
+            writeScreenBuffer(true);
+        }
+    }
+
+#ifdef TRANSITION_EFFECT
+    //
+    // Laufenden Uebergang weiterschalten. Pro Aufruf hoechstens ein Schritt,
+    // getaktet mit TRANSITION_STEP_MILLIS, damit loop() (und dcf77.poll()) nicht blockiert.
+    //
+    if (transition.isRunning()) {
+        if (mode != STD_MODE_NORMAL) {
+            transition.cancel();
+        } else if (transition.step(matrix)) {
+#ifdef LED_DRIVER_PALETTE
+            setPaletteSlots();
+#endif
+            writeScreenBuffer(true);
+        }
+    }
+#endif
+
+#ifdef TEXT_SCROLLER
+    //
+    // Laufenden Lauftext um eine Spalte weiterschieben (getaktet mit TEXT_SCROLLER_COLUMN_MILLIS).
+    //
+    if (textScroller.isRunning()) {
+        if (mode != STD_MODE_NORMAL) {
+            textScroller.cancel();
+        } else if (textScroller.step(matrix)) {
+            writeScreenBuffer(true);
+        }
+        if (!textScroller.isRunning()) {
+            // fertig oder abgebrochen, also wieder die Zeit anzeigen...
+            renderCache.invalidate();
+            needsUpdateFromRtc = true;
+        }
     }
+#endif
 
     /*
      *
@@ -1382,6 +1663,7 @@ void loop() {
                 break;
             case REMOTE_BUTTON_SETCOLOR:
                 ledDriver.setColor(irTranslator.getRed(), irTranslator.getGreen(), irTranslator.getBlue());
+                renderCache.invalidate();
                 break;
         }
         irrecv.resume();
@@ -1419,7 +1701,7 @@ void loop() {
      *
      */
     if ((mode != STD_MODE_BLANK) && (mode != STD_MODE_NIGHT)) {
-        ledDriver.writeScreenBufferToMatrix(matrix, false);
+        writeScreenBuffer(false);
     }
 
     /*
@@ -1439,6 +1721,18 @@ void loop() {
      * DCF77-Empfaenger anticken...
      *
      */
+#ifdef MYDCF77_RECORDER
+    // einmal pro Minute die RTC-Zeit in die Aufzeichnung (fuer den DCF77Helper beim Abspielen)...
+    if (helperSeconds == 0) {
+        if (!dcf77TimeRecorded) {
+            rtc.readTime();
+            dcf77.recordTime(&rtc, rtc.getSeconds());
+            dcf77TimeRecorded = true;
+        }
+    } else {
+        dcf77TimeRecorded = false;
+    }
+#endif
     if (dcf77.poll(settings.getDcfSignalIsInverted()))
       manageNewDCF77Data();
 }
@@ -1756,10 +2050,16 @@ void manageNewDCF77Data() {
     DEBUG_FLUSH();
 
     rtc.readTime();
+#ifdef MYDCF77_ACCUMULATOR
+    // das Telegramm ist schon ueber mehrere Minuten abgesichert (DCF77Accumulator)...
+    boolean samplesOk = true;
+#else
     dcf77Helper.addSample(&dcf77, &rtc);
     // Stimmen die Abstaende im Array?
     // Pruefung mit Datum!
-    if (dcf77Helper.samplesOk()) {
+    boolean samplesOk = dcf77Helper.samplesOk();
+#endif
+    if (samplesOk) {
         helperSeconds = 0;
         rtc.setSeconds(0);
         rtc.set(&dcf77);
@@ -1769,6 +2069,19 @@ void manageNewDCF77Data() {
         #ifdef DCF77_SHOW_TIME_SINCE_LAST_SYNC
             dcf77.setDcf77SuccessSync();
         #endif
+        #ifdef TEXT_SCROLLER
+            // "SYNC OK" nur beim ersten Empfang und wenn der Empfang verloren war, nicht jede Minute...
+            boolean syncLost = !dcf77Synced || (millis() - dcf77LastSyncMillis > TEXT_SCROLLER_SYNC_LOST_MINUTES * 60000UL);
+            dcf77Synced = true;
+            dcf77LastSyncMillis = millis();
+            if (syncLost && (mode == STD_MODE_NORMAL)) {
+                #ifdef TRANSITION_EFFECT
+                    transition.cancel();
+                #endif
+                renderer.clearScreenBuffer(matrix);
+                textScroller.begin("SYNC OK", 2, false, false);
+            }
+        #endif
         #ifdef AUTO_JUMP_BLANK
             // falls im manuellen Dunkel-Modus, Display wieder einschalten... (Hilft bei der Erkennung, ob der DCF-Empfang geklappt hat).
             if (mode == STD_MODE_BLANK) {
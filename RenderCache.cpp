@@ -0,0 +1,82 @@
+/**
+ * RenderCache
+ * Merkt sich, fuer welchen Schluessel (Modus, Stunden mit Zeitverschiebung,
+ * Minuten, Sprache, Eck-LED-Richtung und Alarm-LED) das Bild im Bildspeicher
+ * steht. Ist der Schluessel gleich, muss loop() weder rendern noch das Bild an
+ * die LEDs schicken.
+ *
+ * Welche Modi gecacht werden, entscheidet der Sketch (renderCacheHit()). Eine
+ * blinkende Alarmzeit (RENDER_CACHE_ALARM_BLINKING) aendert sich jede Sekunde
+ * und wird nie gecacht. Aendert sich etwas, das nicht im Schluessel steht
+ * (z.B. die Farbe), muss der Sketch invalidate() aufrufen.
+ *
+ * @mc       Arduino/RBBB
+ * @autor    agent / agent _AT_ local
+ *           Vorlage von: Christian Aschoff / caschoff _AT_ mac _DOT_ com
+ * @version  1.0
+ * @created  18.10.2026
+ *
+ * Versionshistorie:
+ * V 1.0:  - Erstellt.
+ */
+#include "RenderCache.h"
+
+// #define DEBUG
+#include "Debug.h"
+
+/**
+ * Initialisierung, im Bildspeicher steht noch nichts.
+ */
+RenderCache::RenderCache() {
+    _mode = RENDER_CACHE_INVALID;
+}
+
+/**
+ * Steht das Bild fuer diesen Schluessel schon im Bildspeicher? Wenn nicht,
+ * merkt sich der Cache den Schluessel, der Aufrufer muss das Bild dann
+ * neu schreiben.
+ *
+ * @param mode Der Modus des Sketches.
+ * @param hours Die Stunden (mit Zeitverschiebung).
+ * @param minutes Die Minuten.
+ * @param language Die Sprache.
+ * @param cornersCw Die Richtung der Eck-LEDs.
+ * @param alarmLed RENDER_CACHE_ALARM_OFF, _ON oder _BLINKING.
+ * @return TRUE, wenn das Bild schon im Bildspeicher steht.
+ */
+boolean RenderCache::hit(byte mode, char hours, byte minutes, byte language, boolean cornersCw, byte alarmLed) {
+    if (alarmLed == RENDER_CACHE_ALARM_BLINKING) {
+        // die Alarmzeit blinkt, also nicht cachen...
+        invalidate();
+        return false;
+    }
+
+    if ((_mode == mode) && (_hours == hours) && (_minutes == minutes)
+            && (_language == language) && (_cornersCw == cornersCw) && (_alarmLed == alarmLed)) {
+        return true;
+    }
+
+    _mode = mode;
+    _hours = hours;
+    _minutes = minutes;
+    _language = language;
+    _cornersCw = cornersCw;
+    _alarmLed = alarmLed;
+    return false;
+}
+
+/**
+ * Der Bildspeicher muss beim naechsten hit() neu beschrieben werden.
+ */
+void RenderCache::invalidate() {
+    _mode = RENDER_CACHE_INVALID;
+}
+
+/**
+ * Der Modus, fuer den das Bild im Bildspeicher steht.
+ *
+ * @return Der Modus oder RENDER_CACHE_INVALID.
+ */
+byte RenderCache::getMode() {
+    return _mode;
+}
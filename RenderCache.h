@@ -0,0 +1,53 @@
+/**
+ * RenderCache
+ * Merkt sich, fuer welchen Schluessel (Modus, Stunden mit Zeitverschiebung,
+ * Minuten, Sprache, Eck-LED-Richtung und Alarm-LED) das Bild im Bildspeicher
+ * steht. Ist der Schluessel gleich, muss loop() weder rendern noch das Bild an
+ * die LEDs schicken.
+ *
+ * Welche Modi gecacht werden, entscheidet der Sketch (renderCacheHit()). Eine
+ * blinkende Alarmzeit (RENDER_CACHE_ALARM_BLINKING) aendert sich jede Sekunde
+ * und wird nie gecacht. Aendert sich etwas, das nicht im Schluessel steht
+ * (z.B. die Farbe), muss der Sketch invalidate() aufrufen.
+ *
+ * @mc       Arduino/RBBB
+ * @autor    agent / agent _AT_ local
+ *           Vorlage von: Christian Aschoff / caschoff _AT_ mac _DOT_ com
+ * @version  1.0
+ * @created  18.10.2026
+ *
+ * Versionshistorie:
+ * V 1.0:  - Erstellt.
+ */
+#ifndef RENDERCACHE_H
+#define RENDERCACHE_H
+
+#include "Arduino.h"
+
+// Der Modus, wenn nichts (Gueltiges) im Bildspeicher steht.
+#define RENDER_CACHE_INVALID 0xFF
+
+// Die Alarm-LED...
+#define RENDER_CACHE_ALARM_OFF      0
+#define RENDER_CACHE_ALARM_ON       1
+#define RENDER_CACHE_ALARM_BLINKING 2
+
+class RenderCache {
+public:
+    RenderCache();
+
+    boolean hit(byte mode, char hours, byte minutes, byte language, boolean cornersCw, byte alarmLed);
+    void invalidate();
+
+    byte getMode();
+
+private:
+    byte _mode;
+    char _hours;
+    byte _minutes;
+    byte _language;
+    boolean _cornersCw;
+    byte _alarmLed;
+};
+
+#endif
@@ -4,9 +4,9 @@
  *
  * @mc       Arduino/RBBB
  * @autor    Christian Aschoff / caschoff _AT_ mac _DOT_ com
- * @version  1.6b
+ * @version  1.10
  * @created  21.1.2013
- * @updated  10.04.2016  (Ergänzungen von A. Mueller)
+ * @updated  18.10.2026
  *
  * Versionshistorie:
  * V 1.0:  - Erstellt.
@@ -21,17 +21,17 @@
  *         - Kleinere Aufräumarbeiten
  * V 1.6b: - Kleine Codeoptimierungen
  *         - Zusätzliche Option, für jede Eckled nur die dazugehörige Kathode und nicht alle einzuschalten. Dies Verhindert das Glimmen ausgeschalteter Eckleds. (Standard: ausgeschaltet)
+ * V 1.7:  - switch-Kaskade in setMinutes/setHours durch vorberechnete Frames im PROGMEM ersetzt (RendererFrames.h).
+ *           Die Laufzeit ist jetzt unabhaengig von Sprache und Uhrzeit.
+ * V 1.8:  - Frames durch die Sprachbeschreibung (Sprachen.h) ersetzt: Woerter, Minuten-Phrasen und Stunden
+ *           sind Tabellen, ein einziger Interpreter setzt die Woerter. Auch cleanWordsForAlarmSettingMode nutzt die Tabellen.
+ * V 1.9:  - setHours setzt nur die Stunden-Woerter (z.B. fuer eine eigene Farbe der Stunden).
+ * V 1.10: - writeChar gibt alle Zeichen aus dem gemeinsamen Zeichen-Atlas (Schriften.h) aus, mit Clipping.
  */
 #include "Renderer.h"
 
-#include "Woerter_DE.h"
-// #include "Woerter_DE_MKF.h"
-#include "Woerter_CH.h"
-#include "Woerter_EN.h"
-#include "Woerter_FR.h"
-#include "Woerter_IT.h"
-#include "Woerter_NL.h"
-#include "Woerter_ES.h"
+#include "Sprachen.h"
+#include "Schriften.h"
 
 // #define DEBUG
 #include "Debug.h"
@@ -69,8 +69,32 @@ void Renderer::setAllScreenBuffer(word matrix[16]) {
 
 /**
  * Setzt die Wortminuten, je nach hours/minutes.
+ * Das Zeitbild besteht aus den Woertern der Minuten-Phrase und den
+ * Woertern der Stunde (siehe Sprachen.h).
  */
 void Renderer::setMinutes(char hours, byte minutes, byte language, word matrix[16]) {
+    setTime(hours, minutes, language, true, matrix);
+}
+
+/**
+ * Setzt nur die Woerter der Stunde, die setMinutes fuer hours/minutes
+ * setzen wuerde (ohne die Minuten-Phrase).
+ */
+void Renderer::setHours(char hours, byte minutes, byte language, word matrix[16]) {
+    setTime(hours, minutes, language, false, matrix);
+}
+
+/**
+ * Setzt die Stunden-Woerter und, wenn withPhrase, die Woerter der Minuten-Phrase.
+ */
+void Renderer::setTime(char hours, byte minutes, byte language, boolean withPhrase, word matrix[16]) {
+    if (language > LANGUAGE_COUNT) {
+        return;
+    }
+
+    Sprache sprache;
+    memcpy_P(&sprache, &sprachen[language], sizeof(Sprache));
+
     while (hours < 0) {
         hours += 24;
     }
@@ -78,1060 +102,27 @@ void Renderer::setMinutes(char hours, byte minutes, byte language, word matrix[1
         hours -= 24;
     }
 
-    byte minutes_5 = minutes / 5;
-
-    switch (language) {
-            //
-            // Deutsch: Hochdeutsch
-            //
-        case LANGUAGE_DE_DE:
-        case LANGUAGE_DE_SW:
-        case LANGUAGE_DE_BA:
-        case LANGUAGE_DE_SA:
-            DE_ESIST;
-
-            switch (minutes_5) {
-                case 0:
-                    // glatte Stunde
-                    setHours(hours, true, language, matrix);
-                    break;
-                case 1:
-                    // 5 nach
-                    DE_FUENF;
-                    DE_NACH;
-                    setHours(hours, false, language, matrix);
-                    break;
-                case 2:
-                    // 10 nach
-                    DE_ZEHN;
-                    DE_NACH;
-                    setHours(hours, false, language, matrix);
-                    break;
-                case 3:
-                    // viertel nach
-                    if ((language == LANGUAGE_DE_SW) || (language == LANGUAGE_DE_SA)) {
-                        DE_VIERTEL;
-                        setHours(hours + 1, false, language, matrix);
-                    } else {
-                        DE_VIERTEL;
-                        DE_NACH;
-                        setHours(hours, false, language, matrix);
-                    }
-                    break;
-                case 4:
-                    // 20 nach
-                    if (language == LANGUAGE_DE_SA) {
-                        DE_ZEHN;
-                        DE_VOR;
-                        DE_HALB;
-                        setHours(hours + 1, false, language, matrix);
-                    } else {
-                        DE_ZWANZIG;
-                        DE_NACH;
-                        setHours(hours, false, language, matrix);
-                    }
-                    break;
-                case 5:
-                    // 5 vor halb
-                    DE_FUENF;
-                    DE_VOR;
-                    DE_HALB;
-                    setHours(hours + 1, false, language, matrix);
-                    break;
-                case 6:
-                    // halb
-                    DE_HALB;
-                    setHours(hours + 1, false, language, matrix);
-                    break;
-                case 7:
-                    // 5 nach halb
-                    DE_FUENF;
-                    DE_NACH;
-                    DE_HALB;
-                    setHours(hours + 1, false, language, matrix);
-                    break;
-                case 8:
-                    // 20 vor
-                    if (language == LANGUAGE_DE_SA) {
-                        DE_ZEHN;
-                        DE_NACH;
-                        DE_HALB;
-                        setHours(hours + 1, false, language, matrix);
-                    } else {
-                        DE_ZWANZIG;
-                        DE_VOR;
-                        setHours(hours + 1, false, language, matrix);
-                    }
-                    break;
-                case 9:
-                    // viertel vor
-                    if ((language == LANGUAGE_DE_SW) || (language == LANGUAGE_DE_BA) || (language == LANGUAGE_DE_SA)) {
-                        DE_DREIVIERTEL;
-                        setHours(hours + 1, false, language, matrix);
-                    } else {
-                        DE_VIERTEL;
-                        DE_VOR;
-                        setHours(hours + 1, false, language, matrix);
-                    }
-                    break;
-                case 10:
-                    // 10 vor
-                    DE_ZEHN;
-                    DE_VOR;
-                    setHours(hours + 1, false, language, matrix);
-                    break;
-                case 11:
-                    // 5 vor
-                    DE_FUENF;
-                    DE_VOR;
-                    setHours(hours + 1, false, language, matrix);
-                    break;
-            }
-            break;
-            //
-            // Schweiz: Berner-Deutsch
-            //
-        case LANGUAGE_CH:
-            CH_ESISCH;
-
-            switch (minutes_5) {
-                case 0:
-                    // glatte Stunde
-                    setHours(hours, true, language, matrix);
-                    break;
-                case 1:
-                    // 5 ab
-                    CH_FUEF;
-                    CH_AB;
-                    setHours(hours, false, language, matrix);
-                    break;
-                case 2:
-                    // 10 ab
-                    CH_ZAEAE;
-                    CH_AB;
-                    setHours(hours, false, language, matrix);
-                    break;
-                case 3:
-                    // viertel ab
-                    CH_VIERTU;
-                    CH_AB;
-                    setHours(hours, false, language, matrix);
-                    break;
-                case 4:
-                    // 20 ab
-                    CH_ZWAENZG;
-                    CH_AB;
-                    setHours(hours, false, language, matrix);
-                    break;
-                case 5:
-                    // 5 vor halb
-                    CH_FUEF;
-                    CH_VOR;
-                    CH_HAUBI;
-                    setHours(hours + 1, false, language, matrix);
-                    break;
-                case 6:
-                    // halb
-                    CH_HAUBI;
-                    setHours(hours + 1, false, language, matrix);
-                    break;
-                case 7:
-                    // 5 ab halb
-                    CH_FUEF;
-                    CH_AB;
-                    CH_HAUBI;
-                    setHours(hours + 1, false, language, matrix);
-                    break;
-                case 8:
-                    // 20 vor
-                    CH_ZWAENZG;
-                    CH_VOR;
-                    setHours(hours + 1, false, language, matrix);
-                    break;
-                case 9:
-                    // viertel vor
-                    CH_VIERTU;
-                    CH_VOR;
-                    setHours(hours + 1, false, language, matrix);
-                    break;
-                case 10:
-                    // 10 vor
-                    CH_ZAEAE;
-                    CH_VOR;
-                    setHours(hours + 1, false, language, matrix);
-                    break;
-                case 11:
-                    // 5 vor
-                    CH_FUEF;
-                    CH_VOR;
-                    setHours(hours + 1, false, language, matrix);
-                    break;
-            }
-            break;
-            //
-            // Englisch
-            //
-        case LANGUAGE_EN:
-            EN_ITIS;
-
-            switch (minutes_5) {
-                case 0:
-                    // glatte Stunde
-                    setHours(hours, true, language, matrix);
-                    break;
-                case 1:
-                    // 5 nach
-                    EN_FIVE;
-                    EN_PAST;
-                    setHours(hours, false, language, matrix);
-                    break;
-                case 2:
-                    // 10 nach
-                    EN_TEN;
-                    EN_PAST;
-                    setHours(hours, false, language, matrix);
-                    break;
-                case 3:
-                    // viertel nach
-                    EN_A;
-                    EN_QUATER;
-                    EN_PAST;
-                    setHours(hours, false, language, matrix);
-                    break;
-                case 4:
-                    // 20 nach
-                    EN_TWENTY;
-                    EN_PAST;
-                    setHours(hours, false, language, matrix);
-                    break;
-                case 5:
-                    // 5 vor halb
-                    EN_TWENTY;
-                    EN_FIVE;
-                    EN_PAST;
-                    setHours(hours, false, language, matrix);
-                    break;
-                case 6:
-                    // halb
-                    EN_HALF;
-                    EN_PAST;
-                    setHours(hours, false, language, matrix);
-                    break;
-                case 7:
-                    // 5 nach halb
-                    EN_TWENTY;
-                    EN_FIVE;
-                    EN_TO;
-                    setHours(hours + 1, false, language, matrix);
-                    break;
-                case 8:
-                    // 20 vor
-                    EN_TWENTY;
-                    EN_TO;
-                    setHours(hours + 1, false, language, matrix);
-                    break;
-                case 9:
-                    // viertel vor
-                    EN_A;
-                    EN_QUATER;
-                    EN_TO;
-                    setHours(hours + 1, false, language, matrix);
-                    break;
-                case 10:
-                    // 10 vor
-                    EN_TEN;
-                    EN_TO;
-                    setHours(hours + 1, false, language, matrix);
-                    break;
-                case 11:
-                    // 5 vor
-                    EN_FIVE;
-                    EN_TO;
-                    setHours(hours + 1, false, language, matrix);
-                    break;
-            }
-            break;
-            //
-            // Franzoesisch
-            //
-        case LANGUAGE_FR:
-            FR_ILEST;
+    uint32_t phrase = pgm_read_dword(&sprache.phrasen[minutes / 5]);
 
-            switch (minutes_5) {
-                case 0:
-                    // glatte Stunde
-                    setHours(hours, true, language, matrix);
-                    FR_hours(hours, matrix);
-                    break;
-                case 1:
-                    // 5 nach
-                    setHours(hours, false, language, matrix);
-                    FR_hours(hours, matrix);
-                    FR_CINQ;
-                    break;
-                case 2:
-                    // 10 nach
-                    setHours(hours, false, language, matrix);
-                    FR_hours(hours, matrix);
-                    FR_DIX;
-                    break;
-                case 3:
-                    // viertel nach
-                    setHours(hours, false, language, matrix);
-                    FR_hours(hours, matrix);
-                    FR_ET;
-                    FR_QUART;
-                    break;
-                case 4:
-                    // 20 nach
-                    setHours(hours, false, language, matrix);
-                    FR_hours(hours, matrix);
-                    FR_VINGT;
-                    break;
-                case 5:
-                    // 5 vor halb
-                    setHours(hours, false, language, matrix);
-                    FR_hours(hours, matrix);
-                    FR_VINGT;
-                    FR_TRAIT;
-                    FR_CINQ;
-                    break;
-                case 6:
-                    // halb
-                    setHours(hours, false, language, matrix);
-                    FR_hours(hours, matrix);
-                    FR_ET;
-                    FR_DEMI;
-                    break;
-                case 7:
-                    // 5 nach halb
-                    setHours(hours + 1, false, language, matrix);
-                    FR_hours(hours + 1, matrix);
-                    FR_MOINS;
-                    FR_VINGT;
-                    FR_TRAIT;
-                    FR_CINQ;
-                    break;
-                case 8:
-                    // 20 vor
-                    setHours(hours + 1, false, language, matrix);
-                    FR_hours(hours + 1, matrix);
-                    FR_MOINS;
-                    FR_VINGT;
-                    break;
-                case 9:
-                    // viertel vor
-                    setHours(hours + 1, false, language, matrix);
-                    FR_hours(hours + 1, matrix);
-                    FR_MOINS;
-                    FR_LE;
-                    FR_QUART;
-                    break;
-                case 10:
-                    // 10 vor
-                    setHours(hours + 1, false, language, matrix);
-                    FR_hours(hours + 1, matrix);
-                    FR_MOINS;
-                    FR_DIX;
-                    break;
-                case 11:
-                    // 5 vor
-                    setHours(hours + 1, false, language, matrix);
-                    FR_hours(hours + 1, matrix);
-                    FR_MOINS;
-                    FR_CINQ;
-                    break;
-            }
-            break;
-            //
-            // Italienisch
-            //
-        case LANGUAGE_IT:
-            switch (minutes_5) {
-                case 0:
-                    // glatte Stunde
-                    setHours(hours, true, language, matrix);
-                    IT_hours(hours, matrix);
-                    break;
-                case 1:
-                    // 5 nach
-                    IT_E2;
-                    IT_CINQUE;
-                    setHours(hours, false, language, matrix);
-                    IT_hours(hours, matrix);
-                    break;
-                case 2:
-                    // 10 nach
-                    IT_E2;
-                    IT_DIECI;
-                    setHours(hours, false, language, matrix);
-                    IT_hours(hours, matrix);
-                    break;
-                case 3:
-                    // viertel nach
-                    IT_E2;
-                    IT_UN;
-                    IT_QUARTO;
-                    setHours(hours, false, language, matrix);
-                    IT_hours(hours, matrix);
-                    break;
-                case 4:
-                    // 20 nach
-                    IT_E2;
-                    IT_VENTI;
-                    setHours(hours, false, language, matrix);
-                    IT_hours(hours, matrix);
-                    break;
-                case 5:
-                    // 5 vor halb
-                    IT_E2;
-                    IT_VENTI;
-                    IT_CINQUE;
-                    setHours(hours, false, language, matrix);
-                    IT_hours(hours, matrix);
-                    break;
-                case 6:
-                    // halb
-                    IT_E2;
-                    IT_MEZZA;
-                    setHours(hours, false, language, matrix);
-                    IT_hours(hours, matrix);
-                    break;
-                case 7:
-                    // 5 nach halb
-                    IT_MENO;
-                    IT_VENTI;
-                    IT_CINQUE;
-                    setHours(hours + 1, false, language, matrix);
-                    IT_hours(hours + 1, matrix);
-                    break;
-                case 8:
-                    // 20 vor
-                    IT_MENO;
-                    IT_VENTI;
-                    setHours(hours + 1, false, language, matrix);
-                    IT_hours(hours + 1, matrix);
-                    break;
-                case 9:
-                    // viertel vor
-                    IT_MENO;
-                    IT_UN;
-                    IT_QUARTO;
-                    setHours(hours + 1, false, language, matrix);
-                    IT_hours(hours + 1, matrix);
-                    break;
-                case 10:
-                    // 10 vor
-                    IT_MENO;
-                    IT_DIECI;
-                    setHours(hours + 1, false, language, matrix);
-                    IT_hours(hours + 1, matrix);
-                    break;
-                case 11:
-                    // 5 vor
-                    IT_MENO;
-                    IT_CINQUE;
-                    setHours(hours + 1, false, language, matrix);
-                    IT_hours(hours + 1, matrix);
-                    break;
-            }
-            break;
-            //
-            // Niederlaendisch
-            //
-        case LANGUAGE_NL:
-            NL_HETIS;
-
-            switch (minutes_5) {
-                case 0:
-                    // glatte Stunde
-                    setHours(hours, true, language, matrix);
-                    break;
-                case 1:
-                    // 5 nach
-                    NL_VIJF;
-                    NL_OVER;
-                    setHours(hours, false, language, matrix);
-                    break;
-                case 2:
-                    // 10 nach
-                    NL_TIEN;
-                    NL_OVER;
-                    setHours(hours, false, language, matrix);
-                    break;
-                case 3:
-                    // viertel nach
-                    NL_KWART;
-                    NL_OVER2;
-                    setHours(hours, false, language, matrix);
-                    break;
-                case 4:
-                    // 10 vor halb
-                    NL_TIEN;
-                    NL_VOOR;
-                    NL_HALF;
-                    setHours(hours + 1, false, language, matrix);
-                    break;
-                case 5:
-                    // 5 vor halb
-                    NL_VIJF;
-                    NL_VOOR;
-                    NL_HALF;
-                    setHours(hours + 1, false, language, matrix);
-                    break;
-                case 6:
-                    // halb
-                    NL_HALF;
-                    setHours(hours + 1, false, language, matrix);
-                    break;
-                case 7:
-                    // 5 nach halb
-                    NL_VIJF;
-                    NL_OVER;
-                    NL_HALF;
-                    setHours(hours + 1, false, language, matrix);
-                    break;
-                case 8:
-                    // 20 vor
-                    NL_TIEN;
-                    NL_OVER;
-                    NL_HALF;
-                    setHours(hours + 1, false, language, matrix);
-                    break;
-                case 9:
-                    // viertel vor
-                    NL_KWART;
-                    NL_VOOR2;
-                    setHours(hours + 1, false, language, matrix);
-                    break;
-                case 10:
-                    // 10 vor
-                    NL_TIEN;
-                    NL_VOOR;
-                    setHours(hours + 1, false, language, matrix);
-                    break;
-                case 11:
-                    // 5 vor
-                    NL_VIJF;
-                    NL_VOOR;
-                    setHours(hours + 1, false, language, matrix);
-                    break;
-            }
-            break;
-            //
-            // Spanisch
-            //
-        case LANGUAGE_ES:
-            switch (minutes_5) {
-                case 0:
-                    // glatte Stunde
-                    ES_hours(hours, matrix);
-                    setHours(hours, false, language, matrix);
-                    break;
-                case 1:
-                    // 5 nach
-                    ES_Y;
-                    ES_CINCO;
-                    ES_hours(hours, matrix);
-                    setHours(hours, false, language, matrix);
-                    break;
-                case 2:
-                    // 10 nach
-                    ES_Y;
-                    ES_DIEZ;
-                    ES_hours(hours, matrix);
-                    setHours(hours, false, language, matrix);
-                    break;
-                case 3:
-                    // viertel nach
-                    ES_Y;
-                    ES_CUARTO;
-                    ES_hours(hours, matrix);
-                    setHours(hours, false, language, matrix);
-                    break;
-                case 4:
-                    // 20 nach
-                    ES_Y;
-                    ES_VEINTE;
-                    ES_hours(hours, matrix);
-                    setHours(hours, false, language, matrix);
-                    break;
-                case 5:
-                    // 5 vor halb
-                    ES_Y;
-                    ES_VEINTICINCO;
-                    ES_hours(hours, matrix);
-                    setHours(hours, false, language, matrix);
-                    break;
-                case 6:
-                    // halb
-                    ES_Y;
-                    ES_MEDIA;
-                    ES_hours(hours, matrix);
-                    setHours(hours, false, language, matrix);
-                    break;
-                case 7:
-                    // 5 nach halb
-                    ES_MENOS;
-                    ES_VEINTICINCO;
-                    ES_hours(hours + 1, matrix);
-                    setHours(hours + 1, false, language, matrix);
-                    break;
-                case 8:
-                    // 20 vor
-                    ES_MENOS;
-                    ES_VEINTE;
-                    ES_hours(hours + 1, matrix);
-                    setHours(hours + 1, false, language, matrix);
-                    break;
-                case 9:
-                    // viertel vor
-                    ES_MENOS;
-                    ES_CUARTO;
-                    ES_hours(hours + 1, matrix);
-                    setHours(hours + 1, false, language, matrix);
-                    break;
-                case 10:
-                    // 10 vor
-                    ES_MENOS;
-                    ES_DIEZ;
-                    ES_hours(hours + 1, matrix);
-                    setHours(hours + 1, false, language, matrix);
-                    break;
-                case 11:
-                    // 5 vor
-                    ES_MENOS;
-                    ES_CINCO;
-                    ES_hours(hours + 1, matrix);
-                    setHours(hours + 1, false, language, matrix);
-                    break;
-            }
-            break;
+    if (phrase & PHRASE_HOUR_NEXT) {
+        hours++;
     }
+    // 0 und 24 Uhr sind im Franzoesischen MINUIT, 12 Uhr ist MIDI.
+    byte hourIndex = (hours == 12) ? 12 : hours % 12;
+    uint32_t stunde = pgm_read_dword(&sprache.stunden[(phrase & PHRASE_HOUR_GLATT) ? 1 : 0][hourIndex]);
+
+    setWords(sprache.woerter, withPhrase ? ((phrase & PHRASE_WORDS) | stunde) : stunde, matrix);
 }
 
 /**
- * Setzt die Stunden, je nach hours. 'glatt' bedeutet,
- * es ist genau diese Stunde und wir muessen 'UHR'
- * dazuschreiben und EIN statt EINS, falls es 1 ist.
- * (Zumindest im Deutschen).
- * Andere sprechliche Spezialfaelle kommen weiter unten
- * im Code...
+ * Setzt die Woerter aus der Bitmaske words (Bit n = Wort n aus woerter).
  */
-void Renderer::setHours(char hours, boolean glatt, byte language, word matrix[16]) {
-    switch (language) {
-            //
-            // Deutsch (Hochdeutsch, Schwaebisch, Bayrisch)
-            //
-        case LANGUAGE_DE_DE:
-        case LANGUAGE_DE_SW:
-        case LANGUAGE_DE_BA:
-        case LANGUAGE_DE_SA:
-            if (glatt) {
-                DE_UHR;
-            }
-
-            switch (hours) {
-                case 0:
-                case 12:
-                case 24:
-                    DE_H_ZWOELF;
-                    break;
-                case 1:
-                case 13:
-                    if (glatt) {
-                        DE_H_EIN;
-                    } else {
-                        DE_H_EINS;
-                    }
-                    break;
-                case 2:
-                case 14:
-                    DE_H_ZWEI;
-                    break;
-                case 3:
-                case 15:
-                    DE_H_DREI;
-                    break;
-                case 4:
-                case 16:
-                    DE_H_VIER;
-                    break;
-                case 5:
-                case 17:
-                    DE_H_FUENF;
-                    break;
-                case 6:
-                case 18:
-                    DE_H_SECHS;
-                    break;
-                case 7:
-                case 19:
-                    DE_H_SIEBEN;
-                    break;
-                case 8:
-                case 20:
-                    DE_H_ACHT;
-                    break;
-                case 9:
-                case 21:
-                    DE_H_NEUN;
-                    break;
-                case 10:
-                case 22:
-                    DE_H_ZEHN;
-                    break;
-                case 11:
-                case 23:
-                    DE_H_ELF;
-                    break;
-            }
-            break;
-            //
-            // Schweiz: Berner-Deutsch
-            //
-        case LANGUAGE_CH:
-            switch (hours) {
-                case 0:
-                case 12:
-                case 24:
-                    CH_H_ZWOEUFI;
-                    break;
-                case 1:
-                case 13:
-                    CH_H_EIS;
-                    break;
-                case 2:
-                case 14:
-                    CH_H_ZWOEI;
-                    break;
-                case 3:
-                case 15:
-                    CH_H_DRUE;
-                    break;
-                case 4:
-                case 16:
-                    CH_H_VIER;
-                    break;
-                case 5:
-                case 17:
-                    CH_H_FUEFI;
-                    break;
-                case 6:
-                case 18:
-                    CH_H_SAECHSI;
-                    break;
-                case 7:
-                case 19:
-                    CH_H_SIEBNI;
-                    break;
-                case 8:
-                case 20:
-                    CH_H_ACHTI;
-                    break;
-                case 9:
-                case 21:
-                    CH_H_NUENI;
-                    break;
-                case 10:
-                case 22:
-                    CH_H_ZAENI;
-                    break;
-                case 11:
-                case 23:
-                    CH_H_EUFI;
-                    break;
-            }
-            break;
-            //
-            // Englisch
-            //
-        case LANGUAGE_EN:
-            if (glatt) {
-                EN_OCLOCK;
-            }
-
-            switch (hours) {
-                case 0:
-                case 12:
-                case 24:
-                    EN_H_TWELVE;
-                    break;
-                case 1:
-                case 13:
-                    EN_H_ONE;
-                    break;
-                case 2:
-                case 14:
-                    EN_H_TWO;
-                    break;
-                case 3:
-                case 15:
-                    EN_H_THREE;
-                    break;
-                case 4:
-                case 16:
-                    EN_H_FOUR;
-                    break;
-                case 5:
-                case 17:
-                    EN_H_FIVE;
-                    break;
-                case 6:
-                case 18:
-                    EN_H_SIX;
-                    break;
-                case 7:
-                case 19:
-                    EN_H_SEVEN;
-                    break;
-                case 8:
-                case 20:
-                    EN_H_EIGHT;
-                    break;
-                case 9:
-                case 21:
-                    EN_H_NINE;
-                    break;
-                case 10:
-                case 22:
-                    EN_H_TEN;
-                    break;
-                case 11:
-                case 23:
-                    EN_H_ELEVEN;
-                    break;
-            }
-            break;
-            //
-            // Franzoesisch
-        case LANGUAGE_FR:
-            switch (hours) {
-                case 0:
-                case 24:
-                    FR_H_MINUIT;
-                    break;
-                case 12:
-                    FR_H_MIDI;
-                    break;
-                case 1:
-                case 13:
-                    FR_H_UNE;
-                    break;
-                case 2:
-                case 14:
-                    FR_H_DEUX;
-                    break;
-                case 3:
-                case 15:
-                    FR_H_TROIS;
-                    break;
-                case 4:
-                case 16:
-                    FR_H_QUATRE;
-                    break;
-                case 5:
-                case 17:
-                    FR_H_CINQ;
-                    break;
-                case 6:
-                case 18:
-                    FR_H_SIX;
-                    break;
-                case 7:
-                case 19:
-                    FR_H_SEPT;
-                    break;
-                case 8:
-                case 20:
-                    FR_H_HUIT;
-                    break;
-                case 9:
-                case 21:
-                    FR_H_NEUF;
-                    break;
-                case 10:
-                case 22:
-                    FR_H_DIX;
-                    break;
-                case 11:
-                case 23:
-                    FR_H_ONZE;
-                    break;
-            }
-            break;
-            //
-            // Italienisch
-            //
-        case LANGUAGE_IT:
-            switch (hours) {
-                case 0:
-                case 12:
-                case 24:
-                    IT_H_DODICI;
-                    break;
-                case 1:
-                case 13:
-                    IT_H_LUNA;
-                    break;
-                case 2:
-                case 14:
-                    IT_H_DUE;
-                    break;
-                case 3:
-                case 15:
-                    IT_H_TRE;
-                    break;
-                case 4:
-                case 16:
-                    IT_H_QUATTRO;
-                    break;
-                case 5:
-                case 17:
-                    IT_H_CINQUE;
-                    break;
-                case 6:
-                case 18:
-                    IT_H_SEI;
-                    break;
-                case 7:
-                case 19:
-                    IT_H_SETTE;
-                    break;
-                case 8:
-                case 20:
-                    IT_H_OTTO;
-                    break;
-                case 9:
-                case 21:
-                    IT_H_NOVE;
-                    break;
-                case 10:
-                case 22:
-                    IT_H_DIECI;
-                    break;
-                case 11:
-                case 23:
-                    IT_H_UNDICI;
-                    break;
-            }
-            break;
-            //
-            // Niederlaendisch
-            //
-        case LANGUAGE_NL:
-            if (glatt) {
-                NL_UUR;
-            }
-
-            switch (hours) {
-                case 0:
-                case 12:
-                case 24:
-                    NL_H_TWAALF;
-                    break;
-                case 1:
-                case 13:
-                    NL_H_EEN;
-                    break;
-                case 2:
-                case 14:
-                    NL_H_TWEE;
-                    break;
-                case 3:
-                case 15:
-                    NL_H_DRIE;
-                    break;
-                case 4:
-                case 16:
-                    NL_H_VIER;
-                    break;
-                case 5:
-                case 17:
-                    NL_H_VIJF;
-                    break;
-                case 6:
-                case 18:
-                    NL_H_ZES;
-                    break;
-                case 7:
-                case 19:
-                    NL_H_ZEVEN;
-                    break;
-                case 8:
-                case 20:
-                    NL_H_ACHT;
-                    break;
-                case 9:
-                case 21:
-                    NL_H_NEGEN;
-                    break;
-                case 10:
-                case 22:
-                    NL_H_TIEN;
-                    break;
-                case 11:
-                case 23:
-                    NL_H_ELF;
-                    break;
-            }
-            break;
-            //
-            // Spanisch
-            //
-        case LANGUAGE_ES:
-            switch (hours) {
-                case 0:
-                case 12:
-                case 24:
-                    ES_H_DOCE;
-                    break;
-                case 1:
-                case 13:
-                    ES_H_UNA;
-                    break;
-                case 2:
-                case 14:
-                    ES_H_DOS;
-                    break;
-                case 3:
-                case 15:
-                    ES_H_TRES;
-                    break;
-                case 4:
-                case 16:
-                    ES_H_CUATRO;
-                    break;
-                case 5:
-                case 17:
-                    ES_H_CINCO;
-                    break;
-                case 6:
-                case 18:
-                    ES_H_SEIS;
-                    break;
-                case 7:
-                case 19:
-                    ES_H_SIETE;
-                    break;
-                case 8:
-                case 20:
-                    ES_H_OCHO;
-                    break;
-                case 9:
-                case 21:
-                    ES_H_NUEVE;
-                    break;
-                case 10:
-                case 22:
-                    ES_H_DIEZ;
-                    break;
-                case 11:
-                case 23:
-                    ES_H_ONCE;
-                    break;
-            }
-            break;
+void Renderer::setWords(const word *woerter, uint32_t words, word matrix[16]) {
+    for (byte i = 0; words != 0; i++, words >>= 1) {
+        if (words & 1) {
+            word wort = pgm_read_word_near(&woerter[i]);
+            matrix[WORT_ZEILE(wort)] |= WORT_SPALTEN(wort);
+        }
     }
 }
 
@@ -1175,67 +166,98 @@ void Renderer::activateAlarmLed(word matrix[16]) {
  * Im Alarm-Einstell-Modus muessen bestimmte Woerter weg, wie z.B. "ES IST" im Deutschen.
  */
 void Renderer::cleanWordsForAlarmSettingMode(byte language, word matrix[16]) {
-    switch (language) {
-        case LANGUAGE_DE_DE:
-        case LANGUAGE_DE_SW:
-        case LANGUAGE_DE_BA:
-        case LANGUAGE_DE_SA:
-            matrix[0] &= 0b0010001111111111; // ES IST weg
-            break;
-        case LANGUAGE_CH:
-            matrix[0] &= 0b0010000111111111; // ES ISCH weg
-            break;
-        case LANGUAGE_EN:
-            matrix[0] &= 0b0010011111111111; // IT IS weg
-            break;
-        case LANGUAGE_FR:
-            matrix[0] &= 0b0010001111111111; // IL EST weg
-            break;
-        case LANGUAGE_IT:
-            matrix[0] &= 0b0000100111111111; // SONO LE weg
-            matrix[1] &= 0b0111111111111111; // E (L'UNA) weg
-            break;
-        case LANGUAGE_NL:
-            matrix[0] &= 0b0001001111111111; // HET IS weg
-            break;
-        case LANGUAGE_ES:
-            matrix[0] &= 0b1000100011111111; // SON LAS weg
-            matrix[0] &= 0b0011100111111111; // ES LA weg
-            break;
+    if (language > LANGUAGE_COUNT) {
+        return;
+    }
+
+    Sprache sprache;
+    memcpy_P(&sprache, &sprachen[language], sizeof(Sprache));
+
+    uint32_t words = sprache.alarmWoerter;
+    for (byte i = 0; words != 0; i++, words >>= 1) {
+        if (words & 1) {
+            word wort = pgm_read_word_near(&sprache.woerter[i]);
+            matrix[WORT_ZEILE(wort)] &= ~WORT_SPALTEN(wort);
+        }
     }
 }
 
 /**
- * Sprachlicher Spezialfall fuer Franzoesisch.
+ * Ein Zeichen aus dem Zeichen-Atlas (Schriften.h) mit der linken oberen Ecke
+ * an Spalte x, Zeile y in die Matrix schreiben (ODER). Was ausserhalb der
+ * 11x10 Buchstaben liegt, wird abgeschnitten, x und y duerfen also auch
+ * negativ sein. Die Eck-LEDs und die Alarm-LED bleiben unberuehrt.
+ *
+ * @param schrift SCHRIFT_STABEN, SCHRIFT_ZIFFERN oder SCHRIFT_ZIFFERN_KLEIN.
+ * @param c Das Zeichen ('A'-'Z' oder '0'-'9'), andere Zeichen werden ignoriert.
  */
-void Renderer::FR_hours(byte hours, word matrix[16]) {
-    if ((hours == 1) || (hours == 13)) {
-        FR_HEURE;
-    } else if ((hours == 0) || (hours == 12) || (hours == 24)) {
-        // MIDI / MINUIT ohne HEURES
-    } else {
-        FR_HEURES;
+void Renderer::writeChar(byte schrift, char c, char x, char y, word matrix[16]) {
+    byte width, height;
+    const byte *glyph = getGlyph(schrift, c, &width, &height);
+    if ((glyph == NULL) || (x <= -width) || (x >= 11)) {
+        return;
+    }
+
+    // Spalte x steht in Bit 15 - x, die rechte Spalte des Zeichens also in Bit 16 - x - width...
+    char shift = 16 - x - width;
+    byte bit = 0;
+    for (byte r = 0; r < height; r++, bit += width) {
+        char row = y + r;
+        if ((row < 0) || (row > 9)) {
+            continue;
+        }
+        word bits = getGlyphRow(glyph, bit, width);
+        bits = (shift >= 0) ? (bits << shift) : (bits >> -shift);
+        matrix[(byte)row] |= bits & 0b1111111111100000;
     }
 }
 
 /**
- * Sprachlicher Spezialfall fuer Italienisch.
+ * Die Zeilen eines Zeichens holen (rows[r], Bit 0 ist die rechte Spalte).
+ *
+ * @return Die Breite des Zeichens, 0 wenn es das Zeichen in der Schrift nicht gibt.
  */
-void Renderer::IT_hours(byte hours, word matrix[16]) {
-    if ((hours != 1) && (hours != 13)) {
-        IT_SONOLE;
-    } else {
-        IT_E;
+byte Renderer::getCharRows(byte schrift, char c, byte rows[]) {
+    byte width, height;
+    const byte *glyph = getGlyph(schrift, c, &width, &height);
+    if (glyph == NULL) {
+        return 0;
     }
+    byte bit = 0;
+    for (byte r = 0; r < height; r++, bit += width) {
+        rows[r] = getGlyphRow(glyph, bit, width);
+    }
+    return width;
+}
+
+/**
+ * Die Hoehe der Zeichen einer Schrift.
+ */
+byte Renderer::getCharHeight(byte schrift) {
+    return pgm_read_byte_near(&schriften[schrift].height);
 }
 
 /**
- * Sprachlicher Spezialfall fuer Spanisch.
+ * Die Adresse eines Zeichens im Zeichen-Atlas (oder NULL), dazu Breite und Hoehe.
  */
-void Renderer::ES_hours(byte hours, word matrix[16]) {
-    if ((hours == 1) || (hours == 13)) {
-        ES_ESLA;
-    } else {
-        ES_SONLAS;
+const byte *Renderer::getGlyph(byte schrift, char c, byte *width, byte *height) {
+    Schrift s;
+    memcpy_P(&s, &schriften[schrift], sizeof(Schrift));
+    if ((c < s.first) || (c >= s.first + s.count)) {
+        return NULL;
     }
+    *width = s.width;
+    *height = s.height;
+    // jedes Zeichen beginnt an einer Byte-Grenze...
+    return &glyphen[s.start + (c - s.first) * ((s.width * s.height + 7) / 8)];
+}
+
+/**
+ * Eine Zeile eines Zeichens lesen: width Bit ab Bit bit (MSB zuerst).
+ * Eine Zeile ist hoechstens 5 Bit breit, steht also immer in zwei Bytes.
+ */
+byte Renderer::getGlyphRow(const byte *glyph, byte bit, byte width) {
+    const byte *p = glyph + (bit >> 3);
+    word twoBytes = (pgm_read_byte_near(p) << 8) | pgm_read_byte_near(p + 1);
+    return (twoBytes >> (16 - (bit & 7) - width)) & ((1 << width) - 1);
 }
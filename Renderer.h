@@ -4,9 +4,9 @@
  *
  * @mc       Arduino/RBBB
  * @autor    Christian Aschoff / caschoff _AT_ mac _DOT_ com
- * @version  1.6b
+ * @version  1.10
  * @created  21.1.2013
- * @updated  10.04.2016  (Ergänzungen von A. Mueller)
+ * @updated  18.10.2026
  *
  * Versionshistorie:
  * V 1.0:  - Erstellt.
@@ -21,6 +21,12 @@
  *         - Kleinere Aufräumarbeiten
  * V 1.6b: - Minimale Codeoptimierung
  *         - Zusätzliche Option, für jede Eckled nur die dazugehörige Kathode und nicht alle einzuschalten. Dies Verhindert das Glimmen ausgeschalteter Eckleds. (Standard: ausgeschaltet)
+ * V 1.7:  - switch-Kaskade in setMinutes/setHours durch vorberechnete Frames im PROGMEM ersetzt (RendererFrames.h).
+ *           Die Laufzeit ist jetzt unabhaengig von Sprache und Uhrzeit.
+ * V 1.8:  - Frames durch die Sprachbeschreibung (Sprachen.h) ersetzt: Woerter, Minuten-Phrasen und Stunden
+ *           sind Tabellen, ein einziger Interpreter setzt die Woerter. Auch cleanWordsForAlarmSettingMode nutzt die Tabellen.
+ * V 1.9:  - setHours setzt nur die Stunden-Woerter (z.B. fuer eine eigene Farbe der Stunden).
+ * V 1.10: - writeChar gibt alle Zeichen aus dem gemeinsamen Zeichen-Atlas (Schriften.h) aus, mit Clipping.
  */
 #ifndef RENDERER_H
 #define RENDERER_H
@@ -40,11 +46,16 @@
 #define LANGUAGE_ES    9
 #define LANGUAGE_COUNT 9
 
+#define SCHRIFT_STABEN        0
+#define SCHRIFT_ZIFFERN       1
+#define SCHRIFT_ZIFFERN_KLEIN 2
+
 class Renderer {
 public:
     Renderer();
 
     void setMinutes(char hours, byte minutes, byte language, word matrix[16]);
+    void setHours(char hours, byte minutes, byte language, word matrix[16]);
     void setCorners(byte minutes, boolean cw, word matrix[16]);
     void activateAlarmLed(word matrix[16]);
 
@@ -54,13 +65,15 @@ public:
     void clearScreenBuffer(word matrix[16]);
     void setAllScreenBuffer(word matrix[16]);
 
-private:
-    void setHours(char hours, boolean glatt, byte language, word matrix[16]);
+    void writeChar(byte schrift, char c, char x, char y, word matrix[16]);
+    byte getCharRows(byte schrift, char c, byte rows[]);
+    byte getCharHeight(byte schrift);
 
-    // Spezialfaelle
-    void FR_hours(byte hours, word matrix[16]);
-    void IT_hours(byte hours, word matrix[16]);
-    void ES_hours(byte hours, word matrix[16]);
+private:
+    void setTime(char hours, byte minutes, byte language, boolean withPhrase, word matrix[16]);
+    void setWords(const word *woerter, uint32_t words, word matrix[16]);
+    const byte *getGlyph(byte schrift, char c, byte *width, byte *height);
+    byte getGlyphRow(const byte *glyph, byte bit, byte width);
 };
 
 #endif
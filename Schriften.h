@@ -0,0 +1,336 @@
+/**
+ * Schriften
+ * Alle Zeichen (Staben A-Z, Ziffern 0-9 gross und klein) in einem gemeinsamen
+ * Zeichen-Atlas. Die Pixel eines Zeichens stehen zeilenweise und bitweise
+ * gepackt hintereinander (MSB zuerst, links ist das hoechste Bit einer Zeile),
+ * ein Zeichen beginnt immer an einer Byte-Grenze. Breite, Hoehe und erstes
+ * Zeichen stehen pro Schrift in schriften[], ausgegeben wird mit
+ * Renderer::writeChar().
+ * Die GLYPH_*-Makros packen die Zeilen schon beim Kompilieren, die Zeichen
+ * bleiben so als Bitmuster lesbar.
+ *
+ * Ersetzt Staben.h (V 1.1), Zahlen.h (V 1.3) und ZahlenKlein.h (V 1.0): statt
+ * 250 Byte mit einem Byte pro Zeile brauchen die Zeichen jetzt 184 Byte.
+ *
+ * @mc       Arduino/RBBB
+ * @autor    agent / agent _AT_ local
+ *           Vorlage von: Christian Aschoff / caschoff _AT_ mac _DOT_ com
+ * @version  1.0
+ * @created  18.10.2026
+ *
+ * Versionshistorie:
+ * V 1.0:  - Erstellt aus Staben.h, Zahlen.h und ZahlenKlein.h.
+ */
+#ifndef SCHRIFTEN_H
+#define SCHRIFTEN_H
+
+#include <avr/pgmspace.h>
+
+/**
+ * 5 Zeilen a 5 Bit (25 Bit) in 4 Byte.
+ */
+#define GLYPH_5X5(r0, r1, r2, r3, r4) \
+    (byte)(((r0) << 3) | ((r1) >> 2)), \
+    (byte)(((r1) << 6) | ((r2) << 1) | ((r3) >> 4)), \
+    (byte)(((r3) << 4) | ((r4) >> 1)), \
+    (byte)((r4) << 7)
+
+/**
+ * 7 Zeilen a 5 Bit (35 Bit) in 5 Byte.
+ */
+#define GLYPH_5X7(r0, r1, r2, r3, r4, r5, r6) \
+    (byte)(((r0) << 3) | ((r1) >> 2)), \
+    (byte)(((r1) << 6) | ((r2) << 1) | ((r3) >> 4)), \
+    (byte)(((r3) << 4) | ((r4) >> 1)), \
+    (byte)(((r4) << 7) | ((r5) << 2) | ((r6) >> 3)), \
+    (byte)((r6) << 5)
+
+/**
+ * 5 Zeilen a 4 Bit (20 Bit) in 3 Byte.
+ */
+#define GLYPH_4X5(r0, r1, r2, r3, r4) \
+    (byte)(((r0) << 4) | (r1)), \
+    (byte)(((r2) << 4) | (r3)), \
+    (byte)((r4) << 4)
+
+/**
+ * Beschreibung einer Schrift im Atlas.
+ */
+struct Schrift {
+    // Index des ersten Zeichens in glyphen[].
+    word start;
+    // Das erste Zeichen (z.B. 'A'), die weiteren folgen lueckenlos.
+    char first;
+    byte count;
+    byte width;
+    byte height;
+};
+
+static const byte glyphen[] PROGMEM = {
+    // SCHRIFT_STABEN: A-Z, 5x5, je 4 Byte (Index 0)
+    GLYPH_5X5(0b01100,
+              0b10010,
+              0b11110,
+              0b10010,
+              0b10010), // A
+    GLYPH_5X5(0b11100,
+              0b10010,
+              0b11100,
+              0b10010,
+              0b11100), // B
+    GLYPH_5X5(0b01110,
+              0b10000,
+              0b10000,
+              0b10000,
+              0b01110), // C
+    GLYPH_5X5(0b11100,
+              0b10010,
+              0b10010,
+              0b10010,
+              0b11100), // D
+    GLYPH_5X5(0b11110,
+              0b10000,
+              0b11100,
+              0b10000,
+              0b11110), // E
+    GLYPH_5X5(0b11110,
+              0b10000,
+              0b11100,
+              0b10000,
+              0b10000), // F
+    GLYPH_5X5(0b01110,
+              0b10000,
+              0b10110,
+              0b10010,
+              0b01100), // G
+    GLYPH_5X5(0b10010,
+              0b10010,
+              0b11110,
+              0b10010,
+              0b10010), // H
+    GLYPH_5X5(0b01000,
+              0b01000,
+              0b01000,
+              0b01000,
+              0b01000), // I
+    GLYPH_5X5(0b11110,
+              0b00010,
+              0b00010,
+              0b10010,
+              0b01100), // J
+    GLYPH_5X5(0b10010,
+              0b10100,
+              0b11000,
+              0b10100,
+              0b10010), // K
+    GLYPH_5X5(0b10000,
+              0b10000,
+              0b10000,
+              0b10000,
+              0b11110), // L
+    GLYPH_5X5(0b10001,
+              0b11011,
+              0b10101,
+              0b10001,
+              0b10001), // M
+    GLYPH_5X5(0b10001,
+              0b11001,
+              0b10101,
+              0b10011,
+              0b10001), // N
+    GLYPH_5X5(0b01100,
+              0b10010,
+              0b10010,
+              0b10010,
+              0b01100), // O
+    GLYPH_5X5(0b11100,
+              0b10010,
+              0b11100,
+              0b10000,
+              0b10000), // P
+    GLYPH_5X5(0b01100,
+              0b10010,
+              0b10010,
+              0b01100,
+              0b00010), // Q
+    GLYPH_5X5(0b11100,
+              0b10010,
+              0b11100,
+              0b10100,
+              0b10010), // R
+    GLYPH_5X5(0b01110,
+              0b10000,
+              0b01100,
+              0b00010,
+              0b11100), // S
+    GLYPH_5X5(0b11111,
+              0b00100,
+              0b00100,
+              0b00100,
+              0b00100), // T
+    GLYPH_5X5(0b10001,
+              0b10001,
+              0b10001,
+              0b10001,
+              0b01110), // U
+    GLYPH_5X5(0b10001,
+              0b10001,
+              0b10001,
+              0b01010,
+              0b00100), // V
+    GLYPH_5X5(0b10001,
+              0b10001,
+              0b10101,
+              0b11011,
+              0b10001), // W
+    GLYPH_5X5(0b10001,
+              0b01010,
+              0b00100,
+              0b01010,
+              0b10001), // X
+    GLYPH_5X5(0b10001,
+              0b01010,
+              0b00100,
+              0b00100,
+              0b00100), // Y
+    GLYPH_5X5(0b11111,
+              0b00010,
+              0b00100,
+              0b01000,
+              0b11110), // Z
+    // SCHRIFT_ZIFFERN: 0-9, 5x7, je 5 Byte (Index 104)
+    GLYPH_5X7(0b01110,
+              0b10001,
+              0b10001,
+              0b10001,
+              0b10001,
+              0b10001,
+              0b01110), // 0
+    GLYPH_5X7(0b00100,
+              0b01100,
+              0b00100,
+              0b00100,
+              0b00100,
+              0b00100,
+              0b01110), // 1
+    GLYPH_5X7(0b01110,
+              0b10001,
+              0b00001,
+              0b00010,
+              0b00100,
+              0b01000,
+              0b11111), // 2
+    GLYPH_5X7(0b11111,
+              0b00010,
+              0b00100,
+              0b00010,
+              0b00001,
+              0b10001,
+              0b01110), // 3
+    GLYPH_5X7(0b00010,
+              0b00110,
+              0b01010,
+              0b10010,
+              0b11111,
+              0b00010,
+              0b00010), // 4
+    GLYPH_5X7(0b11111,
+              0b10000,
+              0b11110,
+              0b00001,
+              0b00001,
+              0b10001,
+              0b01110), // 5
+    GLYPH_5X7(0b00110,
+              0b01000,
+              0b10000,
+              0b11110,
+              0b10001,
+              0b10001,
+              0b01110), // 6
+    GLYPH_5X7(0b11111,
+              0b00001,
+              0b00010,
+              0b00100,
+              0b01000,
+              0b01000,
+              0b01000), // 7
+    GLYPH_5X7(0b01110,
+              0b10001,
+              0b10001,
+              0b01110,
+              0b10001,
+              0b10001,
+              0b01110), // 8
+    GLYPH_5X7(0b01110,
+              0b10001,
+              0b10001,
+              0b01111,
+              0b00001,
+              0b00010,
+              0b01100), // 9
+    // SCHRIFT_ZIFFERN_KLEIN: 0-9, 4x5, je 3 Byte (Index 154)
+    GLYPH_4X5(0b0110,
+              0b1001,
+              0b1001,
+              0b1001,
+              0b0110), // 0
+    GLYPH_4X5(0b0010,
+              0b0110,
+              0b0010,
+              0b0010,
+              0b0111), // 1
+    GLYPH_4X5(0b0110,
+              0b1001,
+              0b0010,
+              0b0100,
+              0b1111), // 2
+    GLYPH_4X5(0b1110,
+              0b0001,
+              0b0110,
+              0b0001,
+              0b1110), // 3
+    GLYPH_4X5(0b0010,
+              0b0110,
+              0b1010,
+              0b1111,
+              0b0010), // 4
+    GLYPH_4X5(0b1111,
+              0b1000,
+              0b1110,
+              0b0001,
+              0b1110), // 5
+    GLYPH_4X5(0b0110,
+              0b1000,
+              0b1110,
+              0b1001,
+              0b0110), // 6
+    GLYPH_4X5(0b1111,
+              0b0001,
+              0b0010,
+              0b0100,
+              0b1000), // 7
+    GLYPH_4X5(0b0110,
+              0b1001,
+              0b0110,
+              0b1001,
+              0b0110), // 8
+    GLYPH_4X5(0b0110,
+              0b1001,
+              0b0111,
+              0b0001,
+              0b0110), // 9
+    // damit beim Lesen von zwei Bytes am Ende nichts ueberlaeuft...
+    0
+};
+
+/**
+ * Die Schriften, Reihenfolge wie SCHRIFT_* in Renderer.h.
+ */
+static const Schrift schriften[] PROGMEM = {
+    {  0, 'A', 26, 5, 5}, // SCHRIFT_STABEN
+    {104, '0', 10, 5, 7}, // SCHRIFT_ZIFFERN
+    {154, '0', 10, 4, 5}  // SCHRIFT_ZIFFERN_KLEIN
+};
+
+#endif
@@ -5,9 +5,9 @@
  *
  * @mc       Arduino/RBBB
  * @autor    Christian Aschoff / caschoff _AT_ mac _DOT_ com
- * @version  1.7
+ * @version  1.9
  * @created  24.2.2011
- * @updated  16.2.2015
+ * @updated  18.10.2026
  *
  * Versionshistorie:
  * V 1.1:  - Schnelle DigitalWrite-Methoden eingefuehrt.
@@ -19,10 +19,17 @@
  * V 1.5:  - optimiertes Schreiben fuer die Faelle data==0 und data==65535.
  * V 1.6:  - shiftOutABit eiungefuehrt.
  * V 1.7:  - Unterstuetzung fuer die alte Arduino-IDE (bis 1.0.6) entfernt.
+ * V 1.8:  - shiftOutBytesFromInterrupt() schreibt ohne cli()/sei() direkt auf die Ports.
+ * V 1.9:  - Optionale Ausgabe ueber Hardware-SPI (SHIFTREGISTER_SPI), Ausgabe von
+ *           zwei Worten und von ganzen Byte-Folgen am Stueck.
+ *         - begin() startet SPI (aus init() der Treiber statt im Konstruktor).
  */
 // #include "pins_arduino.h"
 #include "ShiftRegister.h"
 #include "Configuration.h"
+#ifdef SHIFTREGISTER_SPI
+#include <SPI.h>
+#endif
 
 // #define DEBUG
 #include "Debug.h"
@@ -31,7 +38,10 @@
  * Initialisierung mit den Pins fuer Serial-Data, Serial-Clock und Store-Clock (Latch)
  */
 ShiftRegister::ShiftRegister(byte dataPin, byte clockPin, byte latchPin) {
-#ifdef SHIFTREGISTER_TURBO
+#ifdef SHIFTREGISTER_SPI
+    DEBUG_PRINTLN(F("ShiftRegister is in SPI-MODE."));
+    DEBUG_FLUSH();
+#elif defined(SHIFTREGISTER_TURBO)
     DEBUG_PRINTLN(F("ShiftRegister is in TURBO-MODE."));
     DEBUG_FLUSH();
 #else
@@ -59,12 +69,34 @@ ShiftRegister::ShiftRegister(byte dataPin, byte clockPin, byte latchPin) {
     _latchBit = digitalPinToBitMask(latchPin);
     _latchPort = digitalPinToPort(latchPin);
     _latchOut = portOutputRegister(_latchPort);
+
+#ifdef SHIFTREGISTER_SPI
+    _pendingBits = 0;
+    _pendingCount = 0;
+#endif
+}
+
+/**
+ * Die Hardware starten. Wird aus init() der LED-Treiber (also aus setup())
+ * aufgerufen und nicht im Konstruktor: die Treiber sind globale Objekte,
+ * deren Konstruktoren vor main() laufen.
+ * Mit SHIFTREGISTER_SPI muss Data an MOSI und Clock an SCK haengen (siehe
+ * Configuration.h), die Bits gehen wie beim Bit-Banging mit Bit 0 zuerst raus.
+ */
+void ShiftRegister::begin() {
+#ifdef SHIFTREGISTER_SPI
+    SPI.begin();
+#endif
 }
 
 /**
  * Ein WORD (16 Bit) ausgeben
  */
 void ShiftRegister::shiftOut(word data) {
+#ifdef SHIFTREGISTER_SPI
+    SPI.transfer(lowByte(data));
+    SPI.transfer(highByte(data));
+#else
 #ifdef OPTIMIZED_FOR_DARKNESS
     if (data == (word) 65535) {
         fastDigitalWriteToData(HIGH);
@@ -104,13 +136,94 @@ void ShiftRegister::shiftOut(word data) {
         digitalWrite(_clockPin, HIGH);
     }
 #endif
+#endif
+}
+
+/**
+ * Zwei WORDs am Stueck ausgeben (z.B. Spalten und Zeile), mit SPI
+ * als ein Transfer von 32 Bit.
+ */
+void ShiftRegister::shiftOut(word first, word second) {
+#ifdef SHIFTREGISTER_SPI
+    SPI.transfer(lowByte(first));
+    SPI.transfer(highByte(first));
+    SPI.transfer(lowByte(second));
+    SPI.transfer(highByte(second));
+#else
+    shiftOut(first);
+    shiftOut(second);
+#endif
+}
+
+/**
+ * Eine Folge von Bytes ausgeben (z.B. ein ganzes Bild), jedes Byte mit Bit 0 zuerst.
+ */
+void ShiftRegister::shiftOutBytes(const byte *data, byte count) {
+    for (byte i = 0; i < count; i++) {
+#ifdef SHIFTREGISTER_SPI
+        SPI.transfer(data[i]);
+#else
+        for (byte b = 0; b < 8; b++) {
+            shiftOutABit(data[i] & (1 << b));
+        }
+#endif
+    }
+}
+
+/**
+ * Eine Folge von Bytes mit Latch ausgeben, nur aus einer Interrupt-Routine.
+ * Die Interrupts sind dort schon gesperrt, deshalb wird direkt auf die Ports
+ * geschrieben, ohne cli()/sei() und ohne SREG anzufassen (die
+ * fastDigitalWrite*-Methoden geben die Interrupts mit sei() frei, dann
+ * koennte die Routine sich selbst unterbrechen). Mit SHIFTREGISTER_SPI
+ * fasst auch die SPI-Bibliothek SREG nicht an, solange niemand
+ * SPI.usingInterrupt() aufruft.
+ */
+void ShiftRegister::shiftOutBytesFromInterrupt(const byte *data, byte count) {
+#ifdef SHIFTREGISTER_SPI
+    SPI.beginTransaction(SPISettings(SHIFTREGISTER_SPI_CLOCK, LSBFIRST, SPI_MODE0));
+    *_latchOut &= ~_latchBit;
+    for (byte i = 0; i < count; i++) {
+        SPI.transfer(data[i]);
+    }
+    *_latchOut |= _latchBit;
+    SPI.endTransaction();
+#else
+    *_latchOut &= ~_latchBit;
+    for (byte i = 0; i < count; i++) {
+        byte b = data[i];
+        for (byte n = 0; n < 8; n++) {
+            *_clockOut &= ~_clockBit;
+            if (b & 1) {
+                *_dataOut |= _dataBit;
+            } else {
+                *_dataOut &= ~_dataBit;
+            }
+            *_clockOut |= _clockBit;
+            b >>= 1;
+        }
+    }
+    *_latchOut |= _latchBit;
+#endif
 }
 
 /**
  * Ein einzelnes Bit rausshiften...
+ * Mit SPI werden die Bits gesammelt und byteweise geschickt, die Anzahl
+ * der Bits bis zum Latch muss dann durch 8 teilbar sein.
  */
 void ShiftRegister::shiftOutABit(boolean bitIsSet) {
-#ifdef SHIFTREGISTER_TURBO
+#ifdef SHIFTREGISTER_SPI
+    if (bitIsSet) {
+        _pendingBits |= (1 << _pendingCount);
+    }
+    _pendingCount++;
+    if (_pendingCount == 8) {
+        SPI.transfer(_pendingBits);
+        _pendingBits = 0;
+        _pendingCount = 0;
+    }
+#elif defined(SHIFTREGISTER_TURBO)
     fastDigitalWriteToClock(LOW);
     if (bitIsSet) {
         fastDigitalWriteToData(HIGH);
@@ -133,6 +246,9 @@ void ShiftRegister::shiftOutABit(boolean bitIsSet) {
  * Vorbereitung fuer die Ausgabe
  */
 void ShiftRegister::prepareShiftregisterWrite() {
+#ifdef SHIFTREGISTER_SPI
+    SPI.beginTransaction(SPISettings(SHIFTREGISTER_SPI_CLOCK, LSBFIRST, SPI_MODE0));
+#endif
 #ifdef SHIFTREGISTER_TURBO
     // fastDigitalWriteToData(LOW);
     // fastDigitalWriteToClock(LOW);
@@ -157,6 +273,9 @@ void ShiftRegister::finishShiftregisterWrite() {
     // digitalWrite(_clockPin, LOW);
     digitalWrite(_latchPin, HIGH);
 #endif
+#ifdef SHIFTREGISTER_SPI
+    SPI.endTransaction();
+#endif
 }
 
 /**
@@ -5,9 +5,9 @@
  *
  * @mc       Arduino/RBBB
  * @autor    Christian Aschoff / caschoff _AT_ mac _DOT_ com
- * @version  1.7
+ * @version  1.9
  * @created  24.2.2011
- * @updated  16.2.2015
+ * @updated  18.10.2026
  *
  * Versionshistorie:
  * V 1.1:  - Schnelle DigitalWrite-Methoden eingefuehrt.
@@ -19,6 +19,10 @@
  * V 1.5:  - optimiertes Schreiben fuer die Faelle data==0 und data==65535.
  * V 1.6:  - shiftOutABit eiungefuehrt.
  * V 1.7:  - Unterstuetzung fuer die alte Arduino-IDE (bis 1.0.6) entfernt.
+ * V 1.8:  - shiftOutBytesFromInterrupt() schreibt ohne cli()/sei() direkt auf die Ports.
+ * V 1.9:  - Optionale Ausgabe ueber Hardware-SPI (SHIFTREGISTER_SPI), Ausgabe von
+ *           zwei Worten und von ganzen Byte-Folgen am Stueck.
+ *         - begin() startet SPI (aus init() der Treiber statt im Konstruktor).
  */
 #ifndef SHIFTREGISTER_H
 #define SHIFTREGISTER_H
@@ -29,7 +33,12 @@ class ShiftRegister {
 public:
     ShiftRegister(byte dataPin, byte clockPin, byte latchPin);
 
+    void begin();
+
     void shiftOut(word data);
+    void shiftOut(word first, word second);
+    void shiftOutBytes(const byte *data, byte count);
+    void shiftOutBytesFromInterrupt(const byte *data, byte count);
     void shiftOutABit(boolean bitIsSet);
 
     void prepareShiftregisterWrite();
@@ -54,6 +63,12 @@ private:
     uint8_t _latchPort;
     volatile uint8_t *_latchOut;
 
+#ifdef SHIFTREGISTER_SPI
+    // Einzelne Bits fuer shiftOutABit(), bis ein Byte voll ist.
+    byte _pendingBits;
+    byte _pendingCount;
+#endif
+
     void fastDigitalWriteToData(uint8_t val);
     void fastDigitalWriteToClock(uint8_t val);
     void fastDigitalWriteToLatch(uint8_t val);
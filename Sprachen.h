@@ -0,0 +1,84 @@
+/**
+ * Sprachen
+ * Die Beschreibung aller Sprachen fuer den Renderer.
+ * Eine Sprache besteht aus
+ * - der Tabelle der Woerter (Zeile und Bitmaske, Woerter_*.h),
+ * - den Minuten-Phrasen in 5-Minuten-Schritten (Woerter und Flags),
+ * - den Stunden (0-12, einmal normal und einmal als glatte Stunde),
+ * - den Woertern, die im Alarm-Einstell-Modus weg muessen.
+ * Phrasen und Stunden sind Bitmasken ueber die Woerter einer Sprache
+ * (Bit n = Wort mit dem Index n). Eine neue Sprache oder eine andere
+ * Frontplatte braucht also nur neue Tabellen und einen Eintrag in
+ * sprachen[], der Renderer bleibt unveraendert.
+ *
+ * @mc       Arduino/RBBB
+ * @autor    Christian Aschoff / caschoff _AT_ mac _DOT_ com
+ * @version  1.0
+ * @created  18.10.2026
+ *
+ * Versionshistorie:
+ * V 1.0:  - Erstellt.
+ */
+#ifndef SPRACHEN_H
+#define SPRACHEN_H
+
+#include "Arduino.h"
+#include <avr/pgmspace.h>
+#include "Configuration.h"
+
+/**
+ * Ein Wort: die Zeile steht in den Bits 0-3, die Spalten in den
+ * Bits 5-15 (wie im Bildspeicher). Die Bits 0-4 sind im Bildspeicher
+ * die Eck-LEDs, die kommen in Woertern nie vor.
+ */
+#define WORT(zeile, spalten) ((word)((spalten) | (zeile)))
+#define WORT_ZEILE(wort)     ((wort) & 0b0000000000001111)
+#define WORT_SPALTEN(wort)   ((wort) & 0b1111111111100000)
+
+/**
+ * Das Wort mit dem Index n in einer Phrase oder Stunde.
+ * Maximal 30 Woerter pro Sprache, die Bits 30 und 31 sind die Flags.
+ */
+#define W(n) (1UL << (n))
+#define PHRASE_WORDS      0x3FFFFFFFUL
+
+/**
+ * Flags der Minuten-Phrasen.
+ * PHRASE_HOUR_NEXT: Die folgende Stunde anzeigen ("5 vor halb DREI").
+ * PHRASE_HOUR_GLATT: Die Stunde als glatte Stunde anzeigen ("EIN UHR").
+ */
+#define PHRASE_HOUR_NEXT  0x80000000UL
+#define PHRASE_HOUR_GLATT 0x40000000UL
+
+struct Sprache {
+    const word *woerter;
+    const uint32_t *phrasen;
+    const uint32_t (*stunden)[13];
+    uint32_t alarmWoerter;
+};
+
+#include "Woerter_DE.h"
+#include "Woerter_CH.h"
+#include "Woerter_EN.h"
+#include "Woerter_FR.h"
+#include "Woerter_IT.h"
+#include "Woerter_NL.h"
+#include "Woerter_ES.h"
+
+/**
+ * Die Sprachen in der Reihenfolge von LANGUAGE_* (Renderer.h).
+ */
+static const Sprache sprachen[] PROGMEM = {
+    {woerter_DE, phrasen_DE_DE, stunden_DE, W(DE_ESIST)},              // LANGUAGE_DE_DE
+    {woerter_DE, phrasen_DE_SW, stunden_DE, W(DE_ESIST)},              // LANGUAGE_DE_SW
+    {woerter_DE, phrasen_DE_BA, stunden_DE, W(DE_ESIST)},              // LANGUAGE_DE_BA
+    {woerter_DE, phrasen_DE_SA, stunden_DE, W(DE_ESIST)},              // LANGUAGE_DE_SA
+    {woerter_CH, phrasen_CH,    stunden_CH, W(CH_ESISCH)},             // LANGUAGE_CH
+    {woerter_EN, phrasen_EN,    stunden_EN, W(EN_ITIS)},               // LANGUAGE_EN
+    {woerter_FR, phrasen_FR,    stunden_FR, W(FR_ILEST)},              // LANGUAGE_FR
+    {woerter_IT, phrasen_IT,    stunden_IT, W(IT_SONOLE) | W(IT_E)},   // LANGUAGE_IT
+    {woerter_NL, phrasen_NL,    stunden_NL, W(NL_HETIS)},              // LANGUAGE_NL
+    {woerter_ES, phrasen_ES,    stunden_ES, W(ES_SONLAS) | W(ES_ESLA)} // LANGUAGE_ES
+};
+
+#endif
@@ -0,0 +1,38 @@
+/**
+ * StripLedDriver
+ * Die Gamma-Tabelle fuer LED_DRIVER_GAMMA. Sie wird wie die Verkabelungen
+ * (LedDriverLayouts.h) beim Kompilieren aus einer constexpr-Funktion erzeugt.
+ *
+ * @mc       Arduino/RBBB
+ * @autor    agent / agent _AT_ local
+ *           Vorlage von: Christian Aschoff / caschoff _AT_ mac _DOT_ com
+ * @version  1.0
+ * @created  18.10.2026
+ *
+ * Versionshistorie:
+ * V 1.0:  - Erstellt (Gamma-Tabelle fuer LED_DRIVER_GAMMA).
+ */
+#include "StripLedDriver.h"
+
+#ifdef LED_DRIVER_GAMMA
+/**
+ * Gamma ca. 2.2, angenaehert als 0.8 * x^2 + 0.2 * x^3 (x = 0..1), skaliert auf 0-65535.
+ * Ohne Fliesskomma und exakt 0 bei 0 und 65535 bei 255.
+ */
+constexpr word stripGammaValue(word x) {
+    return (word)(((uint64_t)x * x * (4 * 255 + x) * 65535) / (255ULL * 255 * 255 * 5));
+}
+
+#define STRIP_GAMMA_ROW(n) \
+    stripGammaValue((n) + 0), stripGammaValue((n) + 1), stripGammaValue((n) + 2), stripGammaValue((n) + 3), \
+    stripGammaValue((n) + 4), stripGammaValue((n) + 5), stripGammaValue((n) + 6), stripGammaValue((n) + 7), \
+    stripGammaValue((n) + 8), stripGammaValue((n) + 9), stripGammaValue((n) + 10), stripGammaValue((n) + 11), \
+    stripGammaValue((n) + 12), stripGammaValue((n) + 13), stripGammaValue((n) + 14), stripGammaValue((n) + 15)
+
+const word stripGamma[256] PROGMEM = {
+    STRIP_GAMMA_ROW(0), STRIP_GAMMA_ROW(16), STRIP_GAMMA_ROW(32), STRIP_GAMMA_ROW(48),
+    STRIP_GAMMA_ROW(64), STRIP_GAMMA_ROW(80), STRIP_GAMMA_ROW(96), STRIP_GAMMA_ROW(112),
+    STRIP_GAMMA_ROW(128), STRIP_GAMMA_ROW(144), STRIP_GAMMA_ROW(160), STRIP_GAMMA_ROW(176),
+    STRIP_GAMMA_ROW(192), STRIP_GAMMA_ROW(208), STRIP_GAMMA_ROW(224), STRIP_GAMMA_ROW(240)
+};
+#endif
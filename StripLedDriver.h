@@ -0,0 +1,567 @@
+/**
+ * StripLedDriver
+ * Gemeinsame Basis fuer die LED-Stripes (NeoPixel, DotStar, LPD8806).
+ * Die Treiber unterscheiden sich nur in der Klasse des Streifens, der
+ * Verkabelung (Tabelle aus LedDriverLayouts.h), der Reihenfolge der Farben
+ * und der Farbtiefe. Das sind hier Template-Parameter, die Zeichen-Schleife
+ * gibt es damit nur einmal und die Farbreihenfolge wird schon beim Kompilieren
+ * aufgeloest.
+ *
+ * Die Treiber erben hiervon, legen im Konstruktor _strip an und implementieren
+ * printSignature().
+ *
+ * Template-Parameter:
+ * Strip      - die Klasse des Streifens (Adafruit_NeoPixel, Adafruit_DotStar, LPD8806).
+ * Layout     - die Verkabelung im PROGMEM (Pixel-Index -> Position im Streifen).
+ * ColorOrder - STRIP_COLOR_RGB oder STRIP_COLOR_RBG (Reihenfolge fuer Strip::Color()).
+ * Depth      - die Bits pro Farbe (8, LPD8806: 7).
+ *
+ * @mc       Arduino/RBBB
+ * @autor    agent / agent _AT_ local
+ *           Vorlage von: Christian Aschoff / caschoff _AT_ mac _DOT_ com
+ * @version  1.2
+ * @created  18.10.2026
+ * @updated  18.10.2026
+ *
+ * Versionshistorie:
+ * V 1.0:  - Erstellt aus LedDriverNeoPixel, LedDriverDotStar und LedDriverLPD8806.
+ * V 1.1:  - Optional Gamma-Korrektur, Weissabgleich, 16-Bit-Helligkeit und zeitliches Dithering (LED_DRIVER_GAMMA).
+ *         - Weissabgleich als Konstante statt als Tabelle im RAM, Dither-Zustand in init() gesetzt.
+ * V 1.2:  - Optionale Begrenzung der Helligkeit auf ein Strom-Budget (LED_DRIVER_CURRENT_LIMIT).
+ *         - Strom-Begrenzung mit dem Anteil, den der Streifen selbst zulaesst (_setCurrentScale()), Zaehler in init() gesetzt.
+ */
+#ifndef STRIP_LED_DRIVER_H
+#define STRIP_LED_DRIVER_H
+
+#include "Arduino.h"
+#include "LedDriver.h"
+
+/**
+ * Die Reihenfolge, in der die Farben an Strip::Color() gehen.
+ */
+#define STRIP_COLOR_RGB 0
+#define STRIP_COLOR_RBG 1
+
+#ifdef LED_DRIVER_GAMMA
+/**
+ * Die Gamma-Kurve: Farbwert (0-255) -> linearer Wert (0-65535), siehe StripLedDriver.cpp.
+ */
+extern const word stripGamma[256] PROGMEM;
+
+/**
+ * Die Farbplaetze, fuer die Stufen vorberechnet werden.
+ */
+#ifdef LED_DRIVER_PALETTE
+#define STRIP_SLOTS LED_DRIVER_PALETTE_SIZE
+#else
+#define STRIP_SLOTS 1
+#endif
+
+/**
+ * Das Dithering hat 4 Phasen, vom Rest unter einer Stufe bleiben also 2 Bit.
+ */
+#define STRIP_DITHER_PHASES 4
+#endif
+
+template <class Strip, const byte *Layout, byte ColorOrder, byte Depth>
+class StripLedDriver : public LedDriver {
+public:
+    void init();
+
+    void writeScreenBufferToMatrix(word matrix[16], boolean onChange);
+
+    void setBrightness(byte brightnessInPercent);
+    byte getBrightness();
+
+    void setLinesToWrite(byte linesToWrite);
+
+    void shutDown();
+    void wakeUp();
+
+    void clearData();
+
+protected:
+    Strip *_strip;
+
+    uint32_t _color(byte red, byte green, byte blue);
+    uint32_t _wheel(byte wheelPos);
+
+#ifdef LED_DRIVER_CURRENT_LIMIT
+    void _setCurrentScale(byte currentScale);
+#endif
+
+private:
+    byte _brightnessInPercent;
+
+    boolean _dirty;
+
+    byte _scaledBrightness();
+    byte _brightnessScaleColor(byte colorPart);
+    uint32_t _pixelColor(uint32_t color, byte index);
+
+    void _clear();
+
+#ifdef LED_DRIVER_CURRENT_LIMIT
+    // Die eingeschalteten LEDs pro Zeile (Buchstaben und die Ecke der Zeile) und insgesamt.
+    byte _rowLitPixels[LED_DRIVER_ROWS];
+    byte _litPixels;
+    // Die hellste Farbe (R + G + B, 0-765, ohne Helligkeit) aller Farbplaetze.
+    word _colorLoad;
+    // Die hoechste Helligkeit, die noch in das Budget passt.
+    byte _brightnessLimit;
+    // Der Anteil des Stroms, den der Streifen selbst noch zulaesst (0-31, DotStar: das Helligkeitsfeld).
+    byte _currentScale;
+
+    void _updateColorLoad();
+    void _updateLitPixels(word changedRows, word matrix[16]);
+    boolean _limitBrightness();
+#endif
+
+#ifdef LED_DRIVER_GAMMA
+    // Pro Farbplatz und Farbe (R, G, B): die Stufe des Streifens und der Rest darunter (0-3).
+    byte _levels[STRIP_SLOTS][3];
+    byte _remainders[STRIP_SLOTS][3];
+    // Die fertigen Farben der Farbplaetze in der aktuellen Dither-Phase.
+    uint32_t _slotColors[STRIP_SLOTS];
+
+    boolean _dithering;
+    byte _ditherPhase;
+    unsigned long _lastDitherMillis;
+
+    void _buildLevels();
+    boolean _buildSlotColors();
+    byte _ditheredLevel(byte slot, byte channel);
+#elif defined(LED_DRIVER_PALETTE)
+    uint32_t _scaledPalette[LED_DRIVER_PALETTE_SIZE];
+
+    void _scalePalette();
+#endif
+};
+
+/**
+ * init() wird im Hauptprogramm in init() aufgerufen.
+ * Hier sollten die LED-Treiber in eine definierten
+ * Ausgangszustand gebracht werden.
+ */
+template <class Strip, const byte *Layout, byte ColorOrder, byte Depth>
+void StripLedDriver<Strip, Layout, ColorOrder, Depth>::init() {
+#ifdef LED_DRIVER_INTENSITY
+    setAllIntensities(255);
+#endif
+#ifdef LED_DRIVER_CURRENT_LIMIT
+    _brightnessLimit = 100;
+    _currentScale = 31;
+    memset(_rowLitPixels, 0, sizeof(_rowLitPixels));
+    _litPixels = 0;
+    _colorLoad = 0;
+#endif
+#ifdef LED_DRIVER_GAMMA
+    _dithering = false;
+    _ditherPhase = 0;
+    _lastDitherMillis = millis();
+#endif
+    setBrightness(50);
+    clearData();
+    wakeUp();
+}
+
+/**
+ * Den Bildschirm-Puffer auf die LED-Matrix schreiben.
+ *
+ * @param onChange: TRUE, wenn es Aenderungen in dem Bildschirm-Puffer gab,
+ *                  FALSE, wenn es ein Refresh-Aufruf war.
+ */
+template <class Strip, const byte *Layout, byte ColorOrder, byte Depth>
+void StripLedDriver<Strip, Layout, ColorOrder, Depth>::writeScreenBufferToMatrix(word matrix[16], boolean onChange) {
+    boolean ditherStep = false;
+#ifdef LED_DRIVER_GAMMA
+    if (_dithering && _isLastMatrixValid() && (millis() - _lastDitherMillis >= LED_DRIVER_DITHER_MILLIS)) {
+        // naechste Dither-Phase, aendern sich dabei Farben, alle Pixel neu (ohne neue Tabellen)...
+        _lastDitherMillis = millis();
+        _ditherPhase = (_ditherPhase + 1) & (STRIP_DITHER_PHASES - 1);
+        if (_buildSlotColors()) {
+            ditherStep = true;
+            _invalidateLastMatrix();
+        }
+    }
+#endif
+    if (onChange || _dirty || ditherStep) {
+        if (_dirty) {
+            // neue Helligkeit, also alle Pixel neu...
+            _dirty = false;
+            _invalidateLastMatrix();
+            ditherStep = false;
+        }
+
+        // nur die Pixel schreiben, die sich geaendert haben...
+        word changedRows = _getChangedRows(matrix);
+        if (changedRows == 0) {
+            return;
+        }
+
+#ifdef LED_DRIVER_CURRENT_LIMIT
+        if (!_isLastMatrixValid()) {
+            _updateColorLoad();
+        }
+        _updateLitPixels(changedRows, matrix);
+        if (_limitBrightness()) {
+            // zu viel (oder wieder genug) Strom, also alle Pixel mit neuer Helligkeit...
+            _invalidateLastMatrix();
+            changedRows = _getChangedRows(matrix);
+            ditherStep = false;
+        }
+#endif
+
+#ifdef LED_DRIVER_GAMMA
+        if (!_isLastMatrixValid() && !ditherStep) {
+            // neue Farben oder Helligkeit, also die Tabellen neu...
+            _buildLevels();
+            _buildSlotColors();
+        }
+        uint32_t color = _slotColors[0];
+#else
+        uint32_t color = _color(_brightnessScaleColor(getRed()), _brightnessScaleColor(getGreen()), _brightnessScaleColor(getBlue()));
+#ifdef LED_DRIVER_PALETTE
+        if (!_isLastMatrixValid()) {
+            // neue Farben oder Helligkeit, also die Palette neu skalieren...
+            _scalePalette();
+        }
+#endif
+#endif
+
+        for (byte y = 0; y < 10; y++) {
+            if ((changedRows & (1 << y)) == 0) {
+                continue;
+            }
+            // die geaenderten Buchstaben (Bits 15-5) von links ablaufen, bis keiner mehr uebrig ist...
+            word changedPixels = _getChangedPixels(y, matrix) & 0b1111111111100000;
+            word pixels = matrix[y];
+            for (byte num = y * 11; changedPixels != 0; num++, changedPixels <<= 1, pixels <<= 1) {
+                if (changedPixels & 0b1000000000000000) {
+                    _strip->setPixelColor(pgm_read_byte_near(&Layout[num]), (pixels & 0b1000000000000000) ? _pixelColor(color, num) : 0);
+                }
+            }
+        }
+
+        // wir muessen die Eck-LEDs umsetzten (Ecke 1, 2, 3, 4 steht in Zeile 1, 0, 3, 2)...
+        for (byte i = 0; i < 4; i++) {
+            byte y = i ^ 1;
+            if ((changedRows & (1 << y)) && (_getChangedPixels(y, matrix) & 0b0000000000011111)) {
+                _strip->setPixelColor(pgm_read_byte_near(&Layout[LED_DRIVER_PIXEL_CORNERS + i]), ((matrix[y] & 0b0000000000011111) == 0b0000000000011111) ? _pixelColor(color, LED_DRIVER_PIXEL_CORNERS + i) : 0);
+            }
+        }
+
+        _storeLastMatrix(matrix);
+        _strip->show();
+    }
+}
+
+/**
+ * Die Helligkeit des Displays anpassen.
+ *
+ * @param brightnessInPercent Die Helligkeit.
+ */
+template <class Strip, const byte *Layout, byte ColorOrder, byte Depth>
+void StripLedDriver<Strip, Layout, ColorOrder, Depth>::setBrightness(byte brightnessInPercent) {
+    if (brightnessInPercent != _brightnessInPercent) {
+        _brightnessInPercent = brightnessInPercent;
+        _dirty = true;
+    }
+}
+
+/**
+ * Die aktuelle Helligkeit bekommen.
+ */
+template <class Strip, const byte *Layout, byte ColorOrder, byte Depth>
+byte StripLedDriver<Strip, Layout, ColorOrder, Depth>::getBrightness() {
+    return _brightnessInPercent;
+}
+
+/**
+ * Anpassung der Groesse des Bildspeichers.
+ *
+ * @param linesToWrite Wieviel Zeilen aus dem Bildspeicher sollen
+ *                     geschrieben werden?
+ */
+template <class Strip, const byte *Layout, byte ColorOrder, byte Depth>
+void StripLedDriver<Strip, Layout, ColorOrder, Depth>::setLinesToWrite(byte linesToWrite) {
+}
+
+/**
+ * Das Display ausschalten.
+ */
+template <class Strip, const byte *Layout, byte ColorOrder, byte Depth>
+void StripLedDriver<Strip, Layout, ColorOrder, Depth>::shutDown() {
+    _clear();
+    _strip->show();
+    _invalidateLastMatrix();
+}
+
+/**
+ * Das Display einschalten.
+ */
+template <class Strip, const byte *Layout, byte ColorOrder, byte Depth>
+void StripLedDriver<Strip, Layout, ColorOrder, Depth>::wakeUp() {
+}
+
+/**
+ * Den Dateninhalt des LED-Treibers loeschen.
+ */
+template <class Strip, const byte *Layout, byte ColorOrder, byte Depth>
+void StripLedDriver<Strip, Layout, ColorOrder, Depth>::clearData() {
+    _clear();
+    _strip->show();
+    _invalidateLastMatrix();
+}
+
+/**
+ * Eine Farbe fuer den Streifen, in seiner Reihenfolge (LPD8806: R, B, G).
+ * ColorOrder ist eine Konstante, die Abfrage faellt beim Kompilieren weg.
+ */
+template <class Strip, const byte *Layout, byte ColorOrder, byte Depth>
+uint32_t StripLedDriver<Strip, Layout, ColorOrder, Depth>::_color(byte red, byte green, byte blue) {
+    if (ColorOrder == STRIP_COLOR_RBG) {
+        return _strip->Color(red, blue, green);
+    }
+    return _strip->Color(red, green, blue);
+}
+
+/**
+ * Funktion fuer saubere 'Regenbogen'-Farben.
+ * Kopiert aus den Adafruit-Beispielen (strand).
+ */
+template <class Strip, const byte *Layout, byte ColorOrder, byte Depth>
+uint32_t StripLedDriver<Strip, Layout, ColorOrder, Depth>::_wheel(byte wheelPos) {
+    if (wheelPos < 85) {
+        return _color(wheelPos * 3, 255 - wheelPos * 3, 0);
+    } else if (wheelPos < 170) {
+        wheelPos -= 85;
+        return _color(255 - wheelPos * 3, 0, wheelPos * 3);
+    } else {
+        wheelPos -= 170;
+        return _color(0, wheelPos * 3, 255 - wheelPos * 3);
+    }
+}
+
+/**
+ * Die Helligkeit, mit der die Farben skaliert werden (mit LED_DRIVER_CURRENT_LIMIT
+ * hoechstens die Helligkeit, die in das Strom-Budget passt).
+ */
+template <class Strip, const byte *Layout, byte ColorOrder, byte Depth>
+byte StripLedDriver<Strip, Layout, ColorOrder, Depth>::_scaledBrightness() {
+#ifdef LED_DRIVER_CURRENT_LIMIT
+    return min(_brightnessInPercent, _brightnessLimit);
+#else
+    return _brightnessInPercent;
+#endif
+}
+
+/**
+ * Hilfsfunktion fuer das Skalieren der Farben (LPD8806 kann nur 7 bit Farben,
+ * also 0..127, nicht 0..255).
+ */
+template <class Strip, const byte *Layout, byte ColorOrder, byte Depth>
+byte StripLedDriver<Strip, Layout, ColorOrder, Depth>::_brightnessScaleColor(byte colorPart) {
+    return map(_scaledBrightness(), 0, 100, 0, colorPart >> (8 - Depth));
+}
+
+/**
+ * Die Farbe eines eingeschalteten Pixels (index ist der Pixel-Index wie in LedDriverLayouts.h).
+ * Ohne LED_DRIVER_PALETTE und LED_DRIVER_INTENSITY ist das einfach die schon
+ * berechnete Farbe, sonst die Farbe seines Farbplatzes mit seiner Intensitaet.
+ */
+template <class Strip, const byte *Layout, byte ColorOrder, byte Depth>
+uint32_t StripLedDriver<Strip, Layout, ColorOrder, Depth>::_pixelColor(uint32_t color, byte index) {
+#ifdef LED_DRIVER_PALETTE
+    byte slot = _getPaletteSlot(index);
+#ifdef LED_DRIVER_GAMMA
+    color = _slotColors[slot];
+#else
+    color = _scaledPalette[slot];
+#endif
+#endif
+#ifdef LED_DRIVER_INTENSITY
+    byte intensity = _getIntensity(index);
+    if (intensity != 255) {
+#ifndef LED_DRIVER_PALETTE
+        byte slot = 0;
+#endif
+#ifdef LED_DRIVER_GAMMA
+        return _color(_scaleIntensity(_ditheredLevel(slot, 0), intensity), _scaleIntensity(_ditheredLevel(slot, 1), intensity), _scaleIntensity(_ditheredLevel(slot, 2), intensity));
+#else
+        return _color(_scaleIntensity(_brightnessScaleColor(getPaletteRed(slot)), intensity), _scaleIntensity(_brightnessScaleColor(getPaletteGreen(slot)), intensity), _scaleIntensity(_brightnessScaleColor(getPaletteBlue(slot)), intensity));
+#endif
+    }
+#endif
+    return color;
+}
+
+/**
+ * Streifen loeschen (auch die dunklen LEDs am Rand).
+ */
+template <class Strip, const byte *Layout, byte ColorOrder, byte Depth>
+void StripLedDriver<Strip, Layout, ColorOrder, Depth>::_clear() {
+    for (uint16_t i = 0; i < _strip->numPixels(); i++) {
+        _strip->setPixelColor(i, 0);
+    }
+}
+
+#ifdef LED_DRIVER_CURRENT_LIMIT
+/**
+ * Die hellste Farbe aller Farbplaetze (R + G + B) fuer die Abschaetzung des
+ * Stroms merken. Passiert nur, wenn alle Pixel neu geschrieben werden. Die
+ * Intensitaeten werden nicht beruecksichtigt, die Abschaetzung liegt also eher zu hoch.
+ */
+template <class Strip, const byte *Layout, byte ColorOrder, byte Depth>
+void StripLedDriver<Strip, Layout, ColorOrder, Depth>::_updateColorLoad() {
+    _colorLoad = 0;
+#ifdef LED_DRIVER_PALETTE
+    for (byte slot = 0; slot < LED_DRIVER_PALETTE_SIZE; slot++) {
+#else
+    for (byte slot = 0; slot < 1; slot++) {
+#endif
+#ifdef LED_DRIVER_GAMMA
+        // mit Gamma-Korrektur zaehlt der lineare Wert...
+        word load = (pgm_read_word_near(&stripGamma[getPaletteRed(slot)]) >> 8) + (pgm_read_word_near(&stripGamma[getPaletteGreen(slot)]) >> 8) + (pgm_read_word_near(&stripGamma[getPaletteBlue(slot)]) >> 8);
+#else
+        word load = getPaletteRed(slot) + getPaletteGreen(slot) + getPaletteBlue(slot);
+#endif
+        if (load > _colorLoad) {
+            _colorLoad = load;
+        }
+    }
+}
+
+/**
+ * Die eingeschalteten LEDs nur in den geaenderten Zeilen neu zaehlen und die
+ * Summe um die Differenz korrigieren.
+ */
+template <class Strip, const byte *Layout, byte ColorOrder, byte Depth>
+void StripLedDriver<Strip, Layout, ColorOrder, Depth>::_updateLitPixels(word changedRows, word matrix[16]) {
+    for (byte y = 0; y < LED_DRIVER_ROWS; y++) {
+        if ((changedRows & (1 << y)) == 0) {
+            continue;
+        }
+        byte lit = __builtin_popcount(matrix[y] & 0b1111111111100000);
+        // die Ecken stehen in den Zeilen 0-3...
+        if ((y < 4) && ((matrix[y] & 0b0000000000011111) == 0b0000000000011111)) {
+            lit++;
+        }
+        _litPixels += lit - _rowLitPixels[y];
+        _rowLitPixels[y] = lit;
+    }
+}
+
+/**
+ * Den Strom abschaetzen (LED_DRIVER_MA_PER_CHANNEL pro Farbe bei voller Stufe,
+ * mal _currentScale / 31) und die Helligkeit so begrenzen, dass er unter
+ * LED_DRIVER_CURRENT_BUDGET_MA bleibt.
+ *
+ * @return TRUE, wenn sich die Helligkeit der Farben dadurch aendert.
+ */
+template <class Strip, const byte *Layout, byte ColorOrder, byte Depth>
+boolean StripLedDriver<Strip, Layout, ColorOrder, Depth>::_limitBrightness() {
+    byte before = _scaledBrightness();
+    // Strom bei 100% in mA * 25500 * 31 (255 pro Farbe, 100 Prozent, 31 fuer das Feld),
+    // das Budget passt so bis ca. 5400 mA in 32 Bit...
+    uint32_t load = (uint32_t)_litPixels * _colorLoad * LED_DRIVER_MA_PER_CHANNEL * _currentScale;
+    _brightnessLimit = 100;
+    if (load != 0) {
+        uint32_t limit = (uint32_t)LED_DRIVER_CURRENT_BUDGET_MA * 25500 * 31 / load;
+        if (limit < 100) {
+            _brightnessLimit = limit;
+        }
+    }
+    return _scaledBrightness() != before;
+}
+
+/**
+ * Der Streifen laesst nur noch currentScale / 31 des Stroms durch (DotStar:
+ * das Helligkeitsfeld). Die Begrenzung wird sofort neu gerechnet, aendert
+ * sich dadurch die Helligkeit der Farben, werden alle Pixel neu geschrieben.
+ */
+template <class Strip, const byte *Layout, byte ColorOrder, byte Depth>
+void StripLedDriver<Strip, Layout, ColorOrder, Depth>::_setCurrentScale(byte currentScale) {
+    if (currentScale != _currentScale) {
+        _currentScale = currentScale;
+        if (_limitBrightness()) {
+            _dirty = true;
+        }
+    }
+}
+#endif
+
+#ifdef LED_DRIVER_GAMMA
+/**
+ * Die Tabellen fuer alle Farbplaetze neu berechnen (nur bei neuen Farben oder
+ * neuer Helligkeit): Gamma-Kurve, Weissabgleich und Helligkeit (16 Bit) ergeben
+ * einen linearen Wert, davon die oberen Depth Bit die Stufe und die 2 Bit darunter
+ * den Rest fuer das Dithering. Dithering gibt es nur im unteren Achtel, darueber
+ * faellt eine Stufe nicht auf.
+ */
+template <class Strip, const byte *Layout, byte ColorOrder, byte Depth>
+void StripLedDriver<Strip, Layout, ColorOrder, Depth>::_buildLevels() {
+    uint32_t brightness = (uint32_t)_scaledBrightness() * 65535 / 100;
+
+    _dithering = false;
+    for (byte slot = 0; slot < STRIP_SLOTS; slot++) {
+        byte colorParts[3] = {getPaletteRed(slot), getPaletteGreen(slot), getPaletteBlue(slot)};
+        for (byte channel = 0; channel < 3; channel++) {
+            // der Weissabgleich als Konstante statt als Tabelle im RAM (bei 255 ueberall wird daraus ein Shift)...
+            word whiteBalance = (channel == 0) ? (LED_DRIVER_WHITE_BALANCE_RED + 1) : ((channel == 1) ? (LED_DRIVER_WHITE_BALANCE_GREEN + 1) : (LED_DRIVER_WHITE_BALANCE_BLUE + 1));
+            uint32_t linear = ((uint32_t)pgm_read_word_near(&stripGamma[colorParts[channel]]) * whiteBalance) >> 8;
+            linear = (linear * brightness) >> 16;
+            _levels[slot][channel] = linear >> (16 - Depth);
+            if (_levels[slot][channel] < (1 << (Depth - 3))) {
+                _remainders[slot][channel] = (linear >> (14 - Depth)) & 0b11;
+                _dithering |= (_remainders[slot][channel] != 0);
+            } else {
+                _remainders[slot][channel] = 0;
+            }
+        }
+    }
+}
+
+/**
+ * Die Farben der Farbplaetze fuer die aktuelle Dither-Phase zusammensetzen.
+ *
+ * @return TRUE, wenn sich eine Farbe geaendert hat.
+ */
+template <class Strip, const byte *Layout, byte ColorOrder, byte Depth>
+boolean StripLedDriver<Strip, Layout, ColorOrder, Depth>::_buildSlotColors() {
+    boolean changed = false;
+    for (byte slot = 0; slot < STRIP_SLOTS; slot++) {
+        uint32_t color = _color(_ditheredLevel(slot, 0), _ditheredLevel(slot, 1), _ditheredLevel(slot, 2));
+        if (color != _slotColors[slot]) {
+            _slotColors[slot] = color;
+            changed = true;
+        }
+    }
+    return changed;
+}
+
+/**
+ * Die Stufe einer Farbe in der aktuellen Dither-Phase: bei einem Rest von r
+ * in r der 4 Phasen eine Stufe hoeher. Die Phasen laufen in der Reihenfolge
+ * 0, 2, 1, 3 (Bits vertauscht), bei einem Rest von 2 wechselt die Stufe also
+ * in jeder Phase.
+ */
+template <class Strip, const byte *Layout, byte ColorOrder, byte Depth>
+byte StripLedDriver<Strip, Layout, ColorOrder, Depth>::_ditheredLevel(byte slot, byte channel) {
+    byte order = ((_ditherPhase & 0b01) << 1) | (_ditherPhase >> 1);
+    return _levels[slot][channel] + ((order < _remainders[slot][channel]) ? 1 : 0);
+}
+#elif defined(LED_DRIVER_PALETTE)
+/**
+ * Die Palette auf die aktuelle Helligkeit skalieren. Passiert nur, wenn
+ * alle Pixel neu geschrieben werden (neue Farben, neue Helligkeit).
+ */
+template <class Strip, const byte *Layout, byte ColorOrder, byte Depth>
+void StripLedDriver<Strip, Layout, ColorOrder, Depth>::_scalePalette() {
+    for (byte i = 0; i < LED_DRIVER_PALETTE_SIZE; i++) {
+        _scaledPalette[i] = _color(_brightnessScaleColor(getPaletteRed(i)), _brightnessScaleColor(getPaletteGreen(i)), _brightnessScaleColor(getPaletteBlue(i)));
+    }
+}
+#endif
+
+#endif
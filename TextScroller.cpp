@@ -0,0 +1,224 @@
+/**
+ * TextScroller
+ * Nicht blockierender Lauftext fuer Texte, die nicht auf vier Staben passen
+ * (Ereignisse, Statusmeldungen wie "SYNC OK", Fehlercodes).
+ * Der Text wird zeichenweise in einen Spaltenstrom aus dem Zeichen-Atlas
+ * (Schriften.h: Staben A-Z, kleine oder grosse Ziffern) umgesetzt. Jede
+ * Zeile steht in einem 32-Bit-Schieberegister: ein neues Zeichen wird rechts hineingeschoben
+ * (Shift + OR), sichtbar sind die 11 Spalten links davon. Ein Schritt schiebt
+ * um eine Spalte und schreibt nur die Zeilen des Textes in den Bildspeicher.
+ * Die Schritte werden ueber millis() getaktet aus loop() heraus aufgerufen,
+ * der Lauftext kann also jederzeit unterbrochen werden und blockiert dcf77.poll() nicht.
+ * Die Dauer der Schritte wird mitgemessen (getLastStepMicros(), getMaxStepMicros()).
+ *
+ * @mc       Arduino/RBBB
+ * @autor    agent / agent _AT_ local
+ *           Vorlage von: Christian Aschoff / caschoff _AT_ mac _DOT_ com
+ * @version  1.1
+ * @created  18.10.2026
+ *
+ * Versionshistorie:
+ * V 1.0:  - Erstellt.
+ * V 1.1:  - Zeichen ueber Renderer::getCharRows() aus dem Zeichen-Atlas.
+ */
+#include "TextScroller.h"
+
+// #define DEBUG
+#include "Debug.h"
+
+// Breite eines Leerzeichens (und unbekannter Zeichen) in Spalten.
+#define TEXT_SCROLLER_SPACE_WIDTH 2
+
+// Am Ende laeuft der Text einmal ganz aus der Anzeige heraus.
+#define TEXT_SCROLLER_TAIL_WIDTH 11
+
+TextScroller::TextScroller() {
+    _running = false;
+    _columnMillis = TEXT_SCROLLER_COLUMN_MILLIS;
+    _maxStepMicros = 0;
+    _lastStepMicros = 0;
+}
+
+/**
+ * Einen Lauftext starten. Der Bildspeicher wird dabei nicht veraendert,
+ * der Aufrufer loescht ihn vorher, wenn nur der Text zu sehen sein soll.
+ *
+ * @param text Der Text (A-Z, a-z, 0-9 und Leerzeichen, andere Zeichen werden
+ *             zu Leerzeichen). Der Text wird nicht kopiert und muss bis zum
+ *             Ende des Lauftextes erhalten bleiben.
+ * @param posy Die oberste Zeile des Textes.
+ * @param largeDigits TRUE: SCHRIFT_ZIFFERN (7 Zeilen hoch, die Buchstaben
+ *                    stehen mittig), FALSE: SCHRIFT_ZIFFERN_KLEIN (5 Zeilen).
+ * @param loop TRUE, wenn der Text immer wieder von vorne laufen soll.
+ */
+void TextScroller::begin(const char *text, byte posy, boolean largeDigits, boolean loop) {
+    _text = text;
+    _index = 0;
+    _posy = posy;
+    _largeDigits = largeDigits;
+    _height = largeDigits ? 7 : 5;
+    _loop = loop;
+    _tail = false;
+
+    // von rechts in eine leere Zeile hineinlaufen...
+    for (byte r = 0; r < TEXT_SCROLLER_MAX_HEIGHT; r++) {
+        _rows[r] = 0;
+    }
+    _pending = 0;
+
+    _running = (_text[0] != 0) && (_posy + _height <= 10);
+    // der erste Schritt kommt sofort...
+    _lastStepMillis = millis() - _columnMillis;
+}
+
+/**
+ * Um eine Spalte weiterschieben, falls es Zeit dafuer ist.
+ *
+ * @param matrix Der Bildspeicher, in dessen Textzeilen geschrieben wird.
+ * @return TRUE, wenn sich der Bildspeicher geaendert hat.
+ */
+boolean TextScroller::step(word matrix[16]) {
+    if (!_running || (millis() - _lastStepMillis < _columnMillis)) {
+        return false;
+    }
+    unsigned long start = micros();
+    _lastStepMillis += _columnMillis;
+
+    if ((_pending == 0) && !_feed()) {
+        // fertig, der Text ist ganz herausgelaufen...
+        _running = false;
+        return false;
+    }
+    _pending--;
+
+    // sichtbar sind die 11 Spalten links von den noch wartenden...
+    for (byte r = 0; r < _height; r++) {
+        word visible = (_rows[r] >> _pending) & 0b0000011111111111;
+        matrix[_posy + r] = (matrix[_posy + r] & 0b0000000000011111) | (visible << 5);
+    }
+
+    _lastStepMicros = micros() - start;
+    if (_lastStepMicros > _maxStepMicros) {
+        _maxStepMicros = _lastStepMicros;
+    }
+    return true;
+}
+
+/**
+ * Den Lauftext abbrechen (z.B. bei einem Moduswechsel).
+ */
+void TextScroller::cancel() {
+    _running = false;
+}
+
+boolean TextScroller::isRunning() {
+    return _running;
+}
+
+/**
+ * Die Geschwindigkeit: Millisekunden pro Spalte.
+ */
+void TextScroller::setColumnMillis(unsigned int columnMillis) {
+    _columnMillis = columnMillis;
+}
+
+/**
+ * Die Dauer des letzten Schrittes in Mikrosekunden.
+ */
+unsigned int TextScroller::getLastStepMicros() {
+    return _lastStepMicros;
+}
+
+/**
+ * Die Dauer des laengsten Schrittes in Mikrosekunden.
+ */
+unsigned int TextScroller::getMaxStepMicros() {
+    return _maxStepMicros;
+}
+
+void TextScroller::resetMaxStepMicros() {
+    _maxStepMicros = 0;
+}
+
+/**
+ * Das naechste Zeichen (oder die Luecke am Ende) rechts in die Zeilen schieben.
+ *
+ * @return FALSE, wenn der Text zu Ende ist.
+ */
+boolean TextScroller::_feed() {
+    byte glyph[TEXT_SCROLLER_MAX_HEIGHT];
+    byte width;
+
+    if (_text[_index] != 0) {
+        width = _loadGlyph(_text[_index], glyph);
+        _index++;
+    } else if (!_tail) {
+        // den Text aus der Anzeige herauslaufen lassen...
+        for (byte r = 0; r < TEXT_SCROLLER_MAX_HEIGHT; r++) {
+            glyph[r] = 0;
+        }
+        width = TEXT_SCROLLER_TAIL_WIDTH;
+        _tail = true;
+    } else if (_loop) {
+        _index = 0;
+        _tail = false;
+        width = _loadGlyph(_text[_index], glyph);
+        _index++;
+    } else {
+        return false;
+    }
+
+    for (byte r = 0; r < _height; r++) {
+        _rows[r] = (_rows[r] << width) | glyph[r];
+    }
+    _pending = width;
+    return true;
+}
+
+/**
+ * Die Pixel eines Zeichens holen, schmal zugeschnitten und mit einer
+ * leeren Spalte rechts als Abstand zum naechsten Zeichen.
+ *
+ * @param glyph Die Zeilen des Zeichens, Bit 0 ist die rechte Spalte.
+ * @return Die Breite in Spalten (inklusive Abstand).
+ */
+byte TextScroller::_loadGlyph(char c, byte glyph[TEXT_SCROLLER_MAX_HEIGHT]) {
+    for (byte r = 0; r < TEXT_SCROLLER_MAX_HEIGHT; r++) {
+        glyph[r] = 0;
+    }
+
+    if ((c >= 'a') && (c <= 'z')) {
+        c -= 'a' - 'A';
+    }
+    if ((c >= 'A') && (c <= 'Z')) {
+        // Buchstaben sind 5 Zeilen hoch, bei den grossen Ziffern mittig...
+        _renderer.getCharRows(SCHRIFT_STABEN, c, &glyph[_largeDigits ? 1 : 0]);
+    } else if ((c >= '0') && (c <= '9')) {
+        _renderer.getCharRows(_largeDigits ? SCHRIFT_ZIFFERN : SCHRIFT_ZIFFERN_KLEIN, c, glyph);
+    } else {
+        return TEXT_SCROLLER_SPACE_WIDTH + 1;
+    }
+
+    // die belegten Spalten bestimmen und das Zeichen nach rechts schieben...
+    byte columns = 0;
+    for (byte r = 0; r < _height; r++) {
+        columns |= glyph[r];
+    }
+    if (columns == 0) {
+        return TEXT_SCROLLER_SPACE_WIDTH + 1;
+    }
+    byte shift = 0;
+    while ((columns & 1) == 0) {
+        columns >>= 1;
+        shift++;
+    }
+    byte width = 0;
+    while (columns != 0) {
+        columns >>= 1;
+        width++;
+    }
+    for (byte r = 0; r < _height; r++) {
+        glyph[r] = (glyph[r] >> shift) << 1;
+    }
+    return width + 1;
+}
@@ -0,0 +1,76 @@
+/**
+ * TextScroller
+ * Nicht blockierender Lauftext fuer Texte, die nicht auf vier Staben passen
+ * (Ereignisse, Statusmeldungen wie "SYNC OK", Fehlercodes).
+ * Der Text wird zeichenweise in einen Spaltenstrom aus dem Zeichen-Atlas
+ * (Schriften.h: Staben A-Z, kleine oder grosse Ziffern) umgesetzt. Jede
+ * Zeile steht in einem 32-Bit-Schieberegister: ein neues Zeichen wird rechts hineingeschoben
+ * (Shift + OR), sichtbar sind die 11 Spalten links davon. Ein Schritt schiebt
+ * um eine Spalte und schreibt nur die Zeilen des Textes in den Bildspeicher.
+ * Die Schritte werden ueber millis() getaktet aus loop() heraus aufgerufen,
+ * der Lauftext kann also jederzeit unterbrochen werden und blockiert dcf77.poll() nicht.
+ * Die Dauer der Schritte wird mitgemessen (getLastStepMicros(), getMaxStepMicros()).
+ *
+ * @mc       Arduino/RBBB
+ * @autor    agent / agent _AT_ local
+ *           Vorlage von: Christian Aschoff / caschoff _AT_ mac _DOT_ com
+ * @version  1.1
+ * @created  18.10.2026
+ *
+ * Versionshistorie:
+ * V 1.0:  - Erstellt.
+ * V 1.1:  - Zeichen ueber Renderer::getCharRows() aus dem Zeichen-Atlas.
+ */
+#ifndef TEXTSCROLLER_H
+#define TEXTSCROLLER_H
+
+#include "Arduino.h"
+#include "Configuration.h"
+#include "Renderer.h"
+
+// Maximale Hoehe einer Zeile Text (die grossen Ziffern haben 7 Zeilen).
+#define TEXT_SCROLLER_MAX_HEIGHT 7
+
+class TextScroller {
+public:
+    TextScroller();
+
+    void begin(const char *text, byte posy, boolean largeDigits, boolean loop);
+    boolean step(word matrix[16]);
+    void cancel();
+    boolean isRunning();
+
+    void setColumnMillis(unsigned int columnMillis);
+
+    unsigned int getLastStepMicros();
+    unsigned int getMaxStepMicros();
+    void resetMaxStepMicros();
+
+private:
+    Renderer _renderer;
+
+    const char *_text;
+    byte _index;
+    byte _posy;
+    byte _height;
+    boolean _largeDigits;
+    boolean _loop;
+    boolean _tail;
+    boolean _running;
+
+    // Die Zeilen als Spaltenstrom, Bit 0 ist die zuletzt hineingeschobene Spalte.
+    uint32_t _rows[TEXT_SCROLLER_MAX_HEIGHT];
+    // Spalten rechts vom sichtbaren Bereich, die noch hineinlaufen.
+    byte _pending;
+
+    unsigned int _columnMillis;
+    unsigned long _lastStepMillis;
+
+    unsigned int _lastStepMicros;
+    unsigned int _maxStepMicros;
+
+    boolean _feed();
+    byte _loadGlyph(char c, byte glyph[TEXT_SCROLLER_MAX_HEIGHT]);
+};
+
+#endif
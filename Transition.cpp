@@ -0,0 +1,287 @@
+/**
+ * Transition
+ * Nicht blockierende Uebergaenge zwischen zwei Bildern (z.B. beim Minutenwechsel).
+ * Der Uebergang laeuft in Schritten, die ueber millis() getaktet aus loop()
+ * heraus aufgerufen werden. Ein Schritt berechnet nur das naechste Zwischenbild
+ * in den Bildspeicher (Zeilen 0-9), das dauert wenige hundert Mikrosekunden.
+ * So bleibt loop() schnell genug fuer dcf77.poll().
+ * Die Dauer der Schritte wird mitgemessen (getLastStepMicros(), getMaxStepMicros()).
+ *
+ * Effekte:
+ * TRANSITION_WIPE: Das neue Bild wird spaltenweise von links nach rechts aufgedeckt.
+ * TRANSITION_TYPEWRITER: Die alten Woerter verschwinden, dann werden die neuen
+ *                        Buchstaben in Lesereihenfolge einzeln getippt.
+ * TRANSITION_SCATTER: Die Pixel wechseln in einer pseudozufaelligen Reihenfolge.
+ * TRANSITION_CROSSFADE: Ueberblenden mit einer geordneten 4x4-Rastermaske (Dithering).
+ *
+ * Die Eck-LEDs und die Alarm-LED (Bits 0-4) wechseln sofort.
+ *
+ * Mit LED_DRIVER_PALETTE kann der Uebergang zusaetzlich die Pixel eines Farbplatzes
+ * (z.B. die Stunden-Woerter) im alten und im neuen Bild mitnehmen (setSlotMasks()).
+ * getSlotMask() liefert dann die Pixel des Farbplatzes passend zum Zwischenbild:
+ * alte Woerter behalten ihren Farbplatz, bis sie verschwinden.
+ *
+ * @mc       Arduino/RBBB
+ * @autor    agent / agent _AT_ local
+ *           Vorlage von: Christian Aschoff / caschoff _AT_ mac _DOT_ com
+ * @version  1.1
+ * @created  18.10.2026
+ * @updated  18.10.2026
+ *
+ * Versionshistorie:
+ * V 1.0:  - Erstellt.
+ * V 1.1:  - Farbplaetze (LED_DRIVER_PALETTE) wechseln mit den Pixeln (setSlotMasks(), getSlotMask()).
+ */
+#include "Transition.h"
+#include <avr/pgmspace.h>
+
+// #define DEBUG
+#include "Debug.h"
+
+// Die Pixel der Woerter (Bits 5-15), die Bits 0-4 sind Eck- und Alarm-LEDs.
+#define TRANSITION_PIXELS 0b1111111111100000
+
+// Anzahl der Schritte fuer SCATTER und CROSSFADE.
+#define TRANSITION_FADE_STEPS 16
+
+// Schrittweite fuer die pseudozufaellige Reihenfolge bei SCATTER.
+// Teilerfremd zu 110, damit jeder Pixel genau einmal drankommt.
+#define TRANSITION_SCATTER_PRIME 37
+
+/**
+ * Die 4x4-Bayer-Matrix fuer das Ueberblenden.
+ */
+extern const byte transitionBayer[4][4] PROGMEM;
+const byte transitionBayer[4][4] = {
+    { 0,  8,  2, 10},
+    {12,  4, 14,  6},
+    { 3, 11,  1,  9},
+    {15,  7, 13,  5}
+};
+
+Transition::Transition() {
+    _running = false;
+    _maxStepMicros = 0;
+    _lastStepMicros = 0;
+}
+
+/**
+ * Einen Uebergang starten.
+ *
+ * @param from Das Bild, das gerade angezeigt wird.
+ * @param to Das Bild, das am Ende angezeigt werden soll.
+ * @param effect Der Effekt (TRANSITION_*).
+ */
+void Transition::begin(word from[16], word to[16], byte effect) {
+    for (byte y = 0; y < 10; y++) {
+        _from[y] = from[y];
+        _to[y] = to[y];
+#ifdef LED_DRIVER_PALETTE
+        _fromSlots[y] = 0;
+        _toSlots[y] = 0;
+#endif
+    }
+    _effect = effect;
+    _step = 0;
+
+    switch (_effect) {
+        case TRANSITION_WIPE:
+            _steps = 11;
+            break;
+        case TRANSITION_TYPEWRITER:
+            // ein Schritt zum Loeschen der alten Woerter, dann ein Schritt pro neuem Buchstaben...
+            _steps = 1;
+            for (byte y = 0; y < 10; y++) {
+                word newPixels = _getNewPixels(y);
+                while (newPixels) {
+                    newPixels &= newPixels - 1;
+                    _steps++;
+                }
+            }
+            break;
+        default:
+            _steps = TRANSITION_FADE_STEPS;
+            break;
+    }
+
+    boolean wordsChanged = false;
+    for (byte y = 0; y < 10; y++) {
+        if ((_from[y] ^ _to[y]) & TRANSITION_PIXELS) {
+            wordsChanged = true;
+        }
+    }
+    if (!wordsChanged) {
+        // nur die Ecken sind anders, also gleich das Zielbild...
+        _steps = 1;
+    }
+
+    _running = true;
+    // der erste Schritt kommt sofort...
+    _lastStepMillis = millis() - TRANSITION_STEP_MILLIS;
+}
+
+#ifdef LED_DRIVER_PALETTE
+/**
+ * Die Pixel eines Farbplatzes im alten und im neuen Bild (nach begin() aufrufen).
+ *
+ * @param from Die Pixel des Farbplatzes im Bild, das gerade angezeigt wird.
+ * @param to Die Pixel des Farbplatzes im Zielbild.
+ */
+void Transition::setSlotMasks(word from[16], word to[16]) {
+    for (byte y = 0; y < 10; y++) {
+        _fromSlots[y] = from[y] & TRANSITION_PIXELS;
+        _toSlots[y] = to[y] & TRANSITION_PIXELS;
+    }
+}
+
+/**
+ * Die Pixel des Farbplatzes fuer das aktuelle Zwischenbild: aus dem alten Bild,
+ * was noch nicht aufgedeckt ist, aus dem neuen Bild, was schon aufgedeckt ist.
+ * Nach dem Uebergang sind es die Pixel aus dem Zielbild.
+ *
+ * @param mask Hierhin kommen die Pixel (Zeilen 0-9, die Bits 0-4 bleiben leer).
+ */
+void Transition::getSlotMask(word mask[16]) {
+    for (byte y = 0; y < 16; y++) {
+        mask[y] = 0;
+    }
+    for (byte y = 0; y < 10; y++) {
+        if (!_running || (_step >= _steps)) {
+            mask[y] = _toSlots[y];
+        } else if (_step == 0) {
+            // noch kein Schritt, also das alte Bild...
+            mask[y] = _fromSlots[y];
+        } else {
+            word reveal = _getRevealMask(y) & TRANSITION_PIXELS;
+            mask[y] = (_fromSlots[y] & ~reveal) | (_toSlots[y] & reveal);
+        }
+    }
+}
+#endif
+
+/**
+ * Den naechsten Schritt berechnen, falls es Zeit dafuer ist.
+ *
+ * @param matrix Der Bildspeicher, in den das Zwischenbild geschrieben wird.
+ * @return TRUE, wenn sich der Bildspeicher geaendert hat.
+ */
+boolean Transition::step(word matrix[16]) {
+    if (!_running || (millis() - _lastStepMillis < TRANSITION_STEP_MILLIS)) {
+        return false;
+    }
+    unsigned long start = micros();
+    _lastStepMillis += TRANSITION_STEP_MILLIS;
+    _step++;
+
+    if (_step >= _steps) {
+        // fertig, das Zielbild...
+        for (byte y = 0; y < 10; y++) {
+            matrix[y] = _to[y];
+        }
+        _running = false;
+    } else {
+        for (byte y = 0; y < 10; y++) {
+            word reveal = _getRevealMask(y) & TRANSITION_PIXELS;
+            matrix[y] = (_from[y] & TRANSITION_PIXELS & ~reveal) | (_to[y] & reveal) | (_to[y] & ~TRANSITION_PIXELS);
+        }
+    }
+
+    _lastStepMicros = micros() - start;
+    if (_lastStepMicros > _maxStepMicros) {
+        _maxStepMicros = _lastStepMicros;
+    }
+    return true;
+}
+
+/**
+ * Den Uebergang abbrechen (z.B. bei einem Moduswechsel).
+ */
+void Transition::cancel() {
+    _running = false;
+}
+
+boolean Transition::isRunning() {
+    return _running;
+}
+
+/**
+ * Die Dauer des letzten Schrittes in Mikrosekunden.
+ */
+unsigned int Transition::getLastStepMicros() {
+    return _lastStepMicros;
+}
+
+/**
+ * Die Dauer des laengsten Schrittes in Mikrosekunden.
+ */
+unsigned int Transition::getMaxStepMicros() {
+    return _maxStepMicros;
+}
+
+void Transition::resetMaxStepMicros() {
+    _maxStepMicros = 0;
+}
+
+/**
+ * Die Pixel der Zeile y, die im aktuellen Schritt schon das neue Bild zeigen.
+ */
+word Transition::_getRevealMask(byte y) {
+    word reveal = 0;
+    switch (_effect) {
+        case TRANSITION_WIPE:
+            // die ersten _step Spalten von links...
+            reveal = 0b1111111111111111 << (16 - _step);
+            break;
+        case TRANSITION_TYPEWRITER: {
+            // alte Woerter sind weg, die neuen Buchstaben bis zum Cursor sind da...
+            reveal = _from[y] & ~_to[y];
+            byte typed = _step - 1;
+            for (byte i = 0; (i < y) && (typed > 0); i++) {
+                word newPixels = _getNewPixels(i);
+                while (newPixels && (typed > 0)) {
+                    newPixels &= newPixels - 1;
+                    typed--;
+                }
+            }
+            word newPixels = _getNewPixels(y);
+            for (word t = 0b1000000000000000; (t != 0) && (typed > 0); t >>= 1) {
+                if (newPixels & t) {
+                    reveal |= t;
+                    typed--;
+                }
+            }
+            break;
+        }
+        case TRANSITION_SCATTER: {
+            // Reihenfolge (i * PRIME) % 110 fuer Pixel i = y * 11 + x...
+            byte order = (y * 11 * TRANSITION_SCATTER_PRIME) % 110;
+            byte limit = (word)_step * 110 / _steps;
+            for (byte x = 0; x < 11; x++) {
+                if (order < limit) {
+                    reveal |= 0b1000000000000000 >> x;
+                }
+                order += TRANSITION_SCATTER_PRIME;
+                if (order >= 110) {
+                    order -= 110;
+                }
+            }
+            break;
+        }
+        default:
+            // TRANSITION_CROSSFADE
+            for (byte x = 0; x < 11; x++) {
+                if (pgm_read_byte_near(&transitionBayer[y & 3][x & 3]) < _step) {
+                    reveal |= 0b1000000000000000 >> x;
+                }
+            }
+            break;
+    }
+    return reveal;
+}
+
+/**
+ * Die Pixel der Zeile y, die im neuen Bild dazukommen.
+ */
+word Transition::_getNewPixels(byte y) {
+    return _to[y] & ~_from[y] & TRANSITION_PIXELS;
+}
@@ -0,0 +1,84 @@
+/**
+ * Transition
+ * Nicht blockierende Uebergaenge zwischen zwei Bildern (z.B. beim Minutenwechsel).
+ * Der Uebergang laeuft in Schritten, die ueber millis() getaktet aus loop()
+ * heraus aufgerufen werden. Ein Schritt berechnet nur das naechste Zwischenbild
+ * in den Bildspeicher (Zeilen 0-9), das dauert wenige hundert Mikrosekunden.
+ * So bleibt loop() schnell genug fuer dcf77.poll().
+ * Die Dauer der Schritte wird mitgemessen (getLastStepMicros(), getMaxStepMicros()).
+ *
+ * Effekte:
+ * TRANSITION_WIPE: Das neue Bild wird spaltenweise von links nach rechts aufgedeckt.
+ * TRANSITION_TYPEWRITER: Die alten Woerter verschwinden, dann werden die neuen
+ *                        Buchstaben in Lesereihenfolge einzeln getippt.
+ * TRANSITION_SCATTER: Die Pixel wechseln in einer pseudozufaelligen Reihenfolge.
+ * TRANSITION_CROSSFADE: Ueberblenden mit einer geordneten 4x4-Rastermaske (Dithering).
+ *
+ * Die Eck-LEDs und die Alarm-LED (Bits 0-4) wechseln sofort.
+ *
+ * Mit LED_DRIVER_PALETTE kann der Uebergang zusaetzlich die Pixel eines Farbplatzes
+ * (z.B. die Stunden-Woerter) im alten und im neuen Bild mitnehmen (setSlotMasks()).
+ * getSlotMask() liefert dann die Pixel des Farbplatzes passend zum Zwischenbild:
+ * alte Woerter behalten ihren Farbplatz, bis sie verschwinden.
+ *
+ * @mc       Arduino/RBBB
+ * @autor    agent / agent _AT_ local
+ *           Vorlage von: Christian Aschoff / caschoff _AT_ mac _DOT_ com
+ * @version  1.1
+ * @created  18.10.2026
+ * @updated  18.10.2026
+ *
+ * Versionshistorie:
+ * V 1.0:  - Erstellt.
+ * V 1.1:  - Farbplaetze (LED_DRIVER_PALETTE) wechseln mit den Pixeln (setSlotMasks(), getSlotMask()).
+ */
+#ifndef TRANSITION_H
+#define TRANSITION_H
+
+#include "Arduino.h"
+#include "Configuration.h"
+
+#define TRANSITION_WIPE       1
+#define TRANSITION_TYPEWRITER 2
+#define TRANSITION_SCATTER    3
+#define TRANSITION_CROSSFADE  4
+
+class Transition {
+public:
+    Transition();
+
+    void begin(word from[16], word to[16], byte effect);
+#ifdef LED_DRIVER_PALETTE
+    void setSlotMasks(word from[16], word to[16]);
+    void getSlotMask(word mask[16]);
+#endif
+    boolean step(word matrix[16]);
+    void cancel();
+    boolean isRunning();
+
+    unsigned int getLastStepMicros();
+    unsigned int getMaxStepMicros();
+    void resetMaxStepMicros();
+
+private:
+    word _from[10];
+    word _to[10];
+#ifdef LED_DRIVER_PALETTE
+    word _fromSlots[10];
+    word _toSlots[10];
+#endif
+
+    byte _effect;
+    byte _step;
+    byte _steps;
+    boolean _running;
+    unsigned long _lastStepMillis;
+
+    unsigned int _lastStepMicros;
+    unsigned int _maxStepMicros;
+
+    word _getRevealMask(byte y);
+    word _getNewPixels(byte y);
+};
+
+#endif
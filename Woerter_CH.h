@@ -1,7 +1,9 @@
 /**
  * Woerter_CH
  * Definition der schweizerischen Woerter fuer die Zeitansage.
- * Die Woerter sind Bitmasken fuer die Matrix.
+ * Die Woerter sind Indizes in die Tabelle woerter_CH, dort stehen
+ * Zeile und Bitmaske fuer die Matrix. Dazu kommen die Regeln fuer
+ * die Minuten-Phrasen und die Stunden.
  *
  *   01234567890
  * 0 ESKISCHAFÜF
@@ -18,39 +20,122 @@
  * @mc       Arduino/RBBB
  * @autor    Thomas Schuler / thomas.schuler _AT_ vtg _DOT_ admin _DOT_ ch (Basis)
  * @autor    Christian Aschoff / caschoff _AT_ mac _DOT_ com (Anpassung)
- * @version  1.1
+ * @version  1.2
  * @created  18.3.2012
- * @updated  4.4.2013
+ * @updated  18.10.2026
  *
  * Version 1.1: - Layoutanpassung
+ * Version 1.2: - Woerter als Index in die Tabelle woerter_CH (Zeile und Bitmaske), Minuten-Phrasen und Stunden als Tabellen (siehe Sprachen.h).
+ *              - Tabellen static, sie gehoeren nur zu Renderer.cpp.
  */
 #ifndef WOERTER_CH_H
 #define WOERTER_CH_H
 
 /**
- * Definition der Woerter
+ * Definition der Woerter (Index in woerter_CH).
  */
-#define CH_VOR          matrix[2] |= 0b0000000011100000
-#define CH_AB           matrix[3] |= 0b1100000000000000
-#define CH_ESISCH       matrix[0] |= 0b1101111000000000
+#define CH_VOR          0
+#define CH_AB           1
+#define CH_ESISCH       2
 
-#define CH_FUEF         matrix[0] |= 0b0000000011100000
-#define CH_ZAEAE        matrix[1] |= 0b0000000011100000
-#define CH_VIERTU       matrix[1] |= 0b1111110000000000
-#define CH_ZWAENZG      matrix[2] |= 0b1111110000000000
-#define CH_HAUBI        matrix[3] |= 0b0001111100000000
+#define CH_FUEF         3
+#define CH_ZAEAE        4
+#define CH_VIERTU       5
+#define CH_ZWAENZG      6
+#define CH_HAUBI        7
 
-#define CH_H_EIS        matrix[4] |= 0b1110000000000000
-#define CH_H_ZWOEI      matrix[4] |= 0b0001111000000000
-#define CH_H_DRUE       matrix[4] |= 0b0000000011100000
-#define CH_H_VIER       matrix[5] |= 0b1111100000000000
-#define CH_H_FUEFI      matrix[5] |= 0b0000011110000000
-#define CH_H_SAECHSI    matrix[6] |= 0b1111110000000000
-#define CH_H_SIEBNI     matrix[6] |= 0b0000001111100000
-#define CH_H_ACHTI      matrix[7] |= 0b1111100000000000
-#define CH_H_NUENI      matrix[7] |= 0b0000011110000000
-#define CH_H_ZAENI      matrix[8] |= 0b1111000000000000
-#define CH_H_EUFI       matrix[8] |= 0b0000000111100000
-#define CH_H_ZWOEUFI    matrix[9] |= 0b1111110000000000
+#define CH_H_EIS        8
+#define CH_H_ZWOEI      9
+#define CH_H_DRUE       10
+#define CH_H_VIER       11
+#define CH_H_FUEFI      12
+#define CH_H_SAECHSI    13
+#define CH_H_SIEBNI     14
+#define CH_H_ACHTI      15
+#define CH_H_NUENI      16
+#define CH_H_ZAENI      17
+#define CH_H_EUFI       18
+#define CH_H_ZWOEUFI    19
+
+/**
+ * Die Woerter: Zeile und Bitmaske (siehe WORT() in Sprachen.h).
+ */
+static const word woerter_CH[] PROGMEM = {
+    WORT(2, 0b0000000011100000), // CH_VOR
+    WORT(3, 0b1100000000000000), // CH_AB
+    WORT(0, 0b1101111000000000), // CH_ESISCH
+    WORT(0, 0b0000000011100000), // CH_FUEF
+    WORT(1, 0b0000000011100000), // CH_ZAEAE
+    WORT(1, 0b1111110000000000), // CH_VIERTU
+    WORT(2, 0b1111110000000000), // CH_ZWAENZG
+    WORT(3, 0b0001111100000000), // CH_HAUBI
+    WORT(4, 0b1110000000000000), // CH_H_EIS
+    WORT(4, 0b0001111000000000), // CH_H_ZWOEI
+    WORT(4, 0b0000000011100000), // CH_H_DRUE
+    WORT(5, 0b1111100000000000), // CH_H_VIER
+    WORT(5, 0b0000011110000000), // CH_H_FUEFI
+    WORT(6, 0b1111110000000000), // CH_H_SAECHSI
+    WORT(6, 0b0000001111100000), // CH_H_SIEBNI
+    WORT(7, 0b1111100000000000), // CH_H_ACHTI
+    WORT(7, 0b0000011110000000), // CH_H_NUENI
+    WORT(8, 0b1111000000000000), // CH_H_ZAENI
+    WORT(8, 0b0000000111100000), // CH_H_EUFI
+    WORT(9, 0b1111110000000000)  // CH_H_ZWOEUFI
+};
+
+/**
+ * Die Minuten-Phrasen in 5-Minuten-Schritten.
+ */
+static const uint32_t phrasen_CH[] PROGMEM = {
+    W(CH_ESISCH) | PHRASE_HOUR_GLATT,                                       // :00
+    W(CH_ESISCH) | W(CH_FUEF) | W(CH_AB),                                   // :05
+    W(CH_ESISCH) | W(CH_ZAEAE) | W(CH_AB),                                  // :10
+    W(CH_ESISCH) | W(CH_VIERTU) | W(CH_AB),                                 // :15
+    W(CH_ESISCH) | W(CH_ZWAENZG) | W(CH_AB),                                // :20
+    W(CH_ESISCH) | W(CH_FUEF) | W(CH_VOR) | W(CH_HAUBI) | PHRASE_HOUR_NEXT, // :25
+    W(CH_ESISCH) | W(CH_HAUBI) | PHRASE_HOUR_NEXT,                          // :30
+    W(CH_ESISCH) | W(CH_FUEF) | W(CH_AB) | W(CH_HAUBI) | PHRASE_HOUR_NEXT,  // :35
+    W(CH_ESISCH) | W(CH_ZWAENZG) | W(CH_VOR) | PHRASE_HOUR_NEXT,            // :40
+    W(CH_ESISCH) | W(CH_VIERTU) | W(CH_VOR) | PHRASE_HOUR_NEXT,             // :45
+    W(CH_ESISCH) | W(CH_ZAEAE) | W(CH_VOR) | PHRASE_HOUR_NEXT,              // :50
+    W(CH_ESISCH) | W(CH_FUEF) | W(CH_VOR) | PHRASE_HOUR_NEXT                // :55
+};
+
+/**
+ * Die Stunden (0-12, 12 ist Mittag) einmal normal und einmal
+ * als glatte Stunde (PHRASE_HOUR_GLATT).
+ */
+static const uint32_t stunden_CH[][13] PROGMEM = {
+    { // Stunde
+        W(CH_H_ZWOEUFI), // 0
+        W(CH_H_EIS),     // 1
+        W(CH_H_ZWOEI),   // 2
+        W(CH_H_DRUE),    // 3
+        W(CH_H_VIER),    // 4
+        W(CH_H_FUEFI),   // 5
+        W(CH_H_SAECHSI), // 6
+        W(CH_H_SIEBNI),  // 7
+        W(CH_H_ACHTI),   // 8
+        W(CH_H_NUENI),   // 9
+        W(CH_H_ZAENI),   // 10
+        W(CH_H_EUFI),    // 11
+        W(CH_H_ZWOEUFI)  // 12
+    },
+    { // glatte Stunde
+        W(CH_H_ZWOEUFI), // 0
+        W(CH_H_EIS),     // 1
+        W(CH_H_ZWOEI),   // 2
+        W(CH_H_DRUE),    // 3
+        W(CH_H_VIER),    // 4
+        W(CH_H_FUEFI),   // 5
+        W(CH_H_SAECHSI), // 6
+        W(CH_H_SIEBNI),  // 7
+        W(CH_H_ACHTI),   // 8
+        W(CH_H_NUENI),   // 9
+        W(CH_H_ZAENI),   // 10
+        W(CH_H_EUFI),    // 11
+        W(CH_H_ZWOEUFI)  // 12
+    }
+};
 
 #endif
@@ -1,7 +1,9 @@
 /**
  * Woerter_DE
  * Definition der deutschen Woerter fuer die Zeitansage.
- * Die Woerter sind Bitmasken fuer die Matrix.
+ * Die Woerter sind Indizes in die Tabelle woerter_DE, dort stehen
+ * Zeile und Bitmaske fuer die Matrix. Dazu kommen die Regeln fuer
+ * die Minuten-Phrasen und die Stunden.
  *
  *   01234567890
  * 0 ESKISTLFUNF
@@ -17,39 +19,187 @@
  *
  * @mc       Arduino/RBBB
  * @autor    Christian Aschoff / caschoff _AT_ mac _DOT_ com
- * @version  1.0
+ * @version  1.1
  * @created  18.3.2012
+ * @updated  18.10.2026
+ *
+ * Versionshistorie:
+ * V 1.0:  - Erstellt.
+ * V 1.1:  - Woerter als Index in die Tabelle woerter_DE (Zeile und Bitmaske), Minuten-Phrasen und Stunden als Tabellen (siehe Sprachen.h).
+ *         - Tabellen static, sie gehoeren nur zu Renderer.cpp.
  */
 #ifndef WOERTER_DE_H
 #define WOERTER_DE_H
 
 /**
- * Definition der Woerter
- */
-#define DE_VOR          matrix[3] |= 0b1110000000000000
-#define DE_NACH         matrix[3] |= 0b0000000111100000
-#define DE_ESIST        matrix[0] |= 0b1101110000000000
-#define DE_UHR          matrix[9] |= 0b0000000011100000
-
-#define DE_FUENF        matrix[0] |= 0b0000000111100000
-#define DE_ZEHN         matrix[1] |= 0b1111000000000000
-#define DE_VIERTEL      matrix[2] |= 0b0000111111100000
-#define DE_ZWANZIG      matrix[1] |= 0b0000111111100000
-#define DE_HALB         matrix[4] |= 0b1111000000000000
-#define DE_DREIVIERTEL  matrix[2] |= 0b1111111111100000
-
-#define DE_H_EIN        matrix[5] |= 0b1110000000000000
-#define DE_H_EINS       matrix[5] |= 0b1111000000000000
-#define DE_H_ZWEI       matrix[5] |= 0b0000000111100000
-#define DE_H_DREI       matrix[6] |= 0b1111000000000000
-#define DE_H_VIER       matrix[6] |= 0b0000000111100000
-#define DE_H_FUENF      matrix[4] |= 0b0000000111100000
-#define DE_H_SECHS      matrix[7] |= 0b1111100000000000
-#define DE_H_SIEBEN     matrix[8] |= 0b1111110000000000
-#define DE_H_ACHT       matrix[7] |= 0b0000000111100000
-#define DE_H_NEUN       matrix[9] |= 0b0001111000000000
-#define DE_H_ZEHN       matrix[9] |= 0b1111000000000000
-#define DE_H_ELF        matrix[4] |= 0b0000011100000000
-#define DE_H_ZWOELF     matrix[8] |= 0b0000001111100000
+ * Definition der Woerter (Index in woerter_DE).
+ */
+#define DE_VOR          0
+#define DE_NACH         1
+#define DE_ESIST        2
+#define DE_UHR          3
+
+#define DE_FUENF        4
+#define DE_ZEHN         5
+#define DE_VIERTEL      6
+#define DE_ZWANZIG      7
+#define DE_HALB         8
+#define DE_DREIVIERTEL  9
+
+#define DE_H_EIN        10
+#define DE_H_EINS       11
+#define DE_H_ZWEI       12
+#define DE_H_DREI       13
+#define DE_H_VIER       14
+#define DE_H_FUENF      15
+#define DE_H_SECHS      16
+#define DE_H_SIEBEN     17
+#define DE_H_ACHT       18
+#define DE_H_NEUN       19
+#define DE_H_ZEHN       20
+#define DE_H_ELF        21
+#define DE_H_ZWOELF     22
+
+/**
+ * Die Woerter: Zeile und Bitmaske (siehe WORT() in Sprachen.h).
+ */
+#ifdef WOERTER_DE_MKF
+#include "Woerter_DE_MKF.h"
+#else
+static const word woerter_DE[] PROGMEM = {
+    WORT(3, 0b1110000000000000), // DE_VOR
+    WORT(3, 0b0000000111100000), // DE_NACH
+    WORT(0, 0b1101110000000000), // DE_ESIST
+    WORT(9, 0b0000000011100000), // DE_UHR
+    WORT(0, 0b0000000111100000), // DE_FUENF
+    WORT(1, 0b1111000000000000), // DE_ZEHN
+    WORT(2, 0b0000111111100000), // DE_VIERTEL
+    WORT(1, 0b0000111111100000), // DE_ZWANZIG
+    WORT(4, 0b1111000000000000), // DE_HALB
+    WORT(2, 0b1111111111100000), // DE_DREIVIERTEL
+    WORT(5, 0b1110000000000000), // DE_H_EIN
+    WORT(5, 0b1111000000000000), // DE_H_EINS
+    WORT(5, 0b0000000111100000), // DE_H_ZWEI
+    WORT(6, 0b1111000000000000), // DE_H_DREI
+    WORT(6, 0b0000000111100000), // DE_H_VIER
+    WORT(4, 0b0000000111100000), // DE_H_FUENF
+    WORT(7, 0b1111100000000000), // DE_H_SECHS
+    WORT(8, 0b1111110000000000), // DE_H_SIEBEN
+    WORT(7, 0b0000000111100000), // DE_H_ACHT
+    WORT(9, 0b0001111000000000), // DE_H_NEUN
+    WORT(9, 0b1111000000000000), // DE_H_ZEHN
+    WORT(4, 0b0000011100000000), // DE_H_ELF
+    WORT(8, 0b0000001111100000)  // DE_H_ZWOELF
+};
+#endif
+
+/**
+ * Die Minuten-Phrasen (Hochdeutsch) in 5-Minuten-Schritten.
+ */
+static const uint32_t phrasen_DE_DE[] PROGMEM = {
+    W(DE_ESIST) | PHRASE_HOUR_GLATT,                                        // :00
+    W(DE_ESIST) | W(DE_FUENF) | W(DE_NACH),                                 // :05
+    W(DE_ESIST) | W(DE_ZEHN) | W(DE_NACH),                                  // :10
+    W(DE_ESIST) | W(DE_VIERTEL) | W(DE_NACH),                               // :15
+    W(DE_ESIST) | W(DE_ZWANZIG) | W(DE_NACH),                               // :20
+    W(DE_ESIST) | W(DE_FUENF) | W(DE_VOR) | W(DE_HALB) | PHRASE_HOUR_NEXT,  // :25
+    W(DE_ESIST) | W(DE_HALB) | PHRASE_HOUR_NEXT,                            // :30
+    W(DE_ESIST) | W(DE_FUENF) | W(DE_NACH) | W(DE_HALB) | PHRASE_HOUR_NEXT, // :35
+    W(DE_ESIST) | W(DE_ZWANZIG) | W(DE_VOR) | PHRASE_HOUR_NEXT,             // :40
+    W(DE_ESIST) | W(DE_VIERTEL) | W(DE_VOR) | PHRASE_HOUR_NEXT,             // :45
+    W(DE_ESIST) | W(DE_ZEHN) | W(DE_VOR) | PHRASE_HOUR_NEXT,                // :50
+    W(DE_ESIST) | W(DE_FUENF) | W(DE_VOR) | PHRASE_HOUR_NEXT                // :55
+};
+
+/**
+ * Die Minuten-Phrasen (Schwaebisch) in 5-Minuten-Schritten.
+ */
+static const uint32_t phrasen_DE_SW[] PROGMEM = {
+    W(DE_ESIST) | PHRASE_HOUR_GLATT,                                        // :00
+    W(DE_ESIST) | W(DE_FUENF) | W(DE_NACH),                                 // :05
+    W(DE_ESIST) | W(DE_ZEHN) | W(DE_NACH),                                  // :10
+    W(DE_ESIST) | W(DE_VIERTEL) | PHRASE_HOUR_NEXT,                         // :15
+    W(DE_ESIST) | W(DE_ZWANZIG) | W(DE_NACH),                               // :20
+    W(DE_ESIST) | W(DE_FUENF) | W(DE_VOR) | W(DE_HALB) | PHRASE_HOUR_NEXT,  // :25
+    W(DE_ESIST) | W(DE_HALB) | PHRASE_HOUR_NEXT,                            // :30
+    W(DE_ESIST) | W(DE_FUENF) | W(DE_NACH) | W(DE_HALB) | PHRASE_HOUR_NEXT, // :35
+    W(DE_ESIST) | W(DE_ZWANZIG) | W(DE_VOR) | PHRASE_HOUR_NEXT,             // :40
+    W(DE_ESIST) | W(DE_DREIVIERTEL) | PHRASE_HOUR_NEXT,                     // :45
+    W(DE_ESIST) | W(DE_ZEHN) | W(DE_VOR) | PHRASE_HOUR_NEXT,                // :50
+    W(DE_ESIST) | W(DE_FUENF) | W(DE_VOR) | PHRASE_HOUR_NEXT                // :55
+};
+
+/**
+ * Die Minuten-Phrasen (Bayrisch) in 5-Minuten-Schritten.
+ */
+static const uint32_t phrasen_DE_BA[] PROGMEM = {
+    W(DE_ESIST) | PHRASE_HOUR_GLATT,                                        // :00
+    W(DE_ESIST) | W(DE_FUENF) | W(DE_NACH),                                 // :05
+    W(DE_ESIST) | W(DE_ZEHN) | W(DE_NACH),                                  // :10
+    W(DE_ESIST) | W(DE_VIERTEL) | W(DE_NACH),                               // :15
+    W(DE_ESIST) | W(DE_ZWANZIG) | W(DE_NACH),                               // :20
+    W(DE_ESIST) | W(DE_FUENF) | W(DE_VOR) | W(DE_HALB) | PHRASE_HOUR_NEXT,  // :25
+    W(DE_ESIST) | W(DE_HALB) | PHRASE_HOUR_NEXT,                            // :30
+    W(DE_ESIST) | W(DE_FUENF) | W(DE_NACH) | W(DE_HALB) | PHRASE_HOUR_NEXT, // :35
+    W(DE_ESIST) | W(DE_ZWANZIG) | W(DE_VOR) | PHRASE_HOUR_NEXT,             // :40
+    W(DE_ESIST) | W(DE_DREIVIERTEL) | PHRASE_HOUR_NEXT,                     // :45
+    W(DE_ESIST) | W(DE_ZEHN) | W(DE_VOR) | PHRASE_HOUR_NEXT,                // :50
+    W(DE_ESIST) | W(DE_FUENF) | W(DE_VOR) | PHRASE_HOUR_NEXT                // :55
+};
+
+/**
+ * Die Minuten-Phrasen (Saechsisch) in 5-Minuten-Schritten.
+ */
+static const uint32_t phrasen_DE_SA[] PROGMEM = {
+    W(DE_ESIST) | PHRASE_HOUR_GLATT,                                        // :00
+    W(DE_ESIST) | W(DE_FUENF) | W(DE_NACH),                                 // :05
+    W(DE_ESIST) | W(DE_ZEHN) | W(DE_NACH),                                  // :10
+    W(DE_ESIST) | W(DE_VIERTEL) | PHRASE_HOUR_NEXT,                         // :15
+    W(DE_ESIST) | W(DE_ZEHN) | W(DE_VOR) | W(DE_HALB) | PHRASE_HOUR_NEXT,   // :20
+    W(DE_ESIST) | W(DE_FUENF) | W(DE_VOR) | W(DE_HALB) | PHRASE_HOUR_NEXT,  // :25
+    W(DE_ESIST) | W(DE_HALB) | PHRASE_HOUR_NEXT,                            // :30
+    W(DE_ESIST) | W(DE_FUENF) | W(DE_NACH) | W(DE_HALB) | PHRASE_HOUR_NEXT, // :35
+    W(DE_ESIST) | W(DE_ZEHN) | W(DE_NACH) | W(DE_HALB) | PHRASE_HOUR_NEXT,  // :40
+    W(DE_ESIST) | W(DE_DREIVIERTEL) | PHRASE_HOUR_NEXT,                     // :45
+    W(DE_ESIST) | W(DE_ZEHN) | W(DE_VOR) | PHRASE_HOUR_NEXT,                // :50
+    W(DE_ESIST) | W(DE_FUENF) | W(DE_VOR) | PHRASE_HOUR_NEXT                // :55
+};
+
+/**
+ * Die Stunden (0-12, 12 ist Mittag) einmal normal und einmal
+ * als glatte Stunde (PHRASE_HOUR_GLATT).
+ */
+static const uint32_t stunden_DE[][13] PROGMEM = {
+    { // Stunde
+        W(DE_H_ZWOELF), // 0
+        W(DE_H_EINS),   // 1
+        W(DE_H_ZWEI),   // 2
+        W(DE_H_DREI),   // 3
+        W(DE_H_VIER),   // 4
+        W(DE_H_FUENF),  // 5
+        W(DE_H_SECHS),  // 6
+        W(DE_H_SIEBEN), // 7
+        W(DE_H_ACHT),   // 8
+        W(DE_H_NEUN),   // 9
+        W(DE_H_ZEHN),   // 10
+        W(DE_H_ELF),    // 11
+        W(DE_H_ZWOELF)  // 12
+    },
+    { // glatte Stunde
+        W(DE_H_ZWOELF) | W(DE_UHR), // 0
+        W(DE_H_EIN) | W(DE_UHR),    // 1
+        W(DE_H_ZWEI) | W(DE_UHR),   // 2
+        W(DE_H_DREI) | W(DE_UHR),   // 3
+        W(DE_H_VIER) | W(DE_UHR),   // 4
+        W(DE_H_FUENF) | W(DE_UHR),  // 5
+        W(DE_H_SECHS) | W(DE_UHR),  // 6
+        W(DE_H_SIEBEN) | W(DE_UHR), // 7
+        W(DE_H_ACHT) | W(DE_UHR),   // 8
+        W(DE_H_NEUN) | W(DE_UHR),   // 9
+        W(DE_H_ZEHN) | W(DE_UHR),   // 10
+        W(DE_H_ELF) | W(DE_UHR),    // 11
+        W(DE_H_ZWOELF) | W(DE_UHR)  // 12
+    }
+};
 
 #endif
@@ -3,7 +3,8 @@
  * Definition der deutschen Woerter fuer die Zeitansage.
  * Hier in einer anderen Variante nach der Matix von Gerog M.
  * Sie entspricht dem Layout aus dem Mikrocontroller.net
- * Die Woerter sind Bitmasken fuer die Matrix.
+ * Hier steht nur die Tabelle woerter_DE, die Indizes und Regeln
+ * kommen aus Woerter_DE.h.
  *
  *   01234567890
  * 0 ESKISTLFUNF
@@ -19,39 +20,45 @@
  *
  * @mc       Arduino/RBBB
  * @autor    Christian Aschoff / caschoff _AT_ mac _DOT_ com
- * @version  1.0
+ * @version  1.1
  * @created  28.10.2012
+ * @updated  18.10.2026
+ *
+ * Versionshistorie:
+ * V 1.0:  - Erstellt.
+ * V 1.1:  - Nur noch die Tabelle woerter_DE, Indizes und Regeln kommen aus Woerter_DE.h.
+ *         - Tabellen static, sie gehoeren nur zu Renderer.cpp.
  */
-#ifndef WOERTER_DE_H
-#define WOERTER_DE_H
+#ifndef WOERTER_DE_MKF_H
+#define WOERTER_DE_MKF_H
 
 /**
- * Definition der Woerter
+ * Die Woerter: Zeile und Bitmaske (siehe WORT() in Sprachen.h).
  */
-#define DE_VOR          matrix[3] |= 0b0000001110000000
-#define DE_NACH         matrix[3] |= 0b0011110000000000
-#define DE_ESIST        matrix[0] |= 0b1101110000000000
-#define DE_UHR          matrix[9] |= 0b0000000011100000
-
-#define DE_FUENF        matrix[0] |= 0b0000000111100000
-#define DE_ZEHN         matrix[1] |= 0b1111000000000000
-#define DE_VIERTEL      matrix[2] |= 0b0000111111100000
-#define DE_ZWANZIG      matrix[1] |= 0b0000111111100000
-#define DE_HALB         matrix[4] |= 0b1111000000000000
-#define DE_DREIVIERTEL  matrix[2] |= 0b1111111111100000
-
-#define DE_H_EIN        matrix[5] |= 0b0011100000000000
-#define DE_H_EINS       matrix[5] |= 0b0011110000000000
-#define DE_H_ZWEI       matrix[5] |= 0b1111000000000000
-#define DE_H_DREI       matrix[6] |= 0b0111100000000000
-#define DE_H_VIER       matrix[7] |= 0b0000000111100000
-#define DE_H_FUENF      matrix[6] |= 0b0000000111100000
-#define DE_H_SECHS      matrix[9] |= 0b0111110000000000
-#define DE_H_SIEBEN     matrix[5] |= 0b0000011111100000
-#define DE_H_ACHT       matrix[8] |= 0b0111100000000000
-#define DE_H_NEUN       matrix[7] |= 0b0001111000000000
-#define DE_H_ZEHN       matrix[8] |= 0b0000011110000000
-#define DE_H_ELF        matrix[7] |= 0b1110000000000000
-#define DE_H_ZWOELF     matrix[4] |= 0b0000011111000000
+static const word woerter_DE[] PROGMEM = {
+    WORT(3, 0b0000001110000000), // DE_VOR
+    WORT(3, 0b0011110000000000), // DE_NACH
+    WORT(0, 0b1101110000000000), // DE_ESIST
+    WORT(9, 0b0000000011100000), // DE_UHR
+    WORT(0, 0b0000000111100000), // DE_FUENF
+    WORT(1, 0b1111000000000000), // DE_ZEHN
+    WORT(2, 0b0000111111100000), // DE_VIERTEL
+    WORT(1, 0b0000111111100000), // DE_ZWANZIG
+    WORT(4, 0b1111000000000000), // DE_HALB
+    WORT(2, 0b1111111111100000), // DE_DREIVIERTEL
+    WORT(5, 0b0011100000000000), // DE_H_EIN
+    WORT(5, 0b0011110000000000), // DE_H_EINS
+    WORT(5, 0b1111000000000000), // DE_H_ZWEI
+    WORT(6, 0b0111100000000000), // DE_H_DREI
+    WORT(7, 0b0000000111100000), // DE_H_VIER
+    WORT(6, 0b0000000111100000), // DE_H_FUENF
+    WORT(9, 0b0111110000000000), // DE_H_SECHS
+    WORT(5, 0b0000011111100000), // DE_H_SIEBEN
+    WORT(8, 0b0111100000000000), // DE_H_ACHT
+    WORT(7, 0b0001111000000000), // DE_H_NEUN
+    WORT(8, 0b0000011110000000), // DE_H_ZEHN
+    WORT(7, 0b1110000000000000), // DE_H_ELF
+    WORT(4, 0b0000011111000000)  // DE_H_ZWOELF
+};
 
 #endif
@@ -1,7 +1,9 @@
 /**
  * Woerter_EN
  * Definition der englischen Woerter fuer die Zeitansage.
- * Die Woerter sind Bitmasken fuer die Matrix.
+ * Die Woerter sind Indizes in die Tabelle woerter_EN, dort stehen
+ * Zeile und Bitmaske fuer die Matrix. Dazu kommen die Regeln fuer
+ * die Minuten-Phrasen und die Stunden.
  *
  *   01234567890
  * 0 ITLISASTIME
@@ -17,40 +19,130 @@
  *
  * @mc       Arduino/RBBB
  * @autor    Christian Aschoff / caschoff _AT_ mac _DOT_ com
- * @version  1.0
+ * @version  1.1
  * @created  17.12.2012
+ * @updated  18.10.2026
+ *
+ * Versionshistorie:
+ * V 1.0:  - Erstellt.
+ * V 1.1:  - Woerter als Index in die Tabelle woerter_EN (Zeile und Bitmaske), Minuten-Phrasen und Stunden als Tabellen (siehe Sprachen.h).
+ *         - Tabellen static, sie gehoeren nur zu Renderer.cpp.
  */
 #ifndef WOERTER_EN_H
 #define WOERTER_EN_H
 
 /**
- * Definition der Woerter.
+ * Definition der Woerter (Index in woerter_EN).
+ */
+
+#define EN_ITIS     0
+#define EN_TIME     1
+#define EN_A        2
+#define EN_OCLOCK   3
+
+#define EN_QUATER   4
+#define EN_TWENTY   5
+#define EN_FIVE     6
+#define EN_HALF     7
+#define EN_TEN      8
+#define EN_TO       9
+#define EN_PAST     10
+
+#define EN_H_NINE   11
+#define EN_H_ONE    12
+#define EN_H_SIX    13
+#define EN_H_THREE  14
+#define EN_H_FOUR   15
+#define EN_H_FIVE   16
+#define EN_H_TWO    17
+#define EN_H_EIGHT  18
+#define EN_H_ELEVEN 19
+#define EN_H_SEVEN  20
+#define EN_H_TWELVE 21
+#define EN_H_TEN    22
+
+/**
+ * Die Woerter: Zeile und Bitmaske (siehe WORT() in Sprachen.h).
+ */
+static const word woerter_EN[] PROGMEM = {
+    WORT(0, 0b1101100000000000), // EN_ITIS
+    WORT(0, 0b0000000111100000), // EN_TIME
+    WORT(1, 0b1000000000000000), // EN_A
+    WORT(9, 0b0000011111100000), // EN_OCLOCK
+    WORT(1, 0b0011111110000000), // EN_QUATER
+    WORT(2, 0b1111110000000000), // EN_TWENTY
+    WORT(2, 0b0000001111000000), // EN_FIVE
+    WORT(3, 0b1111000000000000), // EN_HALF
+    WORT(3, 0b0000011100000000), // EN_TEN
+    WORT(3, 0b0000000001100000), // EN_TO
+    WORT(4, 0b1111000000000000), // EN_PAST
+    WORT(4, 0b0000000111100000), // EN_H_NINE
+    WORT(5, 0b1110000000000000), // EN_H_ONE
+    WORT(5, 0b0001110000000000), // EN_H_SIX
+    WORT(5, 0b0000001111100000), // EN_H_THREE
+    WORT(6, 0b1111000000000000), // EN_H_FOUR
+    WORT(6, 0b0000111100000000), // EN_H_FIVE
+    WORT(6, 0b0000000011100000), // EN_H_TWO
+    WORT(7, 0b1111100000000000), // EN_H_EIGHT
+    WORT(7, 0b0000011111100000), // EN_H_ELEVEN
+    WORT(8, 0b1111100000000000), // EN_H_SEVEN
+    WORT(8, 0b0000011111100000), // EN_H_TWELVE
+    WORT(9, 0b1110000000000000)  // EN_H_TEN
+};
+
+/**
+ * Die Minuten-Phrasen in 5-Minuten-Schritten.
  */
+static const uint32_t phrasen_EN[] PROGMEM = {
+    W(EN_ITIS) | PHRASE_HOUR_GLATT,                                       // :00
+    W(EN_ITIS) | W(EN_FIVE) | W(EN_PAST),                                 // :05
+    W(EN_ITIS) | W(EN_TEN) | W(EN_PAST),                                  // :10
+    W(EN_ITIS) | W(EN_A) | W(EN_QUATER) | W(EN_PAST),                     // :15
+    W(EN_ITIS) | W(EN_TWENTY) | W(EN_PAST),                               // :20
+    W(EN_ITIS) | W(EN_TWENTY) | W(EN_FIVE) | W(EN_PAST),                  // :25
+    W(EN_ITIS) | W(EN_HALF) | W(EN_PAST),                                 // :30
+    W(EN_ITIS) | W(EN_TWENTY) | W(EN_FIVE) | W(EN_TO) | PHRASE_HOUR_NEXT, // :35
+    W(EN_ITIS) | W(EN_TWENTY) | W(EN_TO) | PHRASE_HOUR_NEXT,              // :40
+    W(EN_ITIS) | W(EN_A) | W(EN_QUATER) | W(EN_TO) | PHRASE_HOUR_NEXT,    // :45
+    W(EN_ITIS) | W(EN_TEN) | W(EN_TO) | PHRASE_HOUR_NEXT,                 // :50
+    W(EN_ITIS) | W(EN_FIVE) | W(EN_TO) | PHRASE_HOUR_NEXT                 // :55
+};
 
-#define EN_ITIS     matrix[0] |= 0b1101100000000000
-#define EN_TIME     matrix[0] |= 0b0000000111100000
-#define EN_A        matrix[1] |= 0b1000000000000000
-#define EN_OCLOCK   matrix[9] |= 0b0000011111100000
-
-#define EN_QUATER   matrix[1] |= 0b0011111110000000
-#define EN_TWENTY   matrix[2] |= 0b1111110000000000
-#define EN_FIVE     matrix[2] |= 0b0000001111000000
-#define EN_HALF     matrix[3] |= 0b1111000000000000
-#define EN_TEN      matrix[3] |= 0b0000011100000000
-#define EN_TO       matrix[3] |= 0b0000000001100000
-#define EN_PAST     matrix[4] |= 0b1111000000000000
-
-#define EN_H_NINE   matrix[4] |= 0b0000000111100000
-#define EN_H_ONE    matrix[5] |= 0b1110000000000000
-#define EN_H_SIX    matrix[5] |= 0b0001110000000000
-#define EN_H_THREE  matrix[5] |= 0b0000001111100000
-#define EN_H_FOUR   matrix[6] |= 0b1111000000000000
-#define EN_H_FIVE   matrix[6] |= 0b0000111100000000
-#define EN_H_TWO    matrix[6] |= 0b0000000011100000
-#define EN_H_EIGHT  matrix[7] |= 0b1111100000000000
-#define EN_H_ELEVEN matrix[7] |= 0b0000011111100000
-#define EN_H_SEVEN  matrix[8] |= 0b1111100000000000
-#define EN_H_TWELVE matrix[8] |= 0b0000011111100000
-#define EN_H_TEN    matrix[9] |= 0b1110000000000000
+/**
+ * Die Stunden (0-12, 12 ist Mittag) einmal normal und einmal
+ * als glatte Stunde (PHRASE_HOUR_GLATT).
+ */
+static const uint32_t stunden_EN[][13] PROGMEM = {
+    { // Stunde
+        W(EN_H_TWELVE), // 0
+        W(EN_H_ONE),    // 1
+        W(EN_H_TWO),    // 2
+        W(EN_H_THREE),  // 3
+        W(EN_H_FOUR),   // 4
+        W(EN_H_FIVE),   // 5
+        W(EN_H_SIX),    // 6
+        W(EN_H_SEVEN),  // 7
+        W(EN_H_EIGHT),  // 8
+        W(EN_H_NINE),   // 9
+        W(EN_H_TEN),    // 10
+        W(EN_H_ELEVEN), // 11
+        W(EN_H_TWELVE)  // 12
+    },
+    { // glatte Stunde
+        W(EN_H_TWELVE) | W(EN_OCLOCK), // 0
+        W(EN_H_ONE) | W(EN_OCLOCK),    // 1
+        W(EN_H_TWO) | W(EN_OCLOCK),    // 2
+        W(EN_H_THREE) | W(EN_OCLOCK),  // 3
+        W(EN_H_FOUR) | W(EN_OCLOCK),   // 4
+        W(EN_H_FIVE) | W(EN_OCLOCK),   // 5
+        W(EN_H_SIX) | W(EN_OCLOCK),    // 6
+        W(EN_H_SEVEN) | W(EN_OCLOCK),  // 7
+        W(EN_H_EIGHT) | W(EN_OCLOCK),  // 8
+        W(EN_H_NINE) | W(EN_OCLOCK),   // 9
+        W(EN_H_TEN) | W(EN_OCLOCK),    // 10
+        W(EN_H_ELEVEN) | W(EN_OCLOCK), // 11
+        W(EN_H_TWELVE) | W(EN_OCLOCK)  // 12
+    }
+};
 
 #endif
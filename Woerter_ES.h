@@ -1,7 +1,9 @@
 /**
  * Woerter_ES
  * Definition der spanischen Woerter fuer die Zeitansage.
- * Die Woerter sind Bitmasken fuer die Matrix.
+ * Die Woerter sind Indizes in die Tabelle woerter_ES, dort stehen
+ * Zeile und Bitmaske fuer die Matrix. Dazu kommen die Regeln fuer
+ * die Minuten-Phrasen und die Stunden.
  *
  *   01234567890
  * 0 ESONELASUNA
@@ -17,62 +19,150 @@
  *
  * @mc       Arduino/RBBB
  * @autor    Christian Aschoff / caschoff _AT_ mac _DOT_ com
- * @version  1.0
+ * @version  1.1
  * @created  17.12.2012
- * @updated  13.5.2013
+ * @updated  18.10.2026
+ *
+ * Versionshistorie:
+ * V 1.0:  - Erstellt.
+ * V 1.1:  - Woerter als Index in die Tabelle woerter_ES (Zeile und Bitmaske), Minuten-Phrasen und Stunden als Tabellen (siehe Sprachen.h).
+ *         - Tabellen static, sie gehoeren nur zu Renderer.cpp.
  */
 #ifndef WOERTER_ES_H
 #define WOERTER_ES_H
 
 /**
- * Definition der Woerter.
+ * Definition der Woerter (Index in woerter_ES).
  */
 //                            0       ESONELASUNA
-#define ES_SONLAS      matrix[0] |= 0b0111011100000000
+#define ES_SONLAS      0
 //                            0       ESONELASUNA
-#define ES_ESLA        matrix[0] |= 0b1100011000000000
+#define ES_ESLA        1
 
 //                            6       DOCELYMENOS
-#define ES_Y           matrix[6] |= 0b0000010000000000
+#define ES_Y           2
 //                            6       DOCELYMENOS
-#define ES_MENOS       matrix[6] |= 0b0000001111100000
+#define ES_MENOS       3
 
 //                            8       VEINTICINCO
-#define ES_CINCO       matrix[8] |= 0b0000001111100000
+#define ES_CINCO       4
 //                            7       OVEINTEDIEZ
-#define ES_DIEZ        matrix[7] |= 0b0000000111100000
+#define ES_DIEZ        5
 //                            9       MEDIACUARTO
-#define ES_CUARTO      matrix[9] |= 0b0000011111100000
+#define ES_CUARTO      6
 //                            7       OVEINTEDIEZ
-#define ES_VEINTE      matrix[7] |= 0b0111111000000000
+#define ES_VEINTE      7
 //                            8       VEINTICINCO
-#define ES_VEINTICINCO matrix[8] |= 0b1111111111100000
+#define ES_VEINTICINCO 8
 //                            9       MEDIACUARTO
-#define ES_MEDIA       matrix[9] |= 0b1111100000000000
+#define ES_MEDIA       9
 
 //                            0       ESONELASUNA
-#define ES_H_UNA       matrix[0] |= 0b0000000011100000
+#define ES_H_UNA       10
 //                            1       DOSITRESORE
-#define ES_H_DOS       matrix[1] |= 0b1110000000000000
+#define ES_H_DOS       11
 //                            1       DOSITRESORE
-#define ES_H_TRES      matrix[1] |= 0b0000111100000000
+#define ES_H_TRES      12
 //                            2       CUATROCINCO
-#define ES_H_CUATRO    matrix[2] |= 0b1111110000000000
+#define ES_H_CUATRO    13
 //                            2       CUATROCINCO
-#define ES_H_CINCO     matrix[2] |= 0b0000001111100000
+#define ES_H_CINCO     14
 //                            3       SEISASIETEN
-#define ES_H_SEIS      matrix[3] |= 0b1111000000000000
+#define ES_H_SEIS      15
 //                            3       SEISASIETEN
-#define ES_H_SIETE     matrix[3] |= 0b0000011111000000
+#define ES_H_SIETE     16
 //                            4       OCHONUEVEYO
-#define ES_H_OCHO      matrix[4] |= 0b1111000000000000
+#define ES_H_OCHO      17
 //                            4       OCHONUEVEYO
-#define ES_H_NUEVE     matrix[4] |= 0b0000111110000000
+#define ES_H_NUEVE     18
 //                            5       LADIEZSONCE
-#define ES_H_DIEZ      matrix[5] |= 0b0011110000000000
+#define ES_H_DIEZ      19
 //                            5       LADIEZSONCE
-#define ES_H_ONCE      matrix[5] |= 0b0000000111100000
+#define ES_H_ONCE      20
 //                            6       DOCELYMENOS
-#define ES_H_DOCE      matrix[6] |= 0b1111000000000000
+#define ES_H_DOCE      21
+
+/**
+ * Die Woerter: Zeile und Bitmaske (siehe WORT() in Sprachen.h).
+ */
+static const word woerter_ES[] PROGMEM = {
+    WORT(0, 0b0111011100000000), // ES_SONLAS
+    WORT(0, 0b1100011000000000), // ES_ESLA
+    WORT(6, 0b0000010000000000), // ES_Y
+    WORT(6, 0b0000001111100000), // ES_MENOS
+    WORT(8, 0b0000001111100000), // ES_CINCO
+    WORT(7, 0b0000000111100000), // ES_DIEZ
+    WORT(9, 0b0000011111100000), // ES_CUARTO
+    WORT(7, 0b0111111000000000), // ES_VEINTE
+    WORT(8, 0b1111111111100000), // ES_VEINTICINCO
+    WORT(9, 0b1111100000000000), // ES_MEDIA
+    WORT(0, 0b0000000011100000), // ES_H_UNA
+    WORT(1, 0b1110000000000000), // ES_H_DOS
+    WORT(1, 0b0000111100000000), // ES_H_TRES
+    WORT(2, 0b1111110000000000), // ES_H_CUATRO
+    WORT(2, 0b0000001111100000), // ES_H_CINCO
+    WORT(3, 0b1111000000000000), // ES_H_SEIS
+    WORT(3, 0b0000011111000000), // ES_H_SIETE
+    WORT(4, 0b1111000000000000), // ES_H_OCHO
+    WORT(4, 0b0000111110000000), // ES_H_NUEVE
+    WORT(5, 0b0011110000000000), // ES_H_DIEZ
+    WORT(5, 0b0000000111100000), // ES_H_ONCE
+    WORT(6, 0b1111000000000000)  // ES_H_DOCE
+};
+
+/**
+ * Die Minuten-Phrasen in 5-Minuten-Schritten.
+ */
+static const uint32_t phrasen_ES[] PROGMEM = {
+    0,                                                  // :00
+    W(ES_Y) | W(ES_CINCO),                              // :05
+    W(ES_Y) | W(ES_DIEZ),                               // :10
+    W(ES_Y) | W(ES_CUARTO),                             // :15
+    W(ES_Y) | W(ES_VEINTE),                             // :20
+    W(ES_Y) | W(ES_VEINTICINCO),                        // :25
+    W(ES_Y) | W(ES_MEDIA),                              // :30
+    W(ES_MENOS) | W(ES_VEINTICINCO) | PHRASE_HOUR_NEXT, // :35
+    W(ES_MENOS) | W(ES_VEINTE) | PHRASE_HOUR_NEXT,      // :40
+    W(ES_MENOS) | W(ES_CUARTO) | PHRASE_HOUR_NEXT,      // :45
+    W(ES_MENOS) | W(ES_DIEZ) | PHRASE_HOUR_NEXT,        // :50
+    W(ES_MENOS) | W(ES_CINCO) | PHRASE_HOUR_NEXT        // :55
+};
+
+/**
+ * Die Stunden (0-12, 12 ist Mittag) einmal normal und einmal
+ * als glatte Stunde (PHRASE_HOUR_GLATT).
+ */
+static const uint32_t stunden_ES[][13] PROGMEM = {
+    { // Stunde
+        W(ES_SONLAS) | W(ES_H_DOCE),   // 0
+        W(ES_ESLA) | W(ES_H_UNA),      // 1
+        W(ES_SONLAS) | W(ES_H_DOS),    // 2
+        W(ES_SONLAS) | W(ES_H_TRES),   // 3
+        W(ES_SONLAS) | W(ES_H_CUATRO), // 4
+        W(ES_SONLAS) | W(ES_H_CINCO),  // 5
+        W(ES_SONLAS) | W(ES_H_SEIS),   // 6
+        W(ES_SONLAS) | W(ES_H_SIETE),  // 7
+        W(ES_SONLAS) | W(ES_H_OCHO),   // 8
+        W(ES_SONLAS) | W(ES_H_NUEVE),  // 9
+        W(ES_SONLAS) | W(ES_H_DIEZ),   // 10
+        W(ES_SONLAS) | W(ES_H_ONCE),   // 11
+        W(ES_SONLAS) | W(ES_H_DOCE)    // 12
+    },
+    { // glatte Stunde
+        W(ES_SONLAS) | W(ES_H_DOCE),   // 0
+        W(ES_ESLA) | W(ES_H_UNA),      // 1
+        W(ES_SONLAS) | W(ES_H_DOS),    // 2
+        W(ES_SONLAS) | W(ES_H_TRES),   // 3
+        W(ES_SONLAS) | W(ES_H_CUATRO), // 4
+        W(ES_SONLAS) | W(ES_H_CINCO),  // 5
+        W(ES_SONLAS) | W(ES_H_SEIS),   // 6
+        W(ES_SONLAS) | W(ES_H_SIETE),  // 7
+        W(ES_SONLAS) | W(ES_H_OCHO),   // 8
+        W(ES_SONLAS) | W(ES_H_NUEVE),  // 9
+        W(ES_SONLAS) | W(ES_H_DIEZ),   // 10
+        W(ES_SONLAS) | W(ES_H_ONCE),   // 11
+        W(ES_SONLAS) | W(ES_H_DOCE)    // 12
+    }
+};
 
 #endif
@@ -1,7 +1,9 @@
 /**
  * Woerter_FR
  * Definition der franzoesischen Woerter fuer die Zeitansage.
- * Die Woerter sind Bitmasken fuer die Matrix.
+ * Die Woerter sind Indizes in die Tabelle woerter_FR, dort stehen
+ * Zeile und Bitmaske fuer die Matrix. Dazu kommen die Regeln fuer
+ * die Minuten-Phrasen und die Stunden.
  *
  *   01234567890
  * 0 ILNESTODEUX
@@ -17,42 +19,134 @@
  *
  * @mc       Arduino/RBBB
  * @autor    Christian Aschoff / caschoff _AT_ mac _DOT_ com
- * @version  1.0
+ * @version  1.1
  * @created  12.12.2012
+ * @updated  18.10.2026
+ *
+ * Versionshistorie:
+ * V 1.0:  - Erstellt.
+ * V 1.1:  - Woerter als Index in die Tabelle woerter_FR (Zeile und Bitmaske), Minuten-Phrasen und Stunden als Tabellen (siehe Sprachen.h).
+ *         - Tabellen static, sie gehoeren nur zu Renderer.cpp.
  */
 #ifndef WOERTER_FR_H
 #define WOERTER_FR_H
 
 /**
- * Definition der Woerter
+ * Definition der Woerter (Index in woerter_FR).
  */
 // Trait = Bindestrich (-)
-#define FR_TRAIT        matrix[8] |= 0b0000010000000000
-#define FR_ET           matrix[7] |= 0b1100000000000000
-#define FR_LE           matrix[6] |= 0b0000001100000000
-#define FR_MOINS        matrix[6] |= 0b1111100000000000
-#define FR_ILEST        matrix[0] |= 0b1101110000000000
-#define FR_HEURE        matrix[5] |= 0b0000011111000000
-#define FR_HEURES       matrix[5] |= 0b0000011111100000
+#define FR_TRAIT        0
+#define FR_ET           1
+#define FR_LE           2
+#define FR_MOINS        3
+#define FR_ILEST        4
+#define FR_HEURE        5
+#define FR_HEURES       6
+
+#define FR_CINQ         7
+#define FR_DIX          8
+#define FR_QUART        9
+#define FR_VINGT        10
+#define FR_DEMI         11
+
+#define FR_H_UNE        12
+#define FR_H_DEUX       13
+#define FR_H_TROIS      14
+#define FR_H_QUATRE     15
+#define FR_H_CINQ       16
+#define FR_H_SIX        17
+#define FR_H_SEPT       18
+#define FR_H_HUIT       19
+#define FR_H_NEUF       20
+#define FR_H_DIX        21
+#define FR_H_ONZE       22
+#define FR_H_MIDI       23
+#define FR_H_MINUIT     24
+
+/**
+ * Die Woerter: Zeile und Bitmaske (siehe WORT() in Sprachen.h).
+ */
+static const word woerter_FR[] PROGMEM = {
+    WORT(8, 0b0000010000000000), // FR_TRAIT
+    WORT(7, 0b1100000000000000), // FR_ET
+    WORT(6, 0b0000001100000000), // FR_LE
+    WORT(6, 0b1111100000000000), // FR_MOINS
+    WORT(0, 0b1101110000000000), // FR_ILEST
+    WORT(5, 0b0000011111000000), // FR_HEURE
+    WORT(5, 0b0000011111100000), // FR_HEURES
+    WORT(8, 0b0000001111000000), // FR_CINQ
+    WORT(6, 0b0000000011100000), // FR_DIX
+    WORT(7, 0b0001111100000000), // FR_QUART
+    WORT(8, 0b1111100000000000), // FR_VINGT
+    WORT(9, 0b0001111000000000), // FR_DEMI
+    WORT(2, 0b0000111000000000), // FR_H_UNE
+    WORT(0, 0b0000000111100000), // FR_H_DEUX
+    WORT(1, 0b0000001111100000), // FR_H_TROIS
+    WORT(1, 0b1111110000000000), // FR_H_QUATRE
+    WORT(3, 0b0000000111100000), // FR_H_CINQ
+    WORT(3, 0b0000111000000000), // FR_H_SIX
+    WORT(2, 0b0000000111100000), // FR_H_SEPT
+    WORT(3, 0b1111000000000000), // FR_H_HUIT
+    WORT(2, 0b1111000000000000), // FR_H_NEUF
+    WORT(4, 0b0011100000000000), // FR_H_DIX
+    WORT(5, 0b1111000000000000), // FR_H_ONZE
+    WORT(4, 0b1111000000000000), // FR_H_MIDI
+    WORT(4, 0b0000011111100000)  // FR_H_MINUIT
+};
 
-#define FR_CINQ         matrix[8] |= 0b0000001111000000
-#define FR_DIX          matrix[6] |= 0b0000000011100000
-#define FR_QUART        matrix[7] |= 0b0001111100000000
-#define FR_VINGT        matrix[8] |= 0b1111100000000000
-#define FR_DEMI         matrix[9] |= 0b0001111000000000
+/**
+ * Die Minuten-Phrasen in 5-Minuten-Schritten.
+ */
+static const uint32_t phrasen_FR[] PROGMEM = {
+    W(FR_ILEST) | PHRASE_HOUR_GLATT,                                                       // :00
+    W(FR_ILEST) | W(FR_CINQ),                                                              // :05
+    W(FR_ILEST) | W(FR_DIX),                                                               // :10
+    W(FR_ILEST) | W(FR_ET) | W(FR_QUART),                                                  // :15
+    W(FR_ILEST) | W(FR_VINGT),                                                             // :20
+    W(FR_ILEST) | W(FR_VINGT) | W(FR_TRAIT) | W(FR_CINQ),                                  // :25
+    W(FR_ILEST) | W(FR_ET) | W(FR_DEMI),                                                   // :30
+    W(FR_ILEST) | W(FR_MOINS) | W(FR_VINGT) | W(FR_TRAIT) | W(FR_CINQ) | PHRASE_HOUR_NEXT, // :35
+    W(FR_ILEST) | W(FR_MOINS) | W(FR_VINGT) | PHRASE_HOUR_NEXT,                            // :40
+    W(FR_ILEST) | W(FR_MOINS) | W(FR_LE) | W(FR_QUART) | PHRASE_HOUR_NEXT,                 // :45
+    W(FR_ILEST) | W(FR_MOINS) | W(FR_DIX) | PHRASE_HOUR_NEXT,                              // :50
+    W(FR_ILEST) | W(FR_MOINS) | W(FR_CINQ) | PHRASE_HOUR_NEXT                              // :55
+};
 
-#define FR_H_UNE        matrix[2] |= 0b0000111000000000
-#define FR_H_DEUX       matrix[0] |= 0b0000000111100000
-#define FR_H_TROIS      matrix[1] |= 0b0000001111100000
-#define FR_H_QUATRE     matrix[1] |= 0b1111110000000000
-#define FR_H_CINQ       matrix[3] |= 0b0000000111100000
-#define FR_H_SIX        matrix[3] |= 0b0000111000000000
-#define FR_H_SEPT       matrix[2] |= 0b0000000111100000
-#define FR_H_HUIT       matrix[3] |= 0b1111000000000000
-#define FR_H_NEUF       matrix[2] |= 0b1111000000000000
-#define FR_H_DIX        matrix[4] |= 0b0011100000000000
-#define FR_H_ONZE       matrix[5] |= 0b1111000000000000
-#define FR_H_MIDI       matrix[4] |= 0b1111000000000000
-#define FR_H_MINUIT     matrix[4] |= 0b0000011111100000
+/**
+ * Die Stunden (0-12, 12 ist Mittag) einmal normal und einmal
+ * als glatte Stunde (PHRASE_HOUR_GLATT).
+ */
+static const uint32_t stunden_FR[][13] PROGMEM = {
+    { // Stunde
+        W(FR_H_MINUIT),                // 0
+        W(FR_H_UNE) | W(FR_HEURE),     // 1
+        W(FR_H_DEUX) | W(FR_HEURES),   // 2
+        W(FR_H_TROIS) | W(FR_HEURES),  // 3
+        W(FR_H_QUATRE) | W(FR_HEURES), // 4
+        W(FR_H_CINQ) | W(FR_HEURES),   // 5
+        W(FR_H_SIX) | W(FR_HEURES),    // 6
+        W(FR_H_SEPT) | W(FR_HEURES),   // 7
+        W(FR_H_HUIT) | W(FR_HEURES),   // 8
+        W(FR_H_NEUF) | W(FR_HEURES),   // 9
+        W(FR_H_DIX) | W(FR_HEURES),    // 10
+        W(FR_H_ONZE) | W(FR_HEURES),   // 11
+        W(FR_H_MIDI)                   // 12
+    },
+    { // glatte Stunde
+        W(FR_H_MINUIT),                // 0
+        W(FR_H_UNE) | W(FR_HEURE),     // 1
+        W(FR_H_DEUX) | W(FR_HEURES),   // 2
+        W(FR_H_TROIS) | W(FR_HEURES),  // 3
+        W(FR_H_QUATRE) | W(FR_HEURES), // 4
+        W(FR_H_CINQ) | W(FR_HEURES),   // 5
+        W(FR_H_SIX) | W(FR_HEURES),    // 6
+        W(FR_H_SEPT) | W(FR_HEURES),   // 7
+        W(FR_H_HUIT) | W(FR_HEURES),   // 8
+        W(FR_H_NEUF) | W(FR_HEURES),   // 9
+        W(FR_H_DIX) | W(FR_HEURES),    // 10
+        W(FR_H_ONZE) | W(FR_HEURES),   // 11
+        W(FR_H_MIDI)                   // 12
+    }
+};
 
 #endif
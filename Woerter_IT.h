@@ -1,7 +1,9 @@
 /**
  * Woerter_IT
  * Definition der italienischen Woerter fuer die Zeitansage.
- * Die Woerter sind Bitmasken fuer die Matrix.
+ * Die Woerter sind Indizes in die Tabelle woerter_IT, dort stehen
+ * Zeile und Bitmaske fuer die Matrix. Dazu kommen die Regeln fuer
+ * die Minuten-Phrasen und die Stunden.
  *
  *   01234567890
  * 0 SONORLEBORE
@@ -17,40 +19,131 @@
  *
  * @mc       Arduino/RBBB
  * @autor    Christian Aschoff / caschoff _AT_ mac _DOT_ com
- * @version  1.0
+ * @version  1.1
  * @created  17.12.2012
+ * @updated  18.10.2026
+ *
+ * Versionshistorie:
+ * V 1.0:  - Erstellt.
+ * V 1.1:  - Woerter als Index in die Tabelle woerter_IT (Zeile und Bitmaske), Minuten-Phrasen und Stunden als Tabellen (siehe Sprachen.h).
+ *         - Tabellen static, sie gehoeren nur zu Renderer.cpp.
  */
 #ifndef WOERTER_IT_H
 #define WOERTER_IT_H
 
 /**
- * Definition der Woerter.
+ * Definition der Woerter (Index in woerter_IT).
+ */
+#define IT_SONOLE    0
+#define IT_LE        1
+#define IT_ORE       2
+#define IT_E         3
+
+#define IT_H_LUNA    4
+#define IT_H_DUE     5
+#define IT_H_TRE     6
+#define IT_H_OTTO    7
+#define IT_H_NOVE    8
+#define IT_H_DIECI   9
+#define IT_H_UNDICI  10
+#define IT_H_DODICI  11
+#define IT_H_SETTE   12
+#define IT_H_QUATTRO 13
+#define IT_H_SEI     14
+#define IT_H_CINQUE  15
+
+#define IT_MENO      16
+#define IT_E2        17
+#define IT_UN        18
+#define IT_QUARTO    19
+#define IT_VENTI     20
+#define IT_CINQUE    21
+#define IT_DIECI     22
+#define IT_MEZZA     23
+
+/**
+ * Die Woerter: Zeile und Bitmaske (siehe WORT() in Sprachen.h).
  */
-#define IT_SONOLE    matrix[0] |= 0b1111011000000000
-#define IT_LE        matrix[0] |= 0b0000011000000000
-#define IT_ORE       matrix[0] |= 0b0000000011100000
-#define IT_E         matrix[1] |= 0b1000000000000000
+static const word woerter_IT[] PROGMEM = {
+    WORT(0, 0b1111011000000000), // IT_SONOLE
+    WORT(0, 0b0000011000000000), // IT_LE
+    WORT(0, 0b0000000011100000), // IT_ORE
+    WORT(1, 0b1000000000000000), // IT_E
+    WORT(1, 0b0011110000000000), // IT_H_LUNA
+    WORT(1, 0b0000000111000000), // IT_H_DUE
+    WORT(2, 0b1110000000000000), // IT_H_TRE
+    WORT(2, 0b0001111000000000), // IT_H_OTTO
+    WORT(2, 0b0000000111100000), // IT_H_NOVE
+    WORT(3, 0b1111100000000000), // IT_H_DIECI
+    WORT(3, 0b0000011111100000), // IT_H_UNDICI
+    WORT(4, 0b1111110000000000), // IT_H_DODICI
+    WORT(4, 0b0000001111100000), // IT_H_SETTE
+    WORT(5, 0b1111111000000000), // IT_H_QUATTRO
+    WORT(5, 0b0000000011100000), // IT_H_SEI
+    WORT(6, 0b1111110000000000), // IT_H_CINQUE
+    WORT(6, 0b0000000111100000), // IT_MENO
+    WORT(7, 0b1000000000000000), // IT_E2
+    WORT(7, 0b0011000000000000), // IT_UN
+    WORT(7, 0b0000011111100000), // IT_QUARTO
+    WORT(8, 0b1111100000000000), // IT_VENTI
+    WORT(8, 0b0000011111100000), // IT_CINQUE
+    WORT(9, 0b1111100000000000), // IT_DIECI
+    WORT(9, 0b0000001111100000)  // IT_MEZZA
+};
 
-#define IT_H_LUNA    matrix[1] |= 0b0011110000000000
-#define IT_H_DUE     matrix[1] |= 0b0000000111000000
-#define IT_H_TRE     matrix[2] |= 0b1110000000000000
-#define IT_H_OTTO    matrix[2] |= 0b0001111000000000
-#define IT_H_NOVE    matrix[2] |= 0b0000000111100000
-#define IT_H_DIECI   matrix[3] |= 0b1111100000000000
-#define IT_H_UNDICI  matrix[3] |= 0b0000011111100000
-#define IT_H_DODICI  matrix[4] |= 0b1111110000000000
-#define IT_H_SETTE   matrix[4] |= 0b0000001111100000
-#define IT_H_QUATTRO matrix[5] |= 0b1111111000000000
-#define IT_H_SEI     matrix[5] |= 0b0000000011100000
-#define IT_H_CINQUE  matrix[6] |= 0b1111110000000000
+/**
+ * Die Minuten-Phrasen in 5-Minuten-Schritten.
+ */
+static const uint32_t phrasen_IT[] PROGMEM = {
+    PHRASE_HOUR_GLATT,                                          // :00
+    W(IT_E2) | W(IT_CINQUE),                                    // :05
+    W(IT_E2) | W(IT_DIECI),                                     // :10
+    W(IT_E2) | W(IT_UN) | W(IT_QUARTO),                         // :15
+    W(IT_E2) | W(IT_VENTI),                                     // :20
+    W(IT_E2) | W(IT_VENTI) | W(IT_CINQUE),                      // :25
+    W(IT_E2) | W(IT_MEZZA),                                     // :30
+    W(IT_MENO) | W(IT_VENTI) | W(IT_CINQUE) | PHRASE_HOUR_NEXT, // :35
+    W(IT_MENO) | W(IT_VENTI) | PHRASE_HOUR_NEXT,                // :40
+    W(IT_MENO) | W(IT_UN) | W(IT_QUARTO) | PHRASE_HOUR_NEXT,    // :45
+    W(IT_MENO) | W(IT_DIECI) | PHRASE_HOUR_NEXT,                // :50
+    W(IT_MENO) | W(IT_CINQUE) | PHRASE_HOUR_NEXT                // :55
+};
 
-#define IT_MENO      matrix[6] |= 0b0000000111100000
-#define IT_E2        matrix[7] |= 0b1000000000000000
-#define IT_UN        matrix[7] |= 0b0011000000000000
-#define IT_QUARTO    matrix[7] |= 0b0000011111100000
-#define IT_VENTI     matrix[8] |= 0b1111100000000000
-#define IT_CINQUE    matrix[8] |= 0b0000011111100000
-#define IT_DIECI     matrix[9] |= 0b1111100000000000
-#define IT_MEZZA     matrix[9] |= 0b0000001111100000
+/**
+ * Die Stunden (0-12, 12 ist Mittag) einmal normal und einmal
+ * als glatte Stunde (PHRASE_HOUR_GLATT).
+ */
+static const uint32_t stunden_IT[][13] PROGMEM = {
+    { // Stunde
+        W(IT_SONOLE) | W(IT_H_DODICI),  // 0
+        W(IT_E) | W(IT_H_LUNA),         // 1
+        W(IT_SONOLE) | W(IT_H_DUE),     // 2
+        W(IT_SONOLE) | W(IT_H_TRE),     // 3
+        W(IT_SONOLE) | W(IT_H_QUATTRO), // 4
+        W(IT_SONOLE) | W(IT_H_CINQUE),  // 5
+        W(IT_SONOLE) | W(IT_H_SEI),     // 6
+        W(IT_SONOLE) | W(IT_H_SETTE),   // 7
+        W(IT_SONOLE) | W(IT_H_OTTO),    // 8
+        W(IT_SONOLE) | W(IT_H_NOVE),    // 9
+        W(IT_SONOLE) | W(IT_H_DIECI),   // 10
+        W(IT_SONOLE) | W(IT_H_UNDICI),  // 11
+        W(IT_SONOLE) | W(IT_H_DODICI)   // 12
+    },
+    { // glatte Stunde
+        W(IT_SONOLE) | W(IT_H_DODICI),  // 0
+        W(IT_E) | W(IT_H_LUNA),         // 1
+        W(IT_SONOLE) | W(IT_H_DUE),     // 2
+        W(IT_SONOLE) | W(IT_H_TRE),     // 3
+        W(IT_SONOLE) | W(IT_H_QUATTRO), // 4
+        W(IT_SONOLE) | W(IT_H_CINQUE),  // 5
+        W(IT_SONOLE) | W(IT_H_SEI),     // 6
+        W(IT_SONOLE) | W(IT_H_SETTE),   // 7
+        W(IT_SONOLE) | W(IT_H_OTTO),    // 8
+        W(IT_SONOLE) | W(IT_H_NOVE),    // 9
+        W(IT_SONOLE) | W(IT_H_DIECI),   // 10
+        W(IT_SONOLE) | W(IT_H_UNDICI),  // 11
+        W(IT_SONOLE) | W(IT_H_DODICI)   // 12
+    }
+};
 
 #endif
@@ -1,16 +1,20 @@
 /**
  * Woerter_NL
  * Definition der niederlaendischen Woerter fuer die Zeitansage.
- * Die Woerter sind Bitmasken fuer die Matrix.
+ * Die Woerter sind Indizes in die Tabelle woerter_NL, dort stehen
+ * Zeile und Bitmaske fuer die Matrix. Dazu kommen die Regeln fuer
+ * die Minuten-Phrasen und die Stunden.
  *
  * @mc       Arduino/RBBB
  * @autor    Rudolf Klimesch (Vorlage: Christian Aschoff)
- * @version  1.01
+ * @version  1.02
  * @created  17.1.2013
- * @update   29.9.2014
+ * @update   18.10.2026
  *
  * Historie:
  * V 1.01 - Falsches O bei ZEVEN behoben.
+ * V 1.02 - Woerter als Index in die Tabelle woerter_NL (Zeile und Bitmaske), Minuten-Phrasen und Stunden als Tabellen (siehe Sprachen.h).
+ *          Tabellen static, sie gehoeren nur zu Renderer.cpp.
  *
  */
 #ifndef WOERTER_NL_H
@@ -32,33 +36,118 @@
  */
 
 /**
- * Definition der Woerter
+ * Definition der Woerter (Index in woerter_NL).
  */
-#define NL_VOOR         matrix[1] |= 0b0000000111100000 // VOR
-#define NL_OVER         matrix[2] |= 0b1111000000000000 // NACH
-#define NL_VOOR2        matrix[4] |= 0b1111000000000000 // VOR2
-#define NL_OVER2        matrix[3] |= 0b0000000111100000 // NACH2
-#define NL_HETIS        matrix[0] |= 0b1110110000000000 // ESIST
-#define NL_UUR          matrix[9] |= 0b0000000011100000 // UHR
+#define NL_VOOR         0 // VOR
+#define NL_OVER         1 // NACH
+#define NL_VOOR2        2 // VOR2
+#define NL_OVER2        3 // NACH2
+#define NL_HETIS        4 // ESIST
+#define NL_UUR          5 // UHR
 
-#define NL_VIJF         matrix[0] |= 0b0000000111100000 // FUENF
-#define NL_TIEN         matrix[1] |= 0b1111000000000000 // ZEHN
-#define NL_KWART        matrix[2] |= 0b0000001111100000 // VIERTEL
-#define NL_ZWANZIG      matrix[1] |= 0b0000111111100000 // ZWANZIG
-#define NL_HALF         matrix[3] |= 0b1111000000000000 // HALB
+#define NL_VIJF         6 // FUENF
+#define NL_TIEN         7 // ZEHN
+#define NL_KWART        8 // VIERTEL
+#define NL_ZWANZIG      9 // ZWANZIG
+#define NL_HALF         10 // HALB
 
-#define NL_H_EEN        matrix[4] |= 0b0000000111000000 // H_EIN
-#define NL_H_EENS       matrix[4] |= 0b0000000111100000 // H_EINS
-#define NL_H_TWEE       matrix[5] |= 0b1111000000000000 // H_ZWEI
-#define NL_H_DRIE       matrix[5] |= 0b0000000111100000 // H_DREI
-#define NL_H_VIER       matrix[6] |= 0b1111000000000000 // H_VIER
-#define NL_H_VIJF       matrix[6] |= 0b0000111100000000 // H_FUENF
-#define NL_H_ZES        matrix[6] |= 0b0000000011100000 // H_SECHS
-#define NL_H_ZEVEN      matrix[7] |= 0b1111100000000000 // H_SIEBEN
-#define NL_H_ACHT       matrix[8] |= 0b1111000000000000 // H_ACHT
-#define NL_H_NEGEN      matrix[7] |= 0b0000001111100000 // H_NEUN
-#define NL_H_TIEN       matrix[8] |= 0b0000111100000000 // H_ZEHN
-#define NL_H_ELF        matrix[8] |= 0b0000000011100000 // H_ELF
-#define NL_H_TWAALF     matrix[9] |= 0b1111110000000000 // H_ZWOELF
+#define NL_H_EEN        11 // H_EIN
+#define NL_H_EENS       12 // H_EINS
+#define NL_H_TWEE       13 // H_ZWEI
+#define NL_H_DRIE       14 // H_DREI
+#define NL_H_VIER       15 // H_VIER
+#define NL_H_VIJF       16 // H_FUENF
+#define NL_H_ZES        17 // H_SECHS
+#define NL_H_ZEVEN      18 // H_SIEBEN
+#define NL_H_ACHT       19 // H_ACHT
+#define NL_H_NEGEN      20 // H_NEUN
+#define NL_H_TIEN       21 // H_ZEHN
+#define NL_H_ELF        22 // H_ELF
+#define NL_H_TWAALF     23 // H_ZWOELF
+
+/**
+ * Die Woerter: Zeile und Bitmaske (siehe WORT() in Sprachen.h).
+ */
+static const word woerter_NL[] PROGMEM = {
+    WORT(1, 0b0000000111100000), // NL_VOOR
+    WORT(2, 0b1111000000000000), // NL_OVER
+    WORT(4, 0b1111000000000000), // NL_VOOR2
+    WORT(3, 0b0000000111100000), // NL_OVER2
+    WORT(0, 0b1110110000000000), // NL_HETIS
+    WORT(9, 0b0000000011100000), // NL_UUR
+    WORT(0, 0b0000000111100000), // NL_VIJF
+    WORT(1, 0b1111000000000000), // NL_TIEN
+    WORT(2, 0b0000001111100000), // NL_KWART
+    WORT(1, 0b0000111111100000), // NL_ZWANZIG
+    WORT(3, 0b1111000000000000), // NL_HALF
+    WORT(4, 0b0000000111000000), // NL_H_EEN
+    WORT(4, 0b0000000111100000), // NL_H_EENS
+    WORT(5, 0b1111000000000000), // NL_H_TWEE
+    WORT(5, 0b0000000111100000), // NL_H_DRIE
+    WORT(6, 0b1111000000000000), // NL_H_VIER
+    WORT(6, 0b0000111100000000), // NL_H_VIJF
+    WORT(6, 0b0000000011100000), // NL_H_ZES
+    WORT(7, 0b1111100000000000), // NL_H_ZEVEN
+    WORT(8, 0b1111000000000000), // NL_H_ACHT
+    WORT(7, 0b0000001111100000), // NL_H_NEGEN
+    WORT(8, 0b0000111100000000), // NL_H_TIEN
+    WORT(8, 0b0000000011100000), // NL_H_ELF
+    WORT(9, 0b1111110000000000)  // NL_H_TWAALF
+};
+
+/**
+ * Die Minuten-Phrasen in 5-Minuten-Schritten.
+ */
+static const uint32_t phrasen_NL[] PROGMEM = {
+    W(NL_HETIS) | PHRASE_HOUR_GLATT,                                       // :00
+    W(NL_HETIS) | W(NL_VIJF) | W(NL_OVER),                                 // :05
+    W(NL_HETIS) | W(NL_TIEN) | W(NL_OVER),                                 // :10
+    W(NL_HETIS) | W(NL_KWART) | W(NL_OVER2),                               // :15
+    W(NL_HETIS) | W(NL_TIEN) | W(NL_VOOR) | W(NL_HALF) | PHRASE_HOUR_NEXT, // :20
+    W(NL_HETIS) | W(NL_VIJF) | W(NL_VOOR) | W(NL_HALF) | PHRASE_HOUR_NEXT, // :25
+    W(NL_HETIS) | W(NL_HALF) | PHRASE_HOUR_NEXT,                           // :30
+    W(NL_HETIS) | W(NL_VIJF) | W(NL_OVER) | W(NL_HALF) | PHRASE_HOUR_NEXT, // :35
+    W(NL_HETIS) | W(NL_TIEN) | W(NL_OVER) | W(NL_HALF) | PHRASE_HOUR_NEXT, // :40
+    W(NL_HETIS) | W(NL_KWART) | W(NL_VOOR2) | PHRASE_HOUR_NEXT,            // :45
+    W(NL_HETIS) | W(NL_TIEN) | W(NL_VOOR) | PHRASE_HOUR_NEXT,              // :50
+    W(NL_HETIS) | W(NL_VIJF) | W(NL_VOOR) | PHRASE_HOUR_NEXT               // :55
+};
+
+/**
+ * Die Stunden (0-12, 12 ist Mittag) einmal normal und einmal
+ * als glatte Stunde (PHRASE_HOUR_GLATT).
+ */
+static const uint32_t stunden_NL[][13] PROGMEM = {
+    { // Stunde
+        W(NL_H_TWAALF), // 0
+        W(NL_H_EEN),    // 1
+        W(NL_H_TWEE),   // 2
+        W(NL_H_DRIE),   // 3
+        W(NL_H_VIER),   // 4
+        W(NL_H_VIJF),   // 5
+        W(NL_H_ZES),    // 6
+        W(NL_H_ZEVEN),  // 7
+        W(NL_H_ACHT),   // 8
+        W(NL_H_NEGEN),  // 9
+        W(NL_H_TIEN),   // 10
+        W(NL_H_ELF),    // 11
+        W(NL_H_TWAALF)  // 12
+    },
+    { // glatte Stunde
+        W(NL_H_TWAALF) | W(NL_UUR), // 0
+        W(NL_H_EEN) | W(NL_UUR),    // 1
+        W(NL_H_TWEE) | W(NL_UUR),   // 2
+        W(NL_H_DRIE) | W(NL_UUR),   // 3
+        W(NL_H_VIER) | W(NL_UUR),   // 4
+        W(NL_H_VIJF) | W(NL_UUR),   // 5
+        W(NL_H_ZES) | W(NL_UUR),    // 6
+        W(NL_H_ZEVEN) | W(NL_UUR),  // 7
+        W(NL_H_ACHT) | W(NL_UUR),   // 8
+        W(NL_H_NEGEN) | W(NL_UUR),  // 9
+        W(NL_H_TIEN) | W(NL_UUR),   // 10
+        W(NL_H_ELF) | W(NL_UUR),    // 11
+        W(NL_H_TWAALF) | W(NL_UUR)  // 12
+    }
+};
 
 #endif
@@ -0,0 +1,128 @@
+/**
+ * Bench
+ * Zeitmessung fuer die Benchmarks am Rechner, siehe Bench.h.
+ *
+ * @mc       Host (Linux/macOS)
+ * @autor    agent / agent _AT_ local
+ *           Vorlage von: Christian Aschoff / caschoff _AT_ mac _DOT_ com
+ * @version  1.0
+ * @created  18.10.2026
+ *
+ * Versionshistorie:
+ * V 1.0:  - Erstellt.
+ */
+#include "Bench.h"
+#include "HostArduino.h"
+#include <chrono>
+#include <new>
+#include <stdlib.h>
+#include <string.h>
+
+volatile uint32_t benchSink;
+
+static unsigned long allocations;
+
+void *operator new(size_t size) {
+    allocations++;
+    void *p = malloc(size ? size : 1);
+    if (!p) {
+        throw std::bad_alloc();
+    }
+    return p;
+}
+
+void *operator new[](size_t size) {
+    return operator new(size);
+}
+
+void operator delete(void *p) noexcept {
+    free(p);
+}
+
+void operator delete[](void *p) noexcept {
+    free(p);
+}
+
+void operator delete(void *p, size_t) noexcept {
+    free(p);
+}
+
+void operator delete[](void *p, size_t) noexcept {
+    free(p);
+}
+
+unsigned long benchAllocations() {
+    return allocations;
+}
+
+static uint64_t benchNow() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+static unsigned long benchPixelWrites() {
+    return hostCounters.pixelWrites + hostCounters.ledControlWrites;
+}
+
+bool benchQuick(int argc, char **argv) {
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--quick") == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+Bench::Bench() {
+    _started = 0;
+    _allocationsAtStart = 0;
+    _nanos = 0;
+    _allocations = 0;
+    _pixelWritesAtStart = 0;
+    _pixelWrites = 0;
+    _ops = 0;
+}
+
+void Bench::start() {
+    _allocationsAtStart = allocations;
+    _pixelWritesAtStart = benchPixelWrites();
+    _started = benchNow();
+}
+
+void Bench::stop(unsigned long ops) {
+    _nanos += benchNow() - _started;
+    _allocations += allocations - _allocationsAtStart;
+    _pixelWrites += benchPixelWrites() - _pixelWritesAtStart;
+    _ops += ops;
+}
+
+void Bench::add(const Bench &other) {
+    _nanos += other._nanos;
+    _allocations += other._allocations;
+    _pixelWrites += other._pixelWrites;
+    _ops += other._ops;
+}
+
+double Bench::getNanosPerOp() {
+    return _ops ? (double)_nanos / _ops : 0;
+}
+
+double Bench::getAllocationsPerOp() {
+    return _ops ? (double)_allocations / _ops : 0;
+}
+
+double Bench::getPixelWritesPerOp() {
+    return _ops ? (double)_pixelWrites / _ops : 0;
+}
+
+unsigned long Bench::getOps() {
+    return _ops;
+}
+
+void Bench::printHeader() {
+    printf("%-80s %12s %10s %10s %10s\n", "", "ns/op", "allocs/op", "pixel/op", "ops");
+}
+
+void Bench::report(const char *name) {
+    printf("%-80s %12.1f %10.2f %10.1f %10lu\n", name, getNanosPerOp(), getAllocationsPerOp(), getPixelWritesPerOp(), _ops);
+}
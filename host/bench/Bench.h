@@ -0,0 +1,71 @@
+/**
+ * Bench
+ * Zeitmessung fuer die Benchmarks am Rechner: Nanosekunden pro Aufruf,
+ * Speicheranforderungen (new/malloc ueber operator new) pro Aufruf und
+ * geschriebene Pixel pro Aufruf (setPixelColor() der Streifen und setLed()/
+ * setRow() von LedControl, siehe hostCounters).
+ *
+ * Die Zeiten gelten fuer den Rechner, nicht fuer den AVR. Sie taugen zum
+ * Vergleich zweier Staende derselben Funktion, nicht als Taktzahl.
+ *
+ * @mc       Host (Linux/macOS)
+ * @autor    agent / agent _AT_ local
+ *           Vorlage von: Christian Aschoff / caschoff _AT_ mac _DOT_ com
+ * @version  1.0
+ * @created  18.10.2026
+ *
+ * Versionshistorie:
+ * V 1.0:  - Erstellt.
+ */
+#ifndef BENCH_H
+#define BENCH_H
+
+#include <stdint.h>
+#include <stdio.h>
+
+/**
+ * Eine laufende Messung, mehrere Abschnitte lassen sich aufsummieren
+ * (start()/stop()), am Ende gibt report() eine Zeile aus.
+ */
+class Bench {
+public:
+    Bench();
+
+    void start();
+    void stop(unsigned long ops = 1);
+    // eine einzelne Messung nachtraeglich einer anderen zuschlagen...
+    void add(const Bench &other);
+
+    double getNanosPerOp();
+    double getAllocationsPerOp();
+    double getPixelWritesPerOp();
+    unsigned long getOps();
+
+    void report(const char *name);
+
+    static void printHeader();
+
+private:
+    uint64_t _started;
+    unsigned long _allocationsAtStart;
+    uint64_t _nanos;
+    unsigned long _allocations;
+    unsigned long _pixelWritesAtStart;
+    unsigned long _pixelWrites;
+    unsigned long _ops;
+};
+
+/**
+ * Die Anzahl der Aufrufe von operator new seit dem Start.
+ */
+unsigned long benchAllocations();
+
+/**
+ * --quick: nur ein kurzer Durchlauf (fuer ctest), sonst die volle Anzahl.
+ */
+bool benchQuick(int argc, char **argv);
+
+// Damit der Compiler Ergebnisse nicht wegoptimiert.
+extern volatile uint32_t benchSink;
+
+#endif
@@ -0,0 +1,176 @@
+/**
+ * Dcf77AccumulatorBench
+ * Zeit bis zur Synchronisation gegen die Bitfehlerrate am Rechner, auf
+ * synthetischen Folgen von Telegrammen aus weichen Bits (wie sie der
+ * DCF77Demodulator liefert, pro Minute Bit 0-58).
+ *
+ * Ein weiches Bit ist 127 * (+-1 + Rauschen), auf -127...+127 begrenzt (ohne
+ * Rauschen also ein sicheres Bit wie vom Demodulator). Das Rauschen ist
+ * normalverteilt, die Standardabweichung so gewaehlt, dass das Vorzeichen mit
+ * der angegebenen Rate falsch ist (gemessen wird trotzdem).
+ *
+ * Verglichen werden:
+ * - "Akkumulator": DCF77Accumulator (MYDCF77_ACCUMULATOR), synchron beim
+ *   ersten Telegramm, das er liefert und das MyDCF77::decodeTelegram() besteht.
+ * - "einzeln": ein Telegramm allein (jedes Bit mindestens MYDCF77_MIN_CONFIDENCE
+ *   und MyDCF77::decodeTelegram()), synchron, wenn der echte DCF77Helper
+ *   DCF77HELPER_MAX_SAMPLES passende Telegramme hat (wie im Sketch).
+ * "falsch" zaehlt Synchronisationen auf eine andere als die gesendete Zeit.
+ *
+ * Aufruf: dcf77_accumulator_bench [--quick]
+ *
+ * @mc       Host (Linux/macOS)
+ * @autor    agent / agent _AT_ local
+ *           Vorlage von: Christian Aschoff / caschoff _AT_ mac _DOT_ com
+ * @version  1.1
+ * @created  18.10.2026
+ * @updated  18.10.2026
+ *
+ * Versionshistorie:
+ * V 1.0:  - Erstellt.
+ * V 1.1:  - Decodiert mit MyDCF77::decodeTelegram() statt mit einer eigenen Kopie der Regeln.
+ */
+#include "HostArduino.h"
+#include "Bench.h"
+#include "Dcf77Simulation.h"
+#include "DCF77Accumulator.h"
+#include "DCF77Helper.h"
+#include "MyDCF77.h"
+#include <math.h>
+
+/**
+ * Die Bitfehlerraten und das Rauschen dazu (Q(1 / sigma) = Rate).
+ */
+struct AccScenario {
+    double bitErrorRate;
+    double sigma;
+};
+
+static const AccScenario accScenarios[] = {
+    {0.001, 0.324},
+    {0.01, 0.430},
+    {0.05, 0.608},
+    {0.1, 0.780},
+    {0.2, 1.188},
+    {0.3, 1.907},
+};
+
+/**
+ * Normalverteilt (Box-Muller) aus den reproduzierbaren Zufallszahlen.
+ */
+static double accGaussian(Dcf77Random &random) {
+    double u = random.uniform();
+    double v = random.uniform();
+    return sqrt(-2.0 * log(1.0 - u)) * cos(2.0 * M_PI * v);
+}
+
+/**
+ * Ergebnisse eines Verfahrens ueber alle Seeds.
+ */
+struct AccResult {
+    unsigned long synced;
+    unsigned long wrong;
+    unsigned long minutesSum;
+    unsigned long minutesMax;
+
+    void add(unsigned long minutes, bool correct) {
+        synced++;
+        minutesSum += minutes;
+        if (minutes > minutesMax) {
+            minutesMax = minutes;
+        }
+        if (!correct) {
+            wrong++;
+        }
+    }
+
+    void print(const char *name, unsigned long seeds) {
+        if (synced) {
+            printf("  %-12s %6lu/%-6lu %10.1f %10lu %10lu\n", name, synced, seeds, (double)minutesSum / synced, minutesMax, wrong);
+        } else {
+            printf("  %-12s %6lu/%-6lu %10s %10s %10lu\n", name, synced, seeds, "-", "-", wrong);
+        }
+    }
+};
+
+/**
+ * Fuer jeden Seed eine Folge von Telegrammen ab einer anderen Uhrzeit (mit
+ * Stundenwechseln), bis beide Verfahren synchron sind oder maxMinutes um sind.
+ */
+static void benchScenario(const AccScenario &scenario, unsigned long seeds, unsigned long maxMinutes, bool *cleanOk) {
+    AccResult accumulator = {0, 0, 0, 0};
+    AccResult single = {0, 0, 0, 0};
+    unsigned long bits = 0;
+    unsigned long bitErrors = 0;
+
+    for (unsigned long seed = 1; seed <= seeds; seed++) {
+        Dcf77Random random(seed);
+        Dcf77Time time = {(byte)random.below(60), (byte)(20 + random.below(4)), 18, 7, 10, 26};
+        // die RTC laeuft richtig, steht aber irgendwo...
+        Dcf77Time rtcTime = {0, 0, 1, 4, 1, 26};
+        TimeStamp dcf77(0, 0, 0, 0, 0, 0);
+        TimeStamp rtc(0, 0, 0, 0, 0, 0);
+        DCF77Accumulator acc;
+        DCF77Helper helper;
+        bool accumulatorSynced = false;
+        bool singleSynced = false;
+
+        for (unsigned long minute = 1; (minute <= maxMinutes) && !(accumulatorSynced && singleSynced); minute++) {
+            dcf77NextMinute(time);
+            dcf77NextMinute(rtcTime);
+            uint64_t sent = dcf77Encode(time);
+
+            int8_t softBits[MYDCF77_TELEGRAMMLAENGE + 1];
+            uint64_t hard = 0;
+            bool confident = true;
+            for (byte i = 0; i < MYDCF77_TELEGRAMMLAENGE; i++) {
+                double symbol = ((sent >> i) & 1) ? 1.0 : -1.0;
+                long soft = lround(127.0 * (symbol + scenario.sigma * accGaussian(random)));
+                softBits[i] = constrain(soft, -127, 127);
+                if (softBits[i] > 0) {
+                    hard |= 1ULL << i;
+                }
+                bits++;
+                bitErrors += ((softBits[i] > 0) != (symbol > 0));
+                confident &= (abs(softBits[i]) >= MYDCF77_MIN_CONFIDENCE);
+            }
+            softBits[MYDCF77_TELEGRAMMLAENGE] = 0;
+
+            if (!accumulatorSynced) {
+                acc.addTelegram(softBits);
+                uint64_t telegram;
+                if (acc.getTelegram(&telegram) && MyDCF77::decodeTelegram(telegram, &dcf77)) {
+                    accumulator.add(minute, dcf77Equals(time, &dcf77));
+                    accumulatorSynced = true;
+                }
+            }
+            if (!singleSynced && confident && MyDCF77::decodeTelegram(hard, &dcf77)) {
+                dcf77Set(&rtc, rtcTime);
+                helper.addSample(&dcf77, &rtc);
+                if (helper.samplesOk()) {
+                    single.add(minute, dcf77Equals(time, &dcf77));
+                    singleSynced = true;
+                }
+            }
+        }
+    }
+
+    printf("Bitfehlerrate %.3f (gemessen %.4f)\n", scenario.bitErrorRate, (double)bitErrors / bits);
+    accumulator.print("Akkumulator", seeds);
+    single.print("einzeln", seeds);
+    if (cleanOk) {
+        // bei kleinen Fehlerraten muss der Akkumulator immer, in 5 Minuten und richtig synchronisieren...
+        *cleanOk = (accumulator.synced == seeds) && (accumulator.wrong == 0) && (accumulator.minutesMax <= 5);
+    }
+}
+
+int main(int argc, char **argv) {
+    bool quick = benchQuick(argc, argv);
+    bool ok = true;
+
+    printf("  %-12s %13s %10s %10s %10s\n", "", "synchron", "Minuten", "max", "falsch");
+    for (size_t i = 0; i < sizeof(accScenarios) / sizeof(accScenarios[0]); i++) {
+        benchScenario(accScenarios[i], quick ? 10 : 500, quick ? 30 : 120, (i == 0) ? &ok : 0);
+    }
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,335 @@
+/**
+ * Dcf77DemodulatorBench
+ * Einrastzeit und Bitfehlerrate des DCF77Demodulator am Rechner, auf
+ * synthetischen Signalen mit verschiedenen Stoerungen (Dcf77Simulation) und
+ * auf Aufzeichnungen des DCF77Recorder.
+ *
+ * Das Signal geht wie in MyDCF77 (MYDCF77_EDGE_CAPTURE) als Anteil HIGH pro
+ * 10ms-Slot in den Demodulator. Gezaehlt wird ab dem Einrasten jede
+ * ausgewertete Sekunde: ein Fehler ist ein falsches Bit (weiches Bit 0 gilt
+ * als 0), eine Minutenmarke an der falschen Stelle oder eine fehlende.
+ * "unsicher" sind Bits unter MYDCF77_MIN_CONFIDENCE.
+ *
+ * Bei Aufzeichnungen gibt es kein gesendetes Telegramm. Verglichen wird mit der
+ * RTC-Zeit aus der Aufzeichnung (Minute bis Jahr, Bit 21-58), das stimmt also
+ * nur, wenn die Uhr beim Aufzeichnen richtig ging.
+ *
+ * Aufruf: dcf77_demodulator_bench [--quick] [aufzeichnung...]
+ *
+ * @mc       Host (Linux/macOS)
+ * @autor    agent / agent _AT_ local
+ *           Vorlage von: Christian Aschoff / caschoff _AT_ mac _DOT_ com
+ * @version  1.1
+ * @created  18.10.2026
+ * @updated  18.10.2026
+ *
+ * Versionshistorie:
+ * V 1.0:  - Erstellt.
+ * V 1.1:  - Aufzeichnungen des DCF77Recorder, auch mit kaputten Stuecken (die Zeit springt
+ *           am naechsten Kopf).
+ */
+#include "HostArduino.h"
+#include "Bench.h"
+#include "Dcf77Simulation.h"
+#include "DCF77Demodulator.h"
+#include "DCF77Replay.h"
+#include <string.h>
+
+#define BENCH_SLOT DCF77_DEMOD_SLOT_MICROS
+
+/**
+ * Eine ausgewertete Sekunde (eingerastet): wann sie begann und was herauskam.
+ */
+struct DemodSecond {
+    unsigned long start;
+    int8_t softBit;
+    boolean minuteMark;
+};
+
+/**
+ * Das Signal als Folge von Pegeln in die Slots des Demodulators bringen, wie
+ * MyDCF77::integrateSlots().
+ */
+class DemodFeeder {
+public:
+    DemodFeeder() {
+        _slotStart = 0;
+        _slotHigh = 0;
+        _level = false;
+        _at = 0;
+        _lockTime = 0;
+        _locked = false;
+    }
+
+    // Der Pegel ab time (time nicht kleiner als beim letzten Aufruf).
+    void setLevel(unsigned long time, boolean level) {
+        advance(time);
+        _level = level;
+    }
+
+    // Die Slots bis time abschliessen.
+    void advance(unsigned long time) {
+        while (time >= _slotStart + BENCH_SLOT) {
+            unsigned long end = _slotStart + BENCH_SLOT;
+            if (_level) {
+                _slotHigh += end - _at;
+            }
+            _feed((unsigned long)_slotHigh * 255 / BENCH_SLOT, end);
+            _slotStart = end;
+            _slotHigh = 0;
+            _at = end;
+        }
+        if (_level) {
+            _slotHigh += time - _at;
+        }
+        _at = time;
+    }
+
+    boolean isLocked() {
+        return _locked;
+    }
+
+    unsigned long getLockTime() {
+        return _lockTime;
+    }
+
+    std::vector<DemodSecond> seconds;
+
+private:
+    DCF77Demodulator _demodulator;
+    unsigned long _slotStart;
+    unsigned long _slotHigh;
+    boolean _level;
+    unsigned long _at;
+    unsigned long _lockTime;
+    boolean _locked;
+
+    void _feed(byte level, unsigned long end) {
+        if (!_demodulator.addSlot(level)) {
+            return;
+        }
+        if (!_locked) {
+            _locked = true;
+            _lockTime = end;
+        }
+        // die naechste Sekunde beginnt in getSlotsToSecondStart() Slots, die ausgewertete eine davor...
+        DemodSecond second = {end + _demodulator.getSlotsToSecondStart() * (unsigned long)BENCH_SLOT - DCF77_SIM_SECOND,
+                              _demodulator.getSoftBit(), _demodulator.isMinuteMark()};
+        seconds.push_back(second);
+    }
+};
+
+/**
+ * Fehler, unsichere Bits und ausgewertete Sekunden.
+ */
+struct DemodErrors {
+    unsigned long seconds;
+    unsigned long errors;
+    unsigned long unsure;
+
+    void add(boolean sent, boolean minuteMark, const DemodSecond &second) {
+        seconds++;
+        if (minuteMark || second.minuteMark) {
+            errors += (minuteMark != second.minuteMark);
+            return;
+        }
+        errors += ((second.softBit > 0) != sent);
+        unsure += (abs(second.softBit) < MYDCF77_MIN_CONFIDENCE);
+    }
+};
+
+/**
+ * Eine Stoerung, wie sie neben den LED-Stripes vorkommt.
+ */
+struct DemodScenario {
+    const char *name;
+    Dcf77Noise noise;
+};
+
+static const DemodScenario demodScenarios[] = {
+    {"sauber", {0, 0, 0, 0, 0}},
+    {"Zittern +-10ms", {0, 0, 0, 0, 10000}},
+    {"Spitzen 2/s bis 5ms", {0, 0, 2, 5000, 5000}},
+    {"Spitzen 10/s bis 5ms", {0, 0, 10, 5000, 5000}},
+    {"Spitzen 30/s bis 10ms", {0, 0, 30, 10000, 5000}},
+    {"Spitzen 60/s bis 20ms", {0, 0, 60, 20000, 5000}},
+    {"Aussetzer 5%, Spitzen 2/s", {0, 0.05, 2, 5000, 5000}},
+};
+
+/**
+ * Ein synthetisches Signal pro Seed, Einrastzeit ab dem Beginn des Signals
+ * (Mittel und schlechtester Fall) und Fehler ab dem Einrasten.
+ *
+ * @return FALSE, wenn es nicht eingerastet ist.
+ */
+static bool benchScenario(const DemodScenario &scenario, unsigned long seeds, unsigned long minutes, DemodErrors *total) {
+    DemodErrors errors = {0, 0, 0};
+    double lockSum = 0;
+    double lockMax = 0;
+    unsigned long locked = 0;
+    unsigned long start = 300000;
+
+    for (unsigned long seed = 1; seed <= seeds; seed++) {
+        Dcf77Signal signal(seed);
+        signal.setNoise(scenario.noise);
+        std::vector<uint64_t> telegrams;
+        Dcf77Time time = {0, 12, 18, 7, 10, 26};
+        for (unsigned long m = 0; m < minutes; m++) {
+            dcf77NextMinute(time);
+            telegrams.push_back(dcf77Encode(time));
+            signal.appendMinute(start + m * DCF77_SIM_MINUTE, telegrams.back());
+        }
+
+        DemodFeeder feeder;
+        for (size_t i = 0; i < signal.edges.size(); i++) {
+            feeder.setLevel(signal.edges[i].time, signal.edges[i].level);
+        }
+        feeder.advance(start + minutes * DCF77_SIM_MINUTE);
+        if (!feeder.isLocked()) {
+            continue;
+        }
+        locked++;
+        double lock = (feeder.getLockTime() - start) / 1e6;
+        lockSum += lock;
+        if (lock > lockMax) {
+            lockMax = lock;
+        }
+
+        for (size_t i = 0; i < feeder.seconds.size(); i++) {
+            const DemodSecond &second = feeder.seconds[i];
+            long fromStart = (long)(second.start - start) + (long)DCF77_SIM_SECOND / 2;
+            if ((fromStart < 0) || ((unsigned long)fromStart >= minutes * DCF77_SIM_MINUTE)) {
+                continue;
+            }
+            unsigned long index = fromStart / DCF77_SIM_SECOND;
+            byte bit = index % 60;
+            errors.add(bit < 59 && ((telegrams[index / 60] >> bit) & 1), bit == 59, second);
+        }
+    }
+
+    if (locked) {
+        printf("%-28s %6lu/%-6lu %10.1f %10.1f %10lu %10.5f %10.5f\n", scenario.name, locked, seeds,
+               lockSum / locked, lockMax, errors.seconds,
+               errors.seconds ? (double)errors.errors / errors.seconds : 0.0,
+               errors.seconds ? (double)errors.unsure / errors.seconds : 0.0);
+    } else {
+        printf("%-28s %6lu/%-6lu %10s %10s %10s %10s %10s\n", scenario.name, locked, seeds, "-", "-", "-", "-", "-");
+    }
+    if (total) {
+        *total = errors;
+    }
+    return locked == seeds;
+}
+
+/**
+ * Eine Aufzeichnung abspielen und gegen die RTC-Zeit darin vergleichen.
+ */
+static bool benchRecording(const char *path) {
+    FILE *file = fopen(path, "rb");
+    if (!file) {
+        printf("%s: nicht lesbar\n", path);
+        return false;
+    }
+    DCF77Replay replay;
+    DemodFeeder feeder;
+    // die letzte RTC-Zeit (als Telegramm-Zeit) und wann sie galt...
+    std::vector<std::pair<unsigned long, Dcf77Time> > rtcTimes;
+    // nach einem kaputten Stueck springt die Zeit evtl. zurueck, dann ab der letzten weiter...
+    unsigned long offset = 0;
+    unsigned long last = 0;
+    int c;
+    while ((c = fgetc(file)) != EOF) {
+        switch (replay.feed(c)) {
+            case DCF77_REPLAY_HEADER:
+                if (replay.getTime() + offset < last) {
+                    offset = last - replay.getTime();
+                }
+                break;
+            case DCF77_REPLAY_LEVEL:
+                last = replay.getTime() + offset;
+                feeder.setLevel(last, replay.getLevel());
+                break;
+            case DCF77_REPLAY_TIME: {
+                TimeStamp rtc(0, 0, 0, 0, 0, 0);
+                replay.getRtc(&rtc);
+                Dcf77Time time = {rtc.getMinutes(), rtc.getHours(), rtc.getDate(), rtc.getDayOfWeek(), rtc.getMonth(), rtc.getYear()};
+                // ...auf den Beginn der Minute zurueckgerechnet...
+                rtcTimes.push_back(std::make_pair(replay.getTime() + offset - replay.getRtcSeconds() * DCF77_SIM_SECOND, time));
+                break;
+            }
+        }
+    }
+    fclose(file);
+    if (!replay.getHeaders()) {
+        printf("%s: kein Kopf, keine Aufzeichnung\n", path);
+        return false;
+    }
+    feeder.advance(last);
+
+    // Bit 21-58 der Minuten, die komplett eingerastet empfangen wurden, gegen die RTC...
+    DemodErrors errors = {0, 0, 0};
+    unsigned long minutes = 0;
+    size_t minuteStart = feeder.seconds.size();
+    for (size_t i = 0; i < feeder.seconds.size(); i++) {
+        if (!feeder.seconds[i].minuteMark) {
+            continue;
+        }
+        if ((minuteStart < i) && (i - minuteStart == 59) && !rtcTimes.empty()) {
+            // die Minute, die mit dieser Marke endet (RTC-Zeit davor, weitergezaehlt)...
+            unsigned long end = feeder.seconds[i].start + DCF77_SIM_SECOND;
+            size_t r = 0;
+            while ((r + 1 < rtcTimes.size()) && ((long)(rtcTimes[r + 1].first - end) <= 0)) {
+                r++;
+            }
+            long elapsed = (long)(end - rtcTimes[r].first);
+            if (elapsed >= 0) {
+                Dcf77Time time = rtcTimes[r].second;
+                for (long m = (elapsed + DCF77_SIM_MINUTE / 2) / DCF77_SIM_MINUTE; m > 0; m--) {
+                    dcf77NextMinute(time);
+                }
+                uint64_t telegram = dcf77Encode(time);
+                for (byte bit = 21; bit < 59; bit++) {
+                    errors.add((telegram >> bit) & 1, false, feeder.seconds[minuteStart + bit]);
+                }
+                minutes++;
+            }
+        }
+        minuteStart = i + 1;
+    }
+
+    printf("%s: %.0f s, %lu Koepfe (%lu nach kaputten Stuecken), ", path, last / 1e6, replay.getHeaders(), replay.getResyncs());
+    if (!feeder.isLocked()) {
+        printf("nicht eingerastet\n");
+        return true;
+    }
+    printf("eingerastet nach %.1f s, %lu Sekunden ausgewertet\n", feeder.getLockTime() / 1e6, (unsigned long)feeder.seconds.size());
+    if (minutes) {
+        printf("    %lu Minuten gegen die RTC: %lu Bits, Fehlerrate %.5f, unsicher %.5f\n", minutes, errors.seconds,
+               (double)errors.errors / errors.seconds, (double)errors.unsure / errors.seconds);
+    } else {
+        printf("    keine vollstaendige Minute mit RTC-Zeit\n");
+    }
+    return true;
+}
+
+int main(int argc, char **argv) {
+    bool quick = benchQuick(argc, argv);
+    bool ok = true;
+
+    printf("%-28s %13s %10s %10s %10s %10s %10s\n", "", "eingerastet", "s (Mittel)", "s (max)", "Sekunden", "Fehler", "unsicher");
+    for (size_t i = 0; i < sizeof(demodScenarios) / sizeof(demodScenarios[0]); i++) {
+        DemodErrors errors;
+        bool allLocked = benchScenario(demodScenarios[i], quick ? 2 : 20, quick ? 3 : 10, &errors);
+        // ohne Stoerungen muss es immer einrasten und fehlerfrei sein...
+        if ((i == 0) && (!allLocked || errors.errors || !errors.seconds)) {
+            ok = false;
+        }
+    }
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--quick") != 0) {
+            ok &= benchRecording(argv[i]);
+        }
+    }
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,319 @@
+/**
+ * QlockBench
+ * Benchmark der heissen Pfade der Firmware am Rechner: Renderer::setMinutes
+ * fuer alle Sprachen, Transition::step fuer jeden Effekt, TextScroller::step,
+ * TimeStamp::getMinutesOfCentury, MyDCF77::poll (mit newCycle und decode) und
+ * writeScreenBufferToMatrix fuer alle LED-Treiber.
+ *
+ * Aufruf: qlock_bench [--quick]
+ *
+ * @mc       Host (Linux/macOS)
+ * @autor    agent / agent _AT_ local
+ *           Vorlage von: Christian Aschoff / caschoff _AT_ mac _DOT_ com
+ * @version  1.3
+ * @created  18.10.2026
+ * @updated  18.10.2026
+ *
+ * Versionshistorie:
+ * V 1.0:  - Erstellt.
+ * V 1.1:  - Minutenwechsel mit und ohne Delta.
+ * V 1.2:  - Transition::step pro Schritt fuer jeden Effekt.
+ * V 1.3:  - TextScroller::step pro Spalte.
+ */
+#include "HostArduino.h"
+#include "Bench.h"
+#include "Dcf77Simulation.h"
+#include "Renderer.h"
+#include "Transition.h"
+#include "TextScroller.h"
+#include "TimeStamp.h"
+#include "MyDCF77.h"
+#include "LedDriverDefault.h"
+#include "LedDriverUeberPixel.h"
+#include "LedDriverPowerShiftRegister.h"
+#include "LedDriverNeoPixel.h"
+#include "LedDriverDotStar.h"
+#include "LedDriverLPD8806.h"
+
+#define BENCH_DCF77_PIN 9
+#define BENCH_DCF77_LED 8
+
+static const char *languageNames[LANGUAGE_COUNT + 1] = {
+    "DE_DE", "DE_SW", "DE_BA", "DE_SA", "CH", "EN", "FR", "IT", "NL", "ES"
+};
+
+#ifdef LPD_ALT_LAYOUT
+#define BENCH_LPD8806_NAME "LedDriverLPD8806 (LPD_ALT_LAYOUT)"
+#else
+#define BENCH_LPD8806_NAME "LedDriverLPD8806"
+#endif
+
+/**
+ * Alle Minuten des Tages in allen Sprachen.
+ */
+static void benchRenderer(unsigned long rounds) {
+    Renderer renderer;
+    word matrix[16];
+    char name[64];
+
+    for (byte language = 0; language <= LANGUAGE_COUNT; language++) {
+        Bench bench;
+        bench.start();
+        for (unsigned long r = 0; r < rounds; r++) {
+            for (unsigned int m = 0; m < 24 * 60; m++) {
+                renderer.clearScreenBuffer(matrix);
+                renderer.setMinutes(m / 60, m % 60, language, matrix);
+                benchSink += matrix[m % 10];
+            }
+        }
+        bench.stop(rounds * 24 * 60);
+        snprintf(name, sizeof(name), "Renderer::setMinutes (%s)", languageNames[language]);
+        bench.report(name);
+    }
+}
+
+/**
+ * Die Uebergaenge eines Tages Minutenwechsel (DE_DE mit Ecken), jeder Effekt
+ * Schritt fuer Schritt (step() mit faelligem Schritt, der letzte Schritt
+ * schreibt das Zielbild).
+ */
+static void benchTransition(unsigned long rounds) {
+    static const byte effects[4] = {TRANSITION_WIPE, TRANSITION_TYPEWRITER, TRANSITION_SCATTER, TRANSITION_CROSSFADE};
+    static const char *names[4] = {"Transition::step (WIPE)", "Transition::step (TYPEWRITER)",
+                                   "Transition::step (SCATTER)", "Transition::step (CROSSFADE)"};
+    static word frames[24 * 60][16];
+    Renderer renderer;
+    for (unsigned int m = 0; m < 24 * 60; m++) {
+        renderer.clearScreenBuffer(frames[m]);
+        renderer.setMinutes(m / 60, m % 60, LANGUAGE_DE_DE, frames[m]);
+        renderer.setCorners(m % 60, true, frames[m]);
+    }
+
+    Transition transition;
+    word matrix[16];
+    for (byte e = 0; e < 4; e++) {
+        Bench bench;
+        for (unsigned long r = 0; r < rounds; r++) {
+            for (unsigned int m = 0; m < 24 * 60; m++) {
+                word *from = frames[(m + 24 * 60 - 1) % (24 * 60)];
+                memcpy(matrix, from, sizeof(matrix));
+                transition.begin(from, frames[m], effects[e]);
+                while (transition.isRunning()) {
+                    bench.start();
+                    boolean stepped = transition.step(matrix);
+                    bench.stop(stepped ? 1 : 0);
+                    hostAdvanceMicros(TRANSITION_STEP_MILLIS * 1000UL);
+                }
+                benchSink += matrix[m % 10];
+            }
+        }
+        bench.report(names[e]);
+    }
+}
+
+/**
+ * Der Lauftext Spalte fuer Spalte (step() mit faelligem Schritt), klein und gross.
+ */
+static void benchTextScroller(unsigned long rounds) {
+    static const char *texts[2] = {"SYNC OK", "0123456789"};
+    static const char *names[2] = {"TextScroller::step pro Spalte (SYNC OK)", "TextScroller::step pro Spalte (Ziffern gross)"};
+    TextScroller textScroller;
+    word matrix[16];
+
+    for (byte t = 0; t < 2; t++) {
+        Bench bench;
+        for (unsigned long r = 0; r < rounds; r++) {
+            memset(matrix, 0, sizeof(matrix));
+            textScroller.begin(texts[t], t ? 0 : 2, t == 1, false);
+            while (textScroller.isRunning()) {
+                hostAdvanceMicros(TEXT_SCROLLER_COLUMN_MILLIS * 1000UL);
+                bench.start();
+                boolean stepped = textScroller.step(matrix);
+                bench.stop(stepped ? 1 : 0);
+            }
+            benchSink += matrix[5];
+        }
+        bench.report(names[t]);
+    }
+}
+
+/**
+ * Zeitstempel ueber das ganze Jahrhundert.
+ */
+static void benchTimeStamp(unsigned long rounds) {
+    TimeStamp stamps[64] = {
+        TimeStamp(0, 0, 0, 0, 0, 0), TimeStamp(0, 0, 0, 0, 0, 0), TimeStamp(0, 0, 0, 0, 0, 0), TimeStamp(0, 0, 0, 0, 0, 0),
+        TimeStamp(0, 0, 0, 0, 0, 0), TimeStamp(0, 0, 0, 0, 0, 0), TimeStamp(0, 0, 0, 0, 0, 0), TimeStamp(0, 0, 0, 0, 0, 0),
+        TimeStamp(0, 0, 0, 0, 0, 0), TimeStamp(0, 0, 0, 0, 0, 0), TimeStamp(0, 0, 0, 0, 0, 0), TimeStamp(0, 0, 0, 0, 0, 0),
+        TimeStamp(0, 0, 0, 0, 0, 0), TimeStamp(0, 0, 0, 0, 0, 0), TimeStamp(0, 0, 0, 0, 0, 0), TimeStamp(0, 0, 0, 0, 0, 0),
+        TimeStamp(0, 0, 0, 0, 0, 0), TimeStamp(0, 0, 0, 0, 0, 0), TimeStamp(0, 0, 0, 0, 0, 0), TimeStamp(0, 0, 0, 0, 0, 0),
+        TimeStamp(0, 0, 0, 0, 0, 0), TimeStamp(0, 0, 0, 0, 0, 0), TimeStamp(0, 0, 0, 0, 0, 0), TimeStamp(0, 0, 0, 0, 0, 0),
+        TimeStamp(0, 0, 0, 0, 0, 0), TimeStamp(0, 0, 0, 0, 0, 0), TimeStamp(0, 0, 0, 0, 0, 0), TimeStamp(0, 0, 0, 0, 0, 0),
+        TimeStamp(0, 0, 0, 0, 0, 0), TimeStamp(0, 0, 0, 0, 0, 0), TimeStamp(0, 0, 0, 0, 0, 0), TimeStamp(0, 0, 0, 0, 0, 0),
+        TimeStamp(0, 0, 0, 0, 0, 0), TimeStamp(0, 0, 0, 0, 0, 0), TimeStamp(0, 0, 0, 0, 0, 0), TimeStamp(0, 0, 0, 0, 0, 0),
+        TimeStamp(0, 0, 0, 0, 0, 0), TimeStamp(0, 0, 0, 0, 0, 0), TimeStamp(0, 0, 0, 0, 0, 0), TimeStamp(0, 0, 0, 0, 0, 0),
+        TimeStamp(0, 0, 0, 0, 0, 0), TimeStamp(0, 0, 0, 0, 0, 0), TimeStamp(0, 0, 0, 0, 0, 0), TimeStamp(0, 0, 0, 0, 0, 0),
+        TimeStamp(0, 0, 0, 0, 0, 0), TimeStamp(0, 0, 0, 0, 0, 0), TimeStamp(0, 0, 0, 0, 0, 0), TimeStamp(0, 0, 0, 0, 0, 0),
+        TimeStamp(0, 0, 0, 0, 0, 0), TimeStamp(0, 0, 0, 0, 0, 0), TimeStamp(0, 0, 0, 0, 0, 0), TimeStamp(0, 0, 0, 0, 0, 0),
+        TimeStamp(0, 0, 0, 0, 0, 0), TimeStamp(0, 0, 0, 0, 0, 0), TimeStamp(0, 0, 0, 0, 0, 0), TimeStamp(0, 0, 0, 0, 0, 0),
+        TimeStamp(0, 0, 0, 0, 0, 0), TimeStamp(0, 0, 0, 0, 0, 0), TimeStamp(0, 0, 0, 0, 0, 0), TimeStamp(0, 0, 0, 0, 0, 0),
+        TimeStamp(0, 0, 0, 0, 0, 0), TimeStamp(0, 0, 0, 0, 0, 0), TimeStamp(0, 0, 0, 0, 0, 0), TimeStamp(0, 0, 0, 0, 0, 0)
+    };
+    for (byte i = 0; i < 64; i++) {
+        stamps[i].set((i * 7) % 60, (i * 5) % 24, 1 + (i * 3) % 28, 1 + i % 7, 1 + i % 12, (i * 13) % 100);
+    }
+
+    Bench bench;
+    bench.start();
+    for (unsigned long r = 0; r < rounds; r++) {
+        for (byte i = 0; i < 64; i++) {
+            benchSink += stamps[i].getMinutesOfCentury();
+        }
+    }
+    bench.stop(rounds * 64);
+    bench.report("TimeStamp::getMinutesOfCentury");
+}
+
+/**
+ * MyDCF77::poll() mit einem sauberen Signal und 1ms pro loop(). Die Aufrufe
+ * werden danach getrennt, ob eine Bin-Grenze (newCycle()) und eine
+ * Minutenmarke (decode()) darin lagen.
+ */
+static void benchDcf77(unsigned long minutes) {
+    hostReset();
+    MyDCF77 dcf77(BENCH_DCF77_PIN, BENCH_DCF77_LED);
+    unsigned long binMicros = 1000000 / MYDCF77_SIGNAL_BINS;
+    unsigned long firstBin = micros();
+
+    Dcf77Signal signal(1);
+    Dcf77Time time = {0, 12, 18, 7, 10, 26};
+    // etwas spaeter als die Bins, damit der Impuls mitten in einer Sekunde liegt...
+    unsigned long start = 300000;
+    for (unsigned long m = 0; m < minutes; m++) {
+        dcf77NextMinute(time);
+        signal.appendMinute(start + m * DCF77_SIM_MINUTE, dcf77Encode(time));
+    }
+
+    Bench sample;
+    Bench cycle;
+    Bench decode;
+    unsigned long lastBin = 0;
+    unsigned long synced = 0;
+    Dcf77Loop loop(&signal, BENCH_DCF77_PIN);
+    loop.setLoopMicros(1000);
+    loop.run(start + minutes * DCF77_SIM_MINUTE, [&]() {
+        unsigned long bin = (micros() - firstBin) / binMicros;
+        // Bit 20 (Beginn der Zeitinformation) ist immer 1, nach decode() sind alle Bits geloescht...
+        byte startBit = dcf77.getBitAtPos(20);
+        Bench call;
+        call.start();
+        boolean ok = dcf77.poll(false);
+        call.stop();
+        if (startBit && !dcf77.getBitAtPos(20)) {
+            decode.add(call);
+        } else if (bin != lastBin) {
+            cycle.add(call);
+        } else {
+            sample.add(call);
+        }
+        if (ok) {
+            synced++;
+        }
+        lastBin = bin;
+    });
+    sample.report("MyDCF77::poll (Abtastung)");
+    cycle.report("MyDCF77::poll mit newCycle");
+    decode.report("MyDCF77::poll mit newCycle und decode");
+    benchSink += synced;
+}
+
+/**
+ * Ein Tag Minutenwechsel (onChange), dieselben mit clearData() davor (das
+ * ganze Bild, wie vor dem Delta in LedDriver) und Refresh-Aufrufe ohne Aenderung.
+ * pixel/op zaehlt setPixelColor() und die Register der MAX7219.
+ */
+static void benchDriver(const char *name, LedDriver *driver, unsigned long rounds) {
+    static word frames[24 * 60][16];
+    static boolean framesReady = false;
+    if (!framesReady) {
+        Renderer renderer;
+        for (unsigned int m = 0; m < 24 * 60; m++) {
+            renderer.clearScreenBuffer(frames[m]);
+            renderer.setMinutes(m / 60, m % 60, LANGUAGE_DE_DE, frames[m]);
+            renderer.setCorners(m % 60, true, frames[m]);
+        }
+        framesReady = true;
+    }
+
+    driver->init();
+    driver->setBrightness(50);
+    driver->wakeUp();
+    char label[96];
+
+    Bench change;
+    change.start();
+    for (unsigned long r = 0; r < rounds; r++) {
+        for (unsigned int m = 0; m < 24 * 60; m++) {
+            driver->writeScreenBufferToMatrix(frames[m], true);
+        }
+    }
+    change.stop(rounds * 24 * 60);
+    snprintf(label, sizeof(label), "%s::writeScreenBufferToMatrix (Minute)", name);
+    change.report(label);
+
+    // so wie vor dem Delta: bei jedem Minutenwechsel alles loeschen und neu schreiben...
+    Bench full;
+    full.start();
+    for (unsigned long r = 0; r < rounds; r++) {
+        for (unsigned int m = 0; m < 24 * 60; m++) {
+            driver->clearData();
+            driver->writeScreenBufferToMatrix(frames[m], true);
+        }
+    }
+    full.stop(rounds * 24 * 60);
+    snprintf(label, sizeof(label), "%s::writeScreenBufferToMatrix (Minute, voll)", name);
+    full.report(label);
+
+    Bench refresh;
+    refresh.start();
+    for (unsigned long r = 0; r < rounds * 24 * 60; r++) {
+        driver->writeScreenBufferToMatrix(frames[0], false);
+    }
+    refresh.stop(rounds * 24 * 60);
+    snprintf(label, sizeof(label), "%s::writeScreenBufferToMatrix (Refresh)", name);
+    refresh.report(label);
+}
+
+static void benchDrivers(unsigned long rounds) {
+    hostReset();
+    LedDriverDefault ledDriverDefault(10, 12, 11, 3, 10);
+    benchDriver("LedDriverDefault", &ledDriverDefault, rounds);
+
+    LedDriverUeberPixel ledDriverUeberPixel(5, 6, 7);
+    benchDriver("LedDriverUeberPixel", &ledDriverUeberPixel, rounds);
+
+    LedDriverPowerShiftRegister ledDriverPowerShiftRegister(10, 12, 11, 3);
+    benchDriver("LedDriverPowerShiftRegister", &ledDriverPowerShiftRegister, rounds);
+
+    LedDriverNeoPixel ledDriverNeoPixel(6);
+    benchDriver("LedDriverNeoPixel", &ledDriverNeoPixel, rounds);
+
+    LedDriverDotStar ledDriverDotStar(6, 7);
+    benchDriver("LedDriverDotStar", &ledDriverDotStar, rounds);
+
+    LedDriverLPD8806 ledDriverLPD8806(6, 7);
+    benchDriver(BENCH_LPD8806_NAME, &ledDriverLPD8806, rounds);
+}
+
+int main(int argc, char **argv) {
+    bool quick = benchQuick(argc, argv);
+
+    Bench::printHeader();
+    benchRenderer(quick ? 1 : 50);
+    benchTransition(quick ? 1 : 20);
+    benchTextScroller(quick ? 10 : 20000);
+    benchTimeStamp(quick ? 100 : 200000);
+    benchDcf77(quick ? 3 : 60);
+    benchDrivers(quick ? 1 : 10);
+    return 0;
+}
@@ -0,0 +1,91 @@
+/**
+ * ShiftRegisterBench
+ * Vergleich der Ausgabe auf die 74HC595 mit Bit-Banging (digitalWrite()),
+ * SHIFTREGISTER_TURBO und SHIFTREGISTER_SPI. Die Betriebsart steht fest, wenn
+ * ShiftRegister uebersetzt wird, deshalb gibt es das Programm dreimal
+ * (shift_register_bench, _turbo und _spi).
+ *
+ * Gezaehlt wird pro Zeile (Spalten und Zeile als 32 Bit mit Latch, wie in
+ * LedDriverDefault) und pro Bild (LedDriverDefault::writeScreenBufferToMatrix
+ * mit 10 Zeilen), was auf dem AVR die Zeit kostet:
+ * - digitalWrite(): jeder Aufruf sucht Port und Bit und sperrt dabei die
+ *   Interrupts (SREG sichern, cli(), schreiben, SREG zurueck),
+ * - cli(): die fastDigitalWrite*-Methoden, jeweils ein Portzugriff mit
+ *   gesperrten Interrupts,
+ * - SPI-Bytes: je 8 Takte des SPI-Takts (SHIFTREGISTER_SPI_CLOCK) ohne
+ *   gesperrte Interrupts.
+ * Zeiten misst das Programm nicht: cli()/sei() und SREG sind am Rechner
+ * nachgebildet und viel teurer als auf dem AVR.
+ *
+ * Aufruf: shift_register_bench[_turbo|_spi] [--quick]
+ *
+ * @mc       Host (Linux/macOS)
+ * @autor    agent / agent _AT_ local
+ *           Vorlage von: Christian Aschoff / caschoff _AT_ mac _DOT_ com
+ * @version  1.0
+ * @created  18.10.2026
+ *
+ * Versionshistorie:
+ * V 1.0:  - Erstellt.
+ */
+#include "HostArduino.h"
+#include "Bench.h"
+#include "ShiftRegister.h"
+#include "LedDriverDefault.h"
+
+#ifdef SHIFTREGISTER_SPI
+#define BENCH_MODE "SPI"
+#elif defined(SHIFTREGISTER_TURBO)
+#define BENCH_MODE "TURBO"
+#else
+#define BENCH_MODE "Bit-Banging"
+#endif
+
+/**
+ * Die Zaehler seit dem letzten hostResetCounters() pro Aufruf ausgeben.
+ */
+static void reportCounters(const char *name, unsigned long ops) {
+    printf("%-48s %14.1f %10.1f %10.1f\n", name, (double)hostCounters.digitalWrites / ops,
+           (double)hostCounters.interruptDisables / ops, (double)hostCounters.spiBytes / ops);
+}
+
+int main(int argc, char **argv) {
+    bool quick = benchQuick(argc, argv);
+    unsigned long rounds = quick ? 100 : 10000;
+
+    hostReset();
+    printf("%-48s %14s %10s %10s\n", BENCH_MODE, "digitalWrite", "cli()", "SPI-Byte");
+
+    // die Pins wie auf der Platine (mit SPI umverdrahtet, siehe Configuration.h)...
+#ifdef SHIFTREGISTER_SPI
+    ShiftRegister shiftRegister(11, 13, 10);
+#else
+    ShiftRegister shiftRegister(10, 12, 11);
+#endif
+    shiftRegister.begin();
+    hostResetCounters();
+    for (unsigned long r = 0; r < rounds; r++) {
+        shiftRegister.prepareShiftregisterWrite();
+        shiftRegister.shiftOut(~(word)r, 1 << (r % 10));
+        shiftRegister.finishShiftregisterWrite();
+    }
+    reportCounters("ShiftRegister (Zeile, 32 Bit mit Latch)", rounds);
+
+#ifdef SHIFTREGISTER_SPI
+    LedDriverDefault driver(11, 13, 10, 3, 10);
+#else
+    LedDriverDefault driver(10, 12, 11, 3, 10);
+#endif
+    driver.init();
+    driver.setBrightness(50);
+    driver.wakeUp();
+    word matrix[16] = {0x3FF, 0x155, 0x2AA, 0x3FF, 0x001, 0x200, 0x0F0, 0x30F, 0x111, 0x222, 0, 0, 0, 0, 0, 0};
+    hostResetCounters();
+    for (unsigned long r = 0; r < rounds / 10; r++) {
+        driver.writeScreenBufferToMatrix(matrix, false);
+    }
+    reportCounters("LedDriverDefault::writeScreenBufferToMatrix", rounds / 10);
+
+    benchSink = hostGetPin(10);
+    return 0;
+}
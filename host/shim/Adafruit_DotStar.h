@@ -0,0 +1,58 @@
+/**
+ * Adafruit_DotStar (Host)
+ * Der Streifen als Puffer mit drei Bytes pro LED in der Reihenfolge des
+ * Streifens (DOTSTAR_BGR: Blau, Gruen, Rot), wie in der Bibliothek.
+ * show() zaehlt nur, das Helligkeitsfeld waere immer 31.
+ *
+ * @mc       Host (Linux/macOS)
+ * @autor    agent / agent _AT_ local
+ *           Vorlage von: Christian Aschoff / caschoff _AT_ mac _DOT_ com
+ * @version  1.0
+ * @created  18.10.2026
+ *
+ * Versionshistorie:
+ * V 1.0:  - Erstellt.
+ */
+#ifndef HOST_ADAFRUIT_DOTSTAR_H
+#define HOST_ADAFRUIT_DOTSTAR_H
+
+#include "Arduino.h"
+
+// Offsets wie in der Bibliothek: Bit 0-1 Rot, Bit 2-3 Gruen, Bit 4-5 Blau.
+#define DOTSTAR_RGB (0 | (1 << 2) | (2 << 4))
+#define DOTSTAR_RBG (0 | (2 << 2) | (1 << 4))
+#define DOTSTAR_GRB (1 | (0 << 2) | (2 << 4))
+#define DOTSTAR_GBR (2 | (0 << 2) | (1 << 4))
+#define DOTSTAR_BRG (1 | (2 << 2) | (0 << 4))
+#define DOTSTAR_BGR (2 | (1 << 2) | (0 << 4))
+
+class Adafruit_DotStar {
+public:
+    Adafruit_DotStar(uint16_t n, uint8_t data, uint8_t clock, uint8_t order = DOTSTAR_BGR);
+    ~Adafruit_DotStar();
+
+    void begin();
+    void show();
+    void clear();
+    void setBrightness(uint8_t brightness);
+
+    void setPixelColor(uint16_t n, uint32_t c);
+    void setPixelColor(uint16_t n, uint8_t r, uint8_t g, uint8_t b);
+    uint32_t getPixelColor(uint16_t n) const;
+    uint8_t *getPixels() const;
+    uint16_t numPixels() const;
+
+    static uint32_t Color(uint8_t r, uint8_t g, uint8_t b) {
+        return ((uint32_t)r << 16) | ((uint32_t)g << 8) | b;
+    }
+
+    // die zuletzt angelegte Instanz (die Treiber legen ihre im Konstruktor an)...
+    static Adafruit_DotStar *hostLast;
+
+private:
+    uint16_t _numLEDs;
+    uint8_t *_pixels;
+    uint8_t _rOffset, _gOffset, _bOffset;
+};
+
+#endif
@@ -0,0 +1,54 @@
+/**
+ * Adafruit_NeoPixel (Host)
+ * Der Streifen als Puffer mit drei Bytes pro LED in der Reihenfolge des
+ * Streifens (NEO_GRB), wie in der Bibliothek. show() zaehlt nur.
+ *
+ * @mc       Host (Linux/macOS)
+ * @autor    agent / agent _AT_ local
+ *           Vorlage von: Christian Aschoff / caschoff _AT_ mac _DOT_ com
+ * @version  1.0
+ * @created  18.10.2026
+ *
+ * Versionshistorie:
+ * V 1.0:  - Erstellt.
+ */
+#ifndef HOST_ADAFRUIT_NEOPIXEL_H
+#define HOST_ADAFRUIT_NEOPIXEL_H
+
+#include "Arduino.h"
+
+// Offsets wie in der Bibliothek: Bit 4-5 Rot, Bit 2-3 Gruen, Bit 0-1 Blau (ohne Weiss).
+#define NEO_RGB ((0 << 6) | (0 << 4) | (1 << 2) | (2))
+#define NEO_GRB ((1 << 6) | (1 << 4) | (0 << 2) | (2))
+#define NEO_KHZ800 0x0000
+
+class Adafruit_NeoPixel {
+public:
+    Adafruit_NeoPixel(uint16_t n, uint8_t pin, uint16_t type);
+    ~Adafruit_NeoPixel();
+
+    void begin();
+    void show();
+    void clear();
+    void setBrightness(uint8_t brightness);
+
+    void setPixelColor(uint16_t n, uint32_t c);
+    void setPixelColor(uint16_t n, uint8_t r, uint8_t g, uint8_t b);
+    uint32_t getPixelColor(uint16_t n) const;
+    uint8_t *getPixels() const;
+    uint16_t numPixels() const;
+
+    static uint32_t Color(uint8_t r, uint8_t g, uint8_t b) {
+        return ((uint32_t)r << 16) | ((uint32_t)g << 8) | b;
+    }
+
+    // die zuletzt angelegte Instanz (die Treiber legen ihre im Konstruktor an)...
+    static Adafruit_NeoPixel *hostLast;
+
+private:
+    uint16_t _numLEDs;
+    uint8_t *_pixels;
+    uint8_t _rOffset, _gOffset, _bOffset;
+};
+
+#endif
@@ -0,0 +1,457 @@
+/**
+ * Arduino (Host)
+ * Zeit, Pins, Interrupts und Serial am Rechner, siehe Arduino.h und HostArduino.h.
+ *
+ * @mc       Host (Linux/macOS)
+ * @autor    agent / agent _AT_ local
+ *           Vorlage von: Christian Aschoff / caschoff _AT_ mac _DOT_ com
+ * @version  1.0
+ * @created  18.10.2026
+ *
+ * Versionshistorie:
+ * V 1.0:  - Erstellt.
+ */
+#include "HostArduino.h"
+#include <stdio.h>
+
+HostCounters hostCounters;
+
+volatile uint8_t hostPorts[HOST_NUM_PINS / 8 + 1];
+
+HostStatusRegister SREG;
+volatile uint8_t hostTCCR1A;
+volatile uint8_t hostTCCR1B;
+volatile uint16_t hostOCR1A;
+volatile uint16_t hostTCNT1;
+volatile uint8_t hostTIFR1;
+volatile uint8_t hostTIMSK1;
+
+HardwareSerial Serial;
+HardwareSerial Serial1;
+
+static unsigned long hostMicros;
+static uint8_t hostSreg = _BV(SREG_I);
+static uint8_t hostPinModes[HOST_NUM_PINS];
+static int hostAnalog[HOST_NUM_PINS];
+
+static void (*hostIsr[HOST_NUM_PINS])(void);
+static int hostIsrMode[HOST_NUM_PINS];
+static bool hostIsrPending[HOST_NUM_PINS];
+
+static void (*hostDigitalWriteHook)(uint8_t pin, uint8_t val);
+
+static int hostSerialRoom = 63;
+static bool hostSerialEcho;
+// Mit hostSetSerialBaud() die belegten Bytes im Sendepuffer (Serial, Serial1) und wann zuletzt geleert.
+static unsigned long hostSerialBaud;
+static int hostSerialQueued[2];
+static unsigned long hostSerialDrainedAt[2];
+
+void hostResetEeprom();
+void hostResetLibraries();
+
+void hostReset() {
+    hostMicros = 0;
+    hostSreg = _BV(SREG_I);
+    memset((void *)hostPorts, 0, sizeof(hostPorts));
+    memset(hostPinModes, INPUT, sizeof(hostPinModes));
+    memset(hostAnalog, 0, sizeof(hostAnalog));
+    for (byte i = 0; i < HOST_NUM_PINS; i++) {
+        hostIsr[i] = 0;
+        hostIsrPending[i] = false;
+    }
+    hostTCCR1A = 0;
+    hostTCCR1B = 0;
+    hostOCR1A = 0;
+    hostTCNT1 = 0;
+    hostTIFR1 = 0;
+    hostTIMSK1 = 0;
+    hostSerialOutput().clear();
+    hostSerial1Output().clear();
+    hostSerialRoom = 63;
+    hostSerialBaud = 0;
+    for (byte i = 0; i < 2; i++) {
+        hostSerialQueued[i] = 0;
+        hostSerialDrainedAt[i] = 0;
+    }
+    hostResetEeprom();
+    hostResetLibraries();
+    hostResetCounters();
+}
+
+void hostResetCounters() {
+    memset(&hostCounters, 0, sizeof(hostCounters));
+}
+
+/*
+ * Zeit
+ */
+void hostSetMicros(unsigned long micros) {
+    hostMicros = micros;
+}
+
+void hostAdvanceMicros(unsigned long micros) {
+    hostMicros += micros;
+}
+
+unsigned long micros() {
+    return hostMicros;
+}
+
+unsigned long millis() {
+    return hostMicros / 1000;
+}
+
+void delay(unsigned long ms) {
+    hostMicros += ms * 1000;
+}
+
+void delayMicroseconds(unsigned int us) {
+    hostMicros += us;
+}
+
+/*
+ * Interrupts
+ */
+static void hostRunPendingInterrupts() {
+    for (byte i = 0; i < HOST_NUM_PINS; i++) {
+        if (hostIsrPending[i] && (hostSreg & _BV(SREG_I))) {
+            hostIsrPending[i] = false;
+            if (hostIsr[i]) {
+                // wie auf dem AVR laeuft die Routine mit gesperrten Interrupts...
+                hostSreg &= ~_BV(SREG_I);
+                hostIsr[i]();
+                hostSreg |= _BV(SREG_I);
+            }
+        }
+    }
+}
+
+HostStatusRegister::operator uint8_t() const {
+    return hostSreg;
+}
+
+HostStatusRegister &HostStatusRegister::operator=(uint8_t value) {
+    hostCounters.sregWrites++;
+    hostSreg = value;
+    hostRunPendingInterrupts();
+    return *this;
+}
+
+void cli() {
+    hostCounters.interruptDisables++;
+    hostSreg &= ~_BV(SREG_I);
+}
+
+void sei() {
+    hostCounters.interruptEnables++;
+    hostSreg |= _BV(SREG_I);
+    hostRunPendingInterrupts();
+}
+
+void attachInterrupt(int interruptNum, void (*userFunc)(void), int mode) {
+    if ((interruptNum >= 0) && (interruptNum < HOST_NUM_PINS)) {
+        hostIsr[interruptNum] = userFunc;
+        hostIsrMode[interruptNum] = mode;
+    }
+}
+
+void detachInterrupt(int interruptNum) {
+    if ((interruptNum >= 0) && (interruptNum < HOST_NUM_PINS)) {
+        hostIsr[interruptNum] = 0;
+        hostIsrPending[interruptNum] = false;
+    }
+}
+
+/*
+ * Pins
+ */
+void hostSetPin(uint8_t pin, uint8_t level) {
+    uint8_t old = hostGetPin(pin);
+    if (level) {
+        hostPorts[digitalPinToPort(pin)] |= digitalPinToBitMask(pin);
+    } else {
+        hostPorts[digitalPinToPort(pin)] &= ~digitalPinToBitMask(pin);
+    }
+    if ((old == level) || !hostIsr[pin]) {
+        return;
+    }
+    int mode = hostIsrMode[pin];
+    if ((mode == CHANGE) || ((mode == RISING) && level) || ((mode == FALLING) && !level)) {
+        hostIsrPending[pin] = true;
+        hostRunPendingInterrupts();
+    }
+}
+
+uint8_t hostGetPin(uint8_t pin) {
+    return (hostPorts[digitalPinToPort(pin)] & digitalPinToBitMask(pin)) ? HIGH : LOW;
+}
+
+uint8_t hostGetPinMode(uint8_t pin) {
+    return hostPinModes[pin];
+}
+
+void hostSetAnalog(uint8_t pin, int value) {
+    hostAnalog[pin] = value;
+}
+
+void hostSetDigitalWriteHook(void (*hook)(uint8_t pin, uint8_t val)) {
+    hostDigitalWriteHook = hook;
+}
+
+void pinMode(uint8_t pin, uint8_t mode) {
+    if (pin < HOST_NUM_PINS) {
+        hostPinModes[pin] = mode;
+    }
+}
+
+void digitalWrite(uint8_t pin, uint8_t val) {
+    if (pin >= HOST_NUM_PINS) {
+        return;
+    }
+    hostCounters.digitalWrites++;
+    if (val) {
+        hostPorts[digitalPinToPort(pin)] |= digitalPinToBitMask(pin);
+    } else {
+        hostPorts[digitalPinToPort(pin)] &= ~digitalPinToBitMask(pin);
+    }
+    if (hostDigitalWriteHook) {
+        hostDigitalWriteHook(pin, val);
+    }
+}
+
+int digitalRead(uint8_t pin) {
+    if (pin >= HOST_NUM_PINS) {
+        return LOW;
+    }
+    return hostGetPin(pin);
+}
+
+int analogRead(uint8_t pin) {
+    if (pin >= HOST_NUM_PINS) {
+        return 0;
+    }
+    return hostAnalog[pin];
+}
+
+void analogWrite(uint8_t pin, int val) {
+    digitalWrite(pin, val > 127 ? HIGH : LOW);
+}
+
+void tone(uint8_t pin, unsigned int frequency, unsigned long duration) {
+    (void)pin;
+    (void)frequency;
+    (void)duration;
+}
+
+void noTone(uint8_t pin) {
+    (void)pin;
+}
+
+void shiftOut(uint8_t dataPin, uint8_t clockPin, uint8_t bitOrder, uint8_t val) {
+    for (uint8_t i = 0; i < 8; i++) {
+        if (bitOrder == LSBFIRST) {
+            digitalWrite(dataPin, (val >> i) & 1);
+        } else {
+            digitalWrite(dataPin, (val >> (7 - i)) & 1);
+        }
+        digitalWrite(clockPin, HIGH);
+        digitalWrite(clockPin, LOW);
+    }
+}
+
+/*
+ * Mathe
+ */
+long map(long x, long inMin, long inMax, long outMin, long outMax) {
+    return (x - inMin) * (outMax - outMin) / (inMax - inMin) + outMin;
+}
+
+long random(long howBig) {
+    if (howBig == 0) {
+        return 0;
+    }
+    return rand() % howBig;
+}
+
+long random(long howSmall, long howBig) {
+    if (howSmall >= howBig) {
+        return howSmall;
+    }
+    return random(howBig - howSmall) + howSmall;
+}
+
+void randomSeed(unsigned long seed) {
+    srand((unsigned int)seed);
+}
+
+/*
+ * Serial
+ */
+// lokal, damit die Puffer auch fuer Ausgaben aus globalen Konstruktoren schon da sind...
+std::string &hostSerialOutput() {
+    static std::string output;
+    return output;
+}
+
+std::string &hostSerial1Output() {
+    static std::string output;
+    return output;
+}
+
+void hostSetSerialRoom(int room) {
+    hostSerialRoom = room;
+}
+
+void hostSetSerialEcho(bool echo) {
+    hostSerialEcho = echo;
+}
+
+void hostSetSerialBaud(unsigned long baud) {
+    hostSerialBaud = baud;
+    for (byte i = 0; i < 2; i++) {
+        hostSerialQueued[i] = 0;
+        hostSerialDrainedAt[i] = hostMicros;
+    }
+}
+
+/**
+ * Was seit dem letzten Aufruf gesendet wurde (10 Bit pro Byte), aus dem Puffer nehmen.
+ */
+static int &hostSerialDrain(HardwareSerial *serial) {
+    byte port = (serial == &Serial1) ? 1 : 0;
+    if (!hostSerialBaud) {
+        hostSerialQueued[port] = 0;
+        return hostSerialQueued[port];
+    }
+    unsigned long long sent = (unsigned long long)(hostMicros - hostSerialDrainedAt[port]) * hostSerialBaud / 10000000ULL;
+    if (sent >= (unsigned long long)hostSerialQueued[port]) {
+        hostSerialQueued[port] = 0;
+        hostSerialDrainedAt[port] = hostMicros;
+    } else {
+        hostSerialQueued[port] -= (int)sent;
+        hostSerialDrainedAt[port] += (unsigned long)(sent * 10000000ULL / hostSerialBaud);
+    }
+    return hostSerialQueued[port];
+}
+
+void HardwareSerial::begin(unsigned long baud) {
+    (void)baud;
+}
+
+void HardwareSerial::end() {
+}
+
+int HardwareSerial::available() {
+    return 0;
+}
+
+int HardwareSerial::read() {
+    return -1;
+}
+
+int HardwareSerial::availableForWrite() {
+    return max(hostSerialRoom - hostSerialDrain(this), 0);
+}
+
+void HardwareSerial::flush() {
+}
+
+size_t HardwareSerial::write(uint8_t b) {
+    hostCounters.serialBytes++;
+    int &queued = hostSerialDrain(this);
+    if (queued >= hostSerialRoom) {
+        // das Arduino wuerde hier warten, bis wieder Platz ist...
+        hostCounters.serialOverflows++;
+    } else if (hostSerialBaud) {
+        queued++;
+    }
+    if (this == &Serial1) {
+        hostSerial1Output().push_back((char)b);
+    } else {
+        hostSerialOutput().push_back((char)b);
+        if (hostSerialEcho) {
+            fputc(b, stdout);
+        }
+    }
+    return 1;
+}
+
+size_t HardwareSerial::write(const uint8_t *buffer, size_t size) {
+    for (size_t i = 0; i < size; i++) {
+        write(buffer[i]);
+    }
+    return size;
+}
+
+size_t HardwareSerial::write(const char *str) {
+    return write((const uint8_t *)str, strlen(str));
+}
+
+size_t HardwareSerial::print(const __FlashStringHelper *s) {
+    return write(reinterpret_cast<const char *>(s));
+}
+
+size_t HardwareSerial::print(const char *s) {
+    return write(s);
+}
+
+size_t HardwareSerial::print(char c) {
+    return write((uint8_t)c);
+}
+
+size_t HardwareSerial::print(unsigned char b, int base) {
+    return _printNumber(b, base);
+}
+
+size_t HardwareSerial::print(int n, int base) {
+    return print((long long)n, base);
+}
+
+size_t HardwareSerial::print(unsigned int n, int base) {
+    return _printNumber(n, base);
+}
+
+size_t HardwareSerial::print(long n, int base) {
+    return print((long long)n, base);
+}
+
+size_t HardwareSerial::print(unsigned long n, int base) {
+    return _printNumber(n, base);
+}
+
+size_t HardwareSerial::print(long long n, int base) {
+    if ((base == DEC) && (n < 0)) {
+        return write('-') + _printNumber(-(unsigned long long)n, base);
+    }
+    return _printNumber((unsigned long long)n, base);
+}
+
+size_t HardwareSerial::print(unsigned long long n, int base) {
+    return _printNumber(n, base);
+}
+
+size_t HardwareSerial::print(double n, int digits) {
+    char buffer[48];
+    snprintf(buffer, sizeof(buffer), "%.*f", digits, n);
+    return write(buffer);
+}
+
+size_t HardwareSerial::println() {
+    return write('\r') + write('\n');
+}
+
+size_t HardwareSerial::_printNumber(unsigned long long n, int base) {
+    char buffer[8 * sizeof(n) + 1];
+    char *str = &buffer[sizeof(buffer) - 1];
+    *str = '\0';
+    if (base < 2) {
+        base = 10;
+    }
+    do {
+        char c = n % base;
+        n /= base;
+        *--str = c < 10 ? c + '0' : c + 'A' - 10;
+    } while (n);
+    return write(str);
+}
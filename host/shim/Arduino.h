@@ -0,0 +1,191 @@
+/**
+ * Arduino (Host)
+ * Ersatz fuer die Arduino-Umgebung, damit die Klassen der Firmware am Rechner
+ * uebersetzt, getestet und gemessen werden koennen (siehe host/CMakeLists.txt).
+ * Zeit, Pins, Interrupts und Serial werden ueber HostArduino.h gesteuert.
+ *
+ * Unterschiede zum Arduino: int hat 32 Bit, unsigned long 64 Bit. micros()
+ * und millis() laufen deshalb nicht nach 71 Minuten bzw. 49 Tagen ueber.
+ *
+ * @mc       Host (Linux/macOS)
+ * @autor    agent / agent _AT_ local
+ *           Vorlage von: Christian Aschoff / caschoff _AT_ mac _DOT_ com
+ * @version  1.0
+ * @created  18.10.2026
+ *
+ * Versionshistorie:
+ * V 1.0:  - Erstellt.
+ */
+#ifndef HOST_ARDUINO_SHIM_H
+#define HOST_ARDUINO_SHIM_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <stdio.h>
+
+#include <avr/pgmspace.h>
+#include <avr/io.h>
+#include <avr/interrupt.h>
+
+typedef bool boolean;
+typedef uint8_t byte;
+typedef uint16_t word;
+
+#define HIGH 0x1
+#define LOW  0x0
+
+#define INPUT 0x0
+#define OUTPUT 0x1
+#define INPUT_PULLUP 0x2
+
+#define CHANGE 1
+#define FALLING 2
+#define RISING 3
+
+#define LSBFIRST 0
+#define MSBFIRST 1
+
+/*
+ * Die Pins: 0-31, A0-A7 sind 14-21 wie beim ATmega328. Jeweils acht Pins
+ * bilden einen Port (1-4), jeder Pin hat einen externen Interrupt.
+ */
+#define HOST_NUM_PINS 32
+#define A0 14
+#define A1 15
+#define A2 16
+#define A3 17
+#define A4 18
+#define A5 19
+#define A6 20
+#define A7 21
+#define NOT_A_PIN 0
+#define NOT_A_PORT 0
+#define NOT_AN_INTERRUPT -1
+
+#define digitalPinToPort(p) ((p) < HOST_NUM_PINS ? (uint8_t)((p) / 8 + 1) : NOT_A_PORT)
+#define digitalPinToBitMask(p) ((uint8_t)(1 << ((p) % 8)))
+#define digitalPinToInterrupt(p) ((p) < HOST_NUM_PINS ? (int)(p) : NOT_AN_INTERRUPT)
+#define portOutputRegister(port) (&hostPorts[(port)])
+#define portInputRegister(port) (&hostPorts[(port)])
+
+extern volatile uint8_t hostPorts[HOST_NUM_PINS / 8 + 1];
+
+#define bit(b) (1UL << (b))
+#define bitRead(value, b) (((value) >> (b)) & 0x01)
+#define bitSet(value, b) ((value) |= (1UL << (b)))
+#define bitClear(value, b) ((value) &= ~(1UL << (b)))
+#define bitWrite(value, b, bitvalue) ((bitvalue) ? bitSet(value, b) : bitClear(value, b))
+#define lowByte(w) ((uint8_t) ((w) & 0xff))
+#define highByte(w) ((uint8_t) ((w) >> 8))
+
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+#define sq(x) ((x) * (x))
+
+// Als Templates statt als Makros, damit sich die Header der C++-Bibliothek vertragen.
+template <class T, class U>
+inline auto min(const T &a, const U &b) -> decltype(a < b ? a : b) {
+    return (b < a) ? b : a;
+}
+
+template <class T, class U>
+inline auto max(const T &a, const U &b) -> decltype(a < b ? a : b) {
+    return (a < b) ? b : a;
+}
+
+long map(long x, long inMin, long inMax, long outMin, long outMax);
+long random(long howBig);
+long random(long howSmall, long howBig);
+void randomSeed(unsigned long seed);
+
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+void delayMicroseconds(unsigned int us);
+
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t val);
+int digitalRead(uint8_t pin);
+int analogRead(uint8_t pin);
+void analogWrite(uint8_t pin, int val);
+void tone(uint8_t pin, unsigned int frequency, unsigned long duration = 0);
+void noTone(uint8_t pin);
+void shiftOut(uint8_t dataPin, uint8_t clockPin, uint8_t bitOrder, uint8_t val);
+
+void attachInterrupt(int interruptNum, void (*userFunc)(void), int mode);
+void detachInterrupt(int interruptNum);
+
+#define noInterrupts() cli()
+#define interrupts() sei()
+
+/**
+ * Strings im Flash (F()) sind am Rechner normale Strings.
+ */
+class __FlashStringHelper;
+#define F(string_literal) (reinterpret_cast<const __FlashStringHelper *>(PSTR(string_literal)))
+
+#define DEC 10
+#define HEX 16
+#define OCT 8
+#define BIN 2
+
+/**
+ * Die Ausgaben von Serial, siehe HostArduino.h.
+ */
+class HardwareSerial {
+public:
+    void begin(unsigned long baud);
+    void end();
+
+    int available();
+    int read();
+    int availableForWrite();
+    void flush();
+
+    size_t write(uint8_t b);
+    size_t write(const uint8_t *buffer, size_t size);
+    size_t write(const char *str);
+    // wie HardwareSerial: Zahlen gehen als ein Byte raus...
+    size_t write(unsigned long n) { return write((uint8_t)n); }
+    size_t write(long n) { return write((uint8_t)n); }
+    size_t write(unsigned int n) { return write((uint8_t)n); }
+    size_t write(int n) { return write((uint8_t)n); }
+
+    size_t print(const __FlashStringHelper *s);
+    size_t print(const char *s);
+    size_t print(char c);
+    size_t print(unsigned char b, int base = DEC);
+    size_t print(int n, int base = DEC);
+    size_t print(unsigned int n, int base = DEC);
+    size_t print(long n, int base = DEC);
+    size_t print(unsigned long n, int base = DEC);
+    size_t print(long long n, int base = DEC);
+    size_t print(unsigned long long n, int base = DEC);
+    size_t print(double n, int digits = 2);
+
+    size_t println();
+    template <class T>
+    size_t println(T value) {
+        size_t n = print(value);
+        return n + println();
+    }
+    template <class T>
+    size_t println(T value, int format) {
+        size_t n = print(value, format);
+        return n + println();
+    }
+
+    operator bool() {
+        return true;
+    }
+
+private:
+    size_t _printNumber(unsigned long long n, int base);
+};
+
+extern HardwareSerial Serial;
+extern HardwareSerial Serial1;
+
+#endif
@@ -0,0 +1,103 @@
+/**
+ * HostArduino
+ * Steuerung der Arduino-Umgebung am Rechner fuer Tests und Benchmarks:
+ * die Zeit von micros()/millis(), Pegel an den Eingaengen (mit Pin-Interrupt),
+ * die Ausgaben ueber Serial und Zaehler fuer die Zugriffe auf die Hardware.
+ *
+ * Die Zeit steht, bis ein Test sie weiterstellt. delay() und delayMicroseconds()
+ * stellen sie um die gewartete Zeit weiter.
+ *
+ * @mc       Host (Linux/macOS)
+ * @autor    agent / agent _AT_ local
+ *           Vorlage von: Christian Aschoff / caschoff _AT_ mac _DOT_ com
+ * @version  1.0
+ * @created  18.10.2026
+ *
+ * Versionshistorie:
+ * V 1.0:  - Erstellt.
+ */
+#ifndef HOST_ARDUINO_H
+#define HOST_ARDUINO_H
+
+#include "Arduino.h"
+#include <string>
+
+/**
+ * Zugriffe auf die (nachgebildete) Hardware seit hostReset() bzw. hostResetCounters().
+ */
+struct HostCounters {
+    // Adafruit_NeoPixel, Adafruit_DotStar, LPD8806: setPixelColor() und show().
+    unsigned long pixelWrites;
+    unsigned long shows;
+    // LedControl: setLed(), setRow(), setColumn() und setIntensity().
+    unsigned long ledControlWrites;
+    // SPI.transfer() (Bytes), davon vor SPI.begin().
+    unsigned long spiBytes;
+    unsigned long spiBytesBeforeBegin;
+    // Schreibzugriffe auf einen Port mit digitalWrite().
+    unsigned long digitalWrites;
+    // cli(), sei() und Schreibzugriffe auf SREG.
+    unsigned long interruptDisables;
+    unsigned long interruptEnables;
+    unsigned long sregWrites;
+    // Serial: geschriebene Bytes und solche, fuer die kein Platz war.
+    unsigned long serialBytes;
+    unsigned long serialOverflows;
+};
+
+extern HostCounters hostCounters;
+
+/**
+ * Alles zuruecksetzen: Zeit 0, Pins LOW, Interrupts frei, keine Pin-Interrupts,
+ * Serial leer, Zaehler 0, EEPROM geloescht (0xFF), RTC auf 0.
+ */
+void hostReset();
+void hostResetCounters();
+
+void hostSetMicros(unsigned long micros);
+void hostAdvanceMicros(unsigned long micros);
+
+/**
+ * Den Pegel an einem Eingang setzen. Bei einer passenden Flanke laeuft die
+ * Routine aus attachInterrupt() sofort, bei gesperrten Interrupts beim naechsten sei().
+ */
+void hostSetPin(uint8_t pin, uint8_t level);
+uint8_t hostGetPin(uint8_t pin);
+uint8_t hostGetPinMode(uint8_t pin);
+
+/**
+ * Wird bei jedem digitalWrite() (auch aus shiftOut()) aufgerufen, so koennen
+ * Stellvertreter Bausteine nachbilden, die per Bit-Banging angesprochen
+ * werden (LedControl: die MAX7219 des UeberPixel).
+ */
+void hostSetDigitalWriteHook(void (*hook)(uint8_t pin, uint8_t val));
+
+/**
+ * Der Wert, den analogRead() fuer einen Pin liefert.
+ */
+void hostSetAnalog(uint8_t pin, int value);
+
+/**
+ * Alles, was ueber Serial ausgegeben wurde. Mit hostSetSerialRoom() laesst
+ * sich ein voller Sendepuffer nachstellen (availableForWrite(), Default 63).
+ * Mit hostSetSerialBaud() fuellt er sich mit jedem Byte und leert sich mit
+ * micros() in der Baudrate (10 Bit pro Byte), ohne bleibt er leer.
+ * Mit hostSetSerialEcho() geht die Ausgabe zusaetzlich nach stdout.
+ */
+std::string &hostSerialOutput();
+std::string &hostSerial1Output();
+void hostSetSerialRoom(int room);
+void hostSetSerialBaud(unsigned long baud);
+void hostSetSerialEcho(bool echo);
+
+/**
+ * Die Register der RTC (DS1307/DS3231 an Adresse 0x68) hinter Wire.
+ */
+uint8_t *hostRtcRegisters();
+
+/**
+ * Der Inhalt des EEPROM (1024 Byte).
+ */
+uint8_t *hostEeprom();
+
+#endif
@@ -0,0 +1,46 @@
+/**
+ * LPD8806 (Host)
+ * Der Streifen als Puffer mit drei Bytes pro LED (Gruen, Rot, Blau, je 7 Bit
+ * mit gesetztem Bit 7), wie in der Bibliothek. show() zaehlt nur.
+ *
+ * @mc       Host (Linux/macOS)
+ * @autor    agent / agent _AT_ local
+ *           Vorlage von: Christian Aschoff / caschoff _AT_ mac _DOT_ com
+ * @version  1.0
+ * @created  18.10.2026
+ *
+ * Versionshistorie:
+ * V 1.0:  - Erstellt.
+ */
+#ifndef HOST_LPD8806_H
+#define HOST_LPD8806_H
+
+#include "Arduino.h"
+
+class LPD8806 {
+public:
+    LPD8806(uint16_t n, uint8_t dpin, uint8_t cpin);
+    LPD8806(uint16_t n);
+    ~LPD8806();
+
+    void begin();
+    void show();
+
+    void setPixelColor(uint16_t n, uint32_t c);
+    void setPixelColor(uint16_t n, uint8_t r, uint8_t g, uint8_t b);
+    uint32_t getPixelColor(uint16_t n);
+    uint16_t numPixels();
+
+    uint32_t Color(byte r, byte g, byte b) {
+        return ((uint32_t)(g | 0x80) << 16) | ((uint32_t)(r | 0x80) << 8) | b | 0x80;
+    }
+
+    // die zuletzt angelegte Instanz (die Treiber legen ihre im Konstruktor an)...
+    static LPD8806 *hostLast;
+
+private:
+    uint16_t _numLEDs;
+    uint8_t *_pixels;
+};
+
+#endif
@@ -0,0 +1,60 @@
+/**
+ * LedControl (Host)
+ * Die MAX7219 als acht Zeilen pro Baustein, siehe getRow(). Die Bausteine
+ * lauschen ausserdem auf Data, Clock und Load: wer sie wie LedDriverUeberPixel
+ * per shiftOut() selbst beschreibt (16 Bit pro Baustein, der letzte zuerst,
+ * uebernommen mit der steigenden Flanke an Load), landet ebenfalls in getRow().
+ * Jedes so geschriebene Digit-Register zaehlt wie ein setRow() in
+ * hostCounters.ledControlWrites.
+ *
+ * @mc       Host (Linux/macOS)
+ * @autor    agent / agent _AT_ local
+ *           Vorlage von: Christian Aschoff / caschoff _AT_ mac _DOT_ com
+ * @version  1.0
+ * @created  18.10.2026
+ *
+ * Versionshistorie:
+ * V 1.0:  - Erstellt.
+ */
+#ifndef HOST_LEDCONTROL_H
+#define HOST_LEDCONTROL_H
+
+#include "Arduino.h"
+
+#define HOST_LEDCONTROL_MAX_DEVICES 8
+
+class LedControl {
+public:
+    LedControl(int dataPin, int clkPin, int csPin, int numDevices = 1);
+    ~LedControl();
+
+    int getDeviceCount();
+    void shutdown(int addr, bool status);
+    void setScanLimit(int addr, int limit);
+    void setIntensity(int addr, int intensity);
+    void clearDisplay(int addr);
+    void setLed(int addr, int row, int col, boolean state);
+    void setRow(int addr, int row, byte value);
+    void setColumn(int addr, int col, byte value);
+
+    byte getRow(int addr, int row);
+
+    // die zuletzt angelegte Instanz (die Treiber legen ihre im Konstruktor an)...
+    static LedControl *hostLast;
+
+private:
+    int _numDevices;
+    byte _status[HOST_LEDCONTROL_MAX_DEVICES][8];
+
+    int _dataPin;
+    int _clkPin;
+    int _csPin;
+    bool _clk;
+    bool _cs;
+    uint16_t _shift[HOST_LEDCONTROL_MAX_DEVICES];
+
+    void _pinWritten(uint8_t pin, uint8_t val);
+    static void _digitalWriteHook(uint8_t pin, uint8_t val);
+};
+
+#endif
@@ -0,0 +1,515 @@
+/**
+ * Bibliotheken (Host)
+ * Wire, EEPROM, SPI, Adafruit_NeoPixel, Adafruit_DotStar, LPD8806 und LedControl
+ * am Rechner, siehe die Header.
+ *
+ * @mc       Host (Linux/macOS)
+ * @autor    agent / agent _AT_ local
+ *           Vorlage von: Christian Aschoff / caschoff _AT_ mac _DOT_ com
+ * @version  1.0
+ * @created  18.10.2026
+ *
+ * Versionshistorie:
+ * V 1.0:  - Erstellt.
+ */
+#include "HostArduino.h"
+#include "Wire.h"
+#include "EEPROM.h"
+#include "SPI.h"
+#include "Adafruit_NeoPixel.h"
+#include "Adafruit_DotStar.h"
+#include "LPD8806.h"
+#include "LedControl.h"
+
+TwoWire Wire;
+EEPROMClass EEPROM;
+SPIClass SPI;
+
+static uint8_t hostRtc[HOST_RTC_REGISTERS];
+static uint8_t hostRtcPointer;
+
+// geloescht, auch schon fuer globale Konstruktoren (Settings)...
+static struct HostEepromContent {
+    uint8_t data[HOST_EEPROM_SIZE];
+    HostEepromContent() {
+        memset(data, 0xFF, sizeof(data));
+    }
+} hostEepromContent;
+
+uint8_t *hostRtcRegisters() {
+    return hostRtc;
+}
+
+uint8_t *hostEeprom() {
+    return hostEepromContent.data;
+}
+
+void hostResetEeprom() {
+    memset(hostEepromContent.data, 0xFF, sizeof(hostEepromContent.data));
+}
+
+void hostResetLibraries() {
+    memset(hostRtc, 0, sizeof(hostRtc));
+    hostRtcPointer = 0;
+    SPI.reset();
+}
+
+/*
+ * Wire
+ */
+void TwoWire::begin() {
+}
+
+void TwoWire::beginTransmission(int address) {
+    _address = address;
+    _pointerSet = false;
+}
+
+uint8_t TwoWire::endTransmission(bool sendStop) {
+    (void)sendStop;
+    // 2: NACK auf die Adresse...
+    return (_address == HOST_RTC_ADDRESS) ? 0 : 2;
+}
+
+size_t TwoWire::write(uint8_t data) {
+    if (_address != HOST_RTC_ADDRESS) {
+        return 0;
+    }
+    if (!_pointerSet) {
+        hostRtcPointer = data % HOST_RTC_REGISTERS;
+        _pointerSet = true;
+    } else {
+        hostRtc[hostRtcPointer] = data;
+        hostRtcPointer = (hostRtcPointer + 1) % HOST_RTC_REGISTERS;
+    }
+    return 1;
+}
+
+uint8_t TwoWire::requestFrom(int address, int quantity) {
+    _available = (address == HOST_RTC_ADDRESS) ? quantity : 0;
+    return _available;
+}
+
+int TwoWire::available() {
+    return _available;
+}
+
+int TwoWire::read() {
+    if (_available <= 0) {
+        return -1;
+    }
+    _available--;
+    uint8_t data = hostRtc[hostRtcPointer];
+    hostRtcPointer = (hostRtcPointer + 1) % HOST_RTC_REGISTERS;
+    return data;
+}
+
+/*
+ * EEPROM
+ */
+uint8_t EEPROMClass::read(int address) {
+    return hostEepromContent.data[address % HOST_EEPROM_SIZE];
+}
+
+void EEPROMClass::write(int address, uint8_t value) {
+    hostEepromContent.data[address % HOST_EEPROM_SIZE] = value;
+}
+
+void EEPROMClass::update(int address, uint8_t value) {
+    if (read(address) != value) {
+        write(address, value);
+    }
+}
+
+uint16_t EEPROMClass::length() {
+    return HOST_EEPROM_SIZE;
+}
+
+/*
+ * SPI
+ */
+void SPIClass::begin() {
+    _begun = true;
+}
+
+void SPIClass::end() {
+    _begun = false;
+}
+
+bool SPIClass::isBegun() {
+    return _begun;
+}
+
+void SPIClass::beginTransaction(SPISettings settings) {
+    (void)settings;
+}
+
+void SPIClass::endTransaction() {
+}
+
+uint8_t SPIClass::transfer(uint8_t data) {
+    hostCounters.spiBytes++;
+    if (!_begun) {
+        hostCounters.spiBytesBeforeBegin++;
+    }
+    _history[_head] = data;
+    _head = (_head + 1) % HOST_SPI_HISTORY;
+    return 0;
+}
+
+void SPIClass::transfer(void *buffer, size_t count) {
+    uint8_t *data = (uint8_t *)buffer;
+    for (size_t i = 0; i < count; i++) {
+        data[i] = transfer(data[i]);
+    }
+}
+
+void SPIClass::setSCK(uint8_t pin) {
+    (void)pin;
+}
+
+void SPIClass::setBitOrder(uint8_t bitOrder) {
+    (void)bitOrder;
+}
+
+void SPIClass::setDataMode(uint8_t dataMode) {
+    (void)dataMode;
+}
+
+void SPIClass::setClockDivider(uint8_t divider) {
+    (void)divider;
+}
+
+uint8_t SPIClass::history(uint8_t age) {
+    return _history[(_head + HOST_SPI_HISTORY - 1 - (age % HOST_SPI_HISTORY)) % HOST_SPI_HISTORY];
+}
+
+void SPIClass::reset() {
+    _begun = false;
+    memset(_history, 0, sizeof(_history));
+    _head = 0;
+}
+
+/*
+ * Adafruit_NeoPixel
+ */
+Adafruit_NeoPixel *Adafruit_NeoPixel::hostLast;
+
+Adafruit_NeoPixel::Adafruit_NeoPixel(uint16_t n, uint8_t pin, uint16_t type) {
+    hostLast = this;
+    (void)pin;
+    _numLEDs = n;
+    _pixels = (uint8_t *)calloc(n, 3);
+    _rOffset = (type >> 4) & 3;
+    _gOffset = (type >> 2) & 3;
+    _bOffset = type & 3;
+}
+
+Adafruit_NeoPixel::~Adafruit_NeoPixel() {
+    free(_pixels);
+}
+
+void Adafruit_NeoPixel::begin() {
+}
+
+void Adafruit_NeoPixel::show() {
+    hostCounters.shows++;
+}
+
+void Adafruit_NeoPixel::clear() {
+    memset(_pixels, 0, _numLEDs * 3);
+}
+
+void Adafruit_NeoPixel::setBrightness(uint8_t brightness) {
+    (void)brightness;
+}
+
+void Adafruit_NeoPixel::setPixelColor(uint16_t n, uint32_t c) {
+    setPixelColor(n, (uint8_t)(c >> 16), (uint8_t)(c >> 8), (uint8_t)c);
+}
+
+void Adafruit_NeoPixel::setPixelColor(uint16_t n, uint8_t r, uint8_t g, uint8_t b) {
+    hostCounters.pixelWrites++;
+    if (n < _numLEDs) {
+        uint8_t *p = &_pixels[n * 3];
+        p[_rOffset] = r;
+        p[_gOffset] = g;
+        p[_bOffset] = b;
+    }
+}
+
+uint32_t Adafruit_NeoPixel::getPixelColor(uint16_t n) const {
+    if (n >= _numLEDs) {
+        return 0;
+    }
+    const uint8_t *p = &_pixels[n * 3];
+    return Color(p[_rOffset], p[_gOffset], p[_bOffset]);
+}
+
+uint8_t *Adafruit_NeoPixel::getPixels() const {
+    return _pixels;
+}
+
+uint16_t Adafruit_NeoPixel::numPixels() const {
+    return _numLEDs;
+}
+
+/*
+ * Adafruit_DotStar
+ */
+Adafruit_DotStar *Adafruit_DotStar::hostLast;
+
+Adafruit_DotStar::Adafruit_DotStar(uint16_t n, uint8_t data, uint8_t clock, uint8_t order) {
+    hostLast = this;
+    (void)data;
+    (void)clock;
+    _numLEDs = n;
+    _pixels = (uint8_t *)calloc(n, 3);
+    _rOffset = order & 3;
+    _gOffset = (order >> 2) & 3;
+    _bOffset = (order >> 4) & 3;
+}
+
+Adafruit_DotStar::~Adafruit_DotStar() {
+    free(_pixels);
+}
+
+void Adafruit_DotStar::begin() {
+}
+
+void Adafruit_DotStar::show() {
+    hostCounters.shows++;
+}
+
+void Adafruit_DotStar::clear() {
+    memset(_pixels, 0, _numLEDs * 3);
+}
+
+void Adafruit_DotStar::setBrightness(uint8_t brightness) {
+    (void)brightness;
+}
+
+void Adafruit_DotStar::setPixelColor(uint16_t n, uint32_t c) {
+    setPixelColor(n, (uint8_t)(c >> 16), (uint8_t)(c >> 8), (uint8_t)c);
+}
+
+void Adafruit_DotStar::setPixelColor(uint16_t n, uint8_t r, uint8_t g, uint8_t b) {
+    hostCounters.pixelWrites++;
+    if (n < _numLEDs) {
+        uint8_t *p = &_pixels[n * 3];
+        p[_rOffset] = r;
+        p[_gOffset] = g;
+        p[_bOffset] = b;
+    }
+}
+
+uint32_t Adafruit_DotStar::getPixelColor(uint16_t n) const {
+    if (n >= _numLEDs) {
+        return 0;
+    }
+    const uint8_t *p = &_pixels[n * 3];
+    return Color(p[_rOffset], p[_gOffset], p[_bOffset]);
+}
+
+uint8_t *Adafruit_DotStar::getPixels() const {
+    return _pixels;
+}
+
+uint16_t Adafruit_DotStar::numPixels() const {
+    return _numLEDs;
+}
+
+/*
+ * LPD8806
+ */
+LPD8806 *LPD8806::hostLast;
+
+LPD8806::LPD8806(uint16_t n, uint8_t dpin, uint8_t cpin) {
+    hostLast = this;
+    (void)dpin;
+    (void)cpin;
+    _numLEDs = n;
+    _pixels = (uint8_t *)malloc(n * 3);
+    memset(_pixels, 0x80, n * 3);
+}
+
+LPD8806::LPD8806(uint16_t n) {
+    hostLast = this;
+    _numLEDs = n;
+    _pixels = (uint8_t *)malloc(n * 3);
+    memset(_pixels, 0x80, n * 3);
+}
+
+LPD8806::~LPD8806() {
+    free(_pixels);
+}
+
+void LPD8806::begin() {
+}
+
+void LPD8806::show() {
+    hostCounters.shows++;
+}
+
+void LPD8806::setPixelColor(uint16_t n, uint32_t c) {
+    hostCounters.pixelWrites++;
+    if (n < _numLEDs) {
+        uint8_t *p = &_pixels[n * 3];
+        p[0] = (c >> 16) | 0x80;
+        p[1] = (c >> 8) | 0x80;
+        p[2] = c | 0x80;
+    }
+}
+
+void LPD8806::setPixelColor(uint16_t n, uint8_t r, uint8_t g, uint8_t b) {
+    setPixelColor(n, Color(r, g, b));
+}
+
+uint32_t LPD8806::getPixelColor(uint16_t n) {
+    if (n >= _numLEDs) {
+        return 0;
+    }
+    uint8_t *p = &_pixels[n * 3];
+    return ((uint32_t)(p[0] & 0x7F) << 16) | ((uint32_t)(p[1] & 0x7F) << 8) | (p[2] & 0x7F);
+}
+
+uint16_t LPD8806::numPixels() {
+    return _numLEDs;
+}
+
+/*
+ * LedControl
+ */
+LedControl *LedControl::hostLast;
+
+#define HOST_LEDCONTROL_MAX_CHAINS 4
+static LedControl *hostLedControls[HOST_LEDCONTROL_MAX_CHAINS];
+
+LedControl::LedControl(int dataPin, int clkPin, int csPin, int numDevices) {
+    hostLast = this;
+    _dataPin = dataPin;
+    _clkPin = clkPin;
+    _csPin = csPin;
+    _clk = false;
+    _cs = true;
+    _numDevices = (numDevices > HOST_LEDCONTROL_MAX_DEVICES) ? HOST_LEDCONTROL_MAX_DEVICES : numDevices;
+    memset(_status, 0, sizeof(_status));
+    memset(_shift, 0, sizeof(_shift));
+    for (byte i = 0; i < HOST_LEDCONTROL_MAX_CHAINS; i++) {
+        if (!hostLedControls[i]) {
+            hostLedControls[i] = this;
+            break;
+        }
+    }
+    hostSetDigitalWriteHook(_digitalWriteHook);
+}
+
+LedControl::~LedControl() {
+    for (byte i = 0; i < HOST_LEDCONTROL_MAX_CHAINS; i++) {
+        if (hostLedControls[i] == this) {
+            hostLedControls[i] = 0;
+        }
+    }
+    if (hostLast == this) {
+        hostLast = 0;
+    }
+}
+
+void LedControl::_digitalWriteHook(uint8_t pin, uint8_t val) {
+    for (byte i = 0; i < HOST_LEDCONTROL_MAX_CHAINS; i++) {
+        if (hostLedControls[i]) {
+            hostLedControls[i]->_pinWritten(pin, val);
+        }
+    }
+}
+
+/**
+ * Die Kette ist ein Schieberegister mit 16 Bit pro Baustein: jede steigende
+ * Flanke an Clock schiebt Data in den ersten Baustein, was hinten herausfaellt,
+ * in den naechsten. Die steigende Flanke an Load uebernimmt alle Register.
+ */
+void LedControl::_pinWritten(uint8_t pin, uint8_t val) {
+    if (pin == _clkPin) {
+        if (val && !_clk) {
+            uint8_t in = hostGetPin(_dataPin);
+            for (int i = 0; i < _numDevices; i++) {
+                uint8_t out = _shift[i] >> 15;
+                _shift[i] = (_shift[i] << 1) | in;
+                in = out;
+            }
+        }
+        _clk = val;
+    } else if (pin == _csPin) {
+        if (val && !_cs) {
+            for (int i = 0; i < _numDevices; i++) {
+                byte opcode = (_shift[i] >> 8) & 0x0F;
+                if ((opcode >= 1) && (opcode <= 8)) {
+                    _status[i][opcode - 1] = _shift[i] & 0xFF;
+                    hostCounters.ledControlWrites++;
+                }
+            }
+        }
+        _cs = val;
+    }
+}
+
+int LedControl::getDeviceCount() {
+    return _numDevices;
+}
+
+void LedControl::shutdown(int addr, bool status) {
+    (void)addr;
+    (void)status;
+}
+
+void LedControl::setScanLimit(int addr, int limit) {
+    (void)addr;
+    (void)limit;
+}
+
+void LedControl::setIntensity(int addr, int intensity) {
+    (void)addr;
+    (void)intensity;
+    hostCounters.ledControlWrites++;
+}
+
+void LedControl::clearDisplay(int addr) {
+    if ((addr >= 0) && (addr < _numDevices)) {
+        memset(_status[addr], 0, 8);
+    }
+}
+
+void LedControl::setLed(int addr, int row, int col, boolean state) {
+    hostCounters.ledControlWrites++;
+    if ((addr < 0) || (addr >= _numDevices) || (row < 0) || (row > 7) || (col < 0) || (col > 7)) {
+        return;
+    }
+    byte val = 0b10000000 >> col;
+    if (state) {
+        _status[addr][row] |= val;
+    } else {
+        _status[addr][row] &= ~val;
+    }
+}
+
+void LedControl::setRow(int addr, int row, byte value) {
+    hostCounters.ledControlWrites++;
+    if ((addr >= 0) && (addr < _numDevices) && (row >= 0) && (row <= 7)) {
+        _status[addr][row] = value;
+    }
+}
+
+void LedControl::setColumn(int addr, int col, byte value) {
+    hostCounters.ledControlWrites++;
+    if ((addr < 0) || (addr >= _numDevices) || (col < 0) || (col > 7)) {
+        return;
+    }
+    for (int row = 0; row < 8; row++) {
+        setLed(addr, row, col, (value >> (7 - row)) & 1);
+    }
+    hostCounters.ledControlWrites -= 8;
+}
+
+byte LedControl::getRow(int addr, int row) {
+    return _status[addr][row];
+}
@@ -0,0 +1,69 @@
+/**
+ * SPI (Host)
+ * Hardware-SPI: zaehlt die Bytes (auch die vor SPI.begin(), siehe HostCounters)
+ * und merkt sich die letzten, die Antwort ist immer 0.
+ *
+ * @mc       Host (Linux/macOS)
+ * @autor    agent / agent _AT_ local
+ *           Vorlage von: Christian Aschoff / caschoff _AT_ mac _DOT_ com
+ * @version  1.0
+ * @created  18.10.2026
+ *
+ * Versionshistorie:
+ * V 1.0:  - Erstellt.
+ */
+#ifndef HOST_SPI_H
+#define HOST_SPI_H
+
+#include "Arduino.h"
+
+#define SPI_MODE0 0x00
+#define SPI_MODE1 0x04
+#define SPI_MODE2 0x08
+#define SPI_MODE3 0x0C
+
+#define SPI_CLOCK_DIV2 0x04
+
+class SPISettings {
+public:
+    SPISettings() {
+    }
+    SPISettings(uint32_t clock, uint8_t bitOrder, uint8_t dataMode) {
+        (void)clock;
+        (void)bitOrder;
+        (void)dataMode;
+    }
+};
+
+#define HOST_SPI_HISTORY 64
+
+class SPIClass {
+public:
+    void begin();
+    void end();
+    bool isBegun();
+
+    void beginTransaction(SPISettings settings);
+    void endTransaction();
+
+    uint8_t transfer(uint8_t data);
+    void transfer(void *buffer, size_t count);
+
+    void setSCK(uint8_t pin);
+    void setBitOrder(uint8_t bitOrder);
+    void setDataMode(uint8_t dataMode);
+    void setClockDivider(uint8_t divider);
+
+    // Die letzten HOST_SPI_HISTORY Bytes, history(0) ist das letzte.
+    uint8_t history(uint8_t age);
+    void reset();
+
+private:
+    bool _begun;
+    uint8_t _history[HOST_SPI_HISTORY];
+    uint8_t _head;
+};
+
+extern SPIClass SPI;
+
+#endif
@@ -0,0 +1,44 @@
+/**
+ * Wire (Host)
+ * Der I2C-Bus mit einer RTC (DS1307/DS3231) an Adresse 0x68: das erste
+ * geschriebene Byte ist der Registerzeiger, danach wird ab dort gelesen
+ * bzw. geschrieben. Andere Adressen antworten nicht (NACK).
+ *
+ * @mc       Host (Linux/macOS)
+ * @autor    agent / agent _AT_ local
+ *           Vorlage von: Christian Aschoff / caschoff _AT_ mac _DOT_ com
+ * @version  1.0
+ * @created  18.10.2026
+ *
+ * Versionshistorie:
+ * V 1.0:  - Erstellt.
+ */
+#ifndef HOST_WIRE_H
+#define HOST_WIRE_H
+
+#include "Arduino.h"
+
+#define HOST_RTC_ADDRESS 0x68
+#define HOST_RTC_REGISTERS 64
+
+class TwoWire {
+public:
+    void begin();
+
+    void beginTransmission(int address);
+    uint8_t endTransmission(bool sendStop = true);
+    size_t write(uint8_t data);
+
+    uint8_t requestFrom(int address, int quantity);
+    int available();
+    int read();
+
+private:
+    int _address;
+    bool _pointerSet;
+    int _available;
+};
+
+extern TwoWire Wire;
+
+#endif
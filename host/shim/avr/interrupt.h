@@ -0,0 +1,25 @@
+/**
+ * avr/interrupt.h (Host)
+ * cli() und sei() setzen das I-Bit im Statusregister. Ein Pin-Interrupt
+ * (HostArduino.h), der bei gesperrten Interrupts kommt, laeuft beim
+ * naechsten sei() nach. Eine Interrupt-Routine ist eine normale Funktion,
+ * die ein Test aufrufen kann.
+ *
+ * @mc       Host (Linux/macOS)
+ * @autor    agent / agent _AT_ local
+ *           Vorlage von: Christian Aschoff / caschoff _AT_ mac _DOT_ com
+ * @version  1.0
+ * @created  18.10.2026
+ *
+ * Versionshistorie:
+ * V 1.0:  - Erstellt.
+ */
+#ifndef HOST_AVR_INTERRUPT_H
+#define HOST_AVR_INTERRUPT_H
+
+void cli();
+void sei();
+
+#define ISR(vector, ...) extern "C" void vector(void); extern "C" void vector(void)
+
+#endif
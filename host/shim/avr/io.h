@@ -0,0 +1,60 @@
+/**
+ * avr/io.h (Host)
+ * Die Register, die die Firmware direkt benutzt: das Statusregister (zaehlt
+ * Schreibzugriffe, siehe HostArduino.h) und Timer1. Timer1 laeuft am Rechner
+ * nicht von selbst, ein Test ruft die Interrupt-Routine (TIMER1_COMPA_vect())
+ * selbst auf und liest OCR1A fuer die Laenge der Zeitscheibe.
+ *
+ * @mc       Host (Linux/macOS)
+ * @autor    agent / agent _AT_ local
+ *           Vorlage von: Christian Aschoff / caschoff _AT_ mac _DOT_ com
+ * @version  1.0
+ * @created  18.10.2026
+ *
+ * Versionshistorie:
+ * V 1.0:  - Erstellt.
+ */
+#ifndef HOST_AVR_IO_H
+#define HOST_AVR_IO_H
+
+#include <stdint.h>
+
+#ifndef F_CPU
+#define F_CPU 16000000UL
+#endif
+
+#define _BV(b) (1 << (b))
+
+/**
+ * Das Statusregister, Bit 7 gibt die Interrupts frei.
+ */
+#define SREG_I 7
+
+class HostStatusRegister {
+public:
+    operator uint8_t() const;
+    HostStatusRegister &operator=(uint8_t value);
+};
+
+extern HostStatusRegister SREG;
+
+extern volatile uint8_t hostTCCR1A;
+extern volatile uint8_t hostTCCR1B;
+extern volatile uint16_t hostOCR1A;
+extern volatile uint16_t hostTCNT1;
+extern volatile uint8_t hostTIFR1;
+extern volatile uint8_t hostTIMSK1;
+
+#define TCCR1A hostTCCR1A
+#define TCCR1B hostTCCR1B
+#define OCR1A hostOCR1A
+#define TCNT1 hostTCNT1
+#define TIFR1 hostTIFR1
+#define TIMSK1 hostTIMSK1
+
+#define WGM12 3
+#define CS11 1
+#define OCF1A 1
+#define OCIE1A 1
+
+#endif
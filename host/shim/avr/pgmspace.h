@@ -0,0 +1,38 @@
+/**
+ * avr/pgmspace.h (Host)
+ * Am Rechner gibt es nur einen Adressraum, PROGMEM ist also leer und die
+ * pgm_read_*() lesen direkt.
+ *
+ * @mc       Host (Linux/macOS)
+ * @autor    agent / agent _AT_ local
+ *           Vorlage von: Christian Aschoff / caschoff _AT_ mac _DOT_ com
+ * @version  1.0
+ * @created  18.10.2026
+ *
+ * Versionshistorie:
+ * V 1.0:  - Erstellt.
+ */
+#ifndef HOST_AVR_PGMSPACE_H
+#define HOST_AVR_PGMSPACE_H
+
+#include <stdint.h>
+#include <string.h>
+
+#define PROGMEM
+#define PGM_P const char *
+#define PSTR(s) (s)
+
+#define pgm_read_byte_near(addr) (*(const uint8_t *)(addr))
+#define pgm_read_word_near(addr) (*(const uint16_t *)(addr))
+#define pgm_read_dword_near(addr) (*(const uint32_t *)(addr))
+#define pgm_read_ptr_near(addr) (*(void * const *)(addr))
+#define pgm_read_byte(addr) pgm_read_byte_near(addr)
+#define pgm_read_word(addr) pgm_read_word_near(addr)
+#define pgm_read_dword(addr) pgm_read_dword_near(addr)
+#define pgm_read_ptr(addr) pgm_read_ptr_near(addr)
+
+#define memcpy_P memcpy
+#define strcpy_P strcpy
+#define strlen_P strlen
+
+#endif
@@ -0,0 +1,50 @@
+/**
+ * util/atomic.h (Host)
+ * ATOMIC_BLOCK wie in der avr-libc: Interrupts sperren und am Ende des Blocks
+ * den alten Zustand (ATOMIC_RESTORESTATE) bzw. freigegebene Interrupts
+ * (ATOMIC_FORCEON) wiederherstellen.
+ *
+ * @mc       Host (Linux/macOS)
+ * @autor    agent / agent _AT_ local
+ *           Vorlage von: Christian Aschoff / caschoff _AT_ mac _DOT_ com
+ * @version  1.0
+ * @created  18.10.2026
+ *
+ * Versionshistorie:
+ * V 1.0:  - Erstellt.
+ */
+#ifndef HOST_UTIL_ATOMIC_H
+#define HOST_UTIL_ATOMIC_H
+
+#include <avr/io.h>
+#include <avr/interrupt.h>
+
+class HostAtomicBlock {
+public:
+    explicit HostAtomicBlock(bool restore) : _sreg(SREG), _restore(restore), _done(false) {
+        cli();
+    }
+    ~HostAtomicBlock() {
+        if (_restore) {
+            SREG = _sreg;
+        } else {
+            sei();
+        }
+    }
+    bool once() {
+        bool first = !_done;
+        _done = true;
+        return first;
+    }
+
+private:
+    uint8_t _sreg;
+    bool _restore;
+    bool _done;
+};
+
+#define ATOMIC_RESTORESTATE true
+#define ATOMIC_FORCEON false
+#define ATOMIC_BLOCK(type) for (HostAtomicBlock hostAtomic(type); hostAtomic.once(); )
+
+#endif
@@ -0,0 +1,148 @@
+/**
+ * Dcf77DecodeTest
+ * Prueft die Regeln von MyDCF77::decode() mit gebastelten Telegrammen, die
+ * als Signal durch das echte MyDCF77 laufen (poll() im Takt der Firmware):
+ * Kontroll-Bits, jede Paritaet, ungueltige BCD-Ziffern, Wochentag und Monat 0,
+ * der Tag gegen die Laenge des Monats (31.04., 29.02. mit und ohne Schaltjahr).
+ * Jedes Telegramm wird auch direkt mit MyDCF77::decodeTelegram() geprueft.
+ *
+ * @mc       Host (Linux/macOS)
+ * @autor    agent / agent _AT_ local
+ *           Vorlage von: Christian Aschoff / caschoff _AT_ mac _DOT_ com
+ * @version  1.0
+ * @created  18.10.2026
+ *
+ * Versionshistorie:
+ * V 1.0:  - Erstellt.
+ */
+#include "HostArduino.h"
+#include "HostTest.h"
+#include "Dcf77Simulation.h"
+#include "MyDCF77.h"
+
+#define DCF77_PIN 9
+#define DCF77_LED 8
+#define MINUTES 3
+#define LOOP_MICROS 1000UL
+
+/**
+ * length Bits ab Sekunde from mit value ueberschreiben.
+ */
+static uint64_t setField(uint64_t telegram, byte from, byte length, byte value) {
+    uint64_t mask = ((1ULL << length) - 1) << from;
+    return (telegram & ~mask) | (((uint64_t)value << from) & mask);
+}
+
+/**
+ * Die drei geraden Paritaeten neu rechnen, damit nur die gemeinte Regel verletzt ist.
+ */
+static uint64_t fixParity(uint64_t telegram) {
+    telegram = setField(telegram, 28, 1, __builtin_parityll(telegram & (0x7FULL << 21)));
+    telegram = setField(telegram, 35, 1, __builtin_parityll(telegram & (0x3FULL << 29)));
+    return setField(telegram, 58, 1, __builtin_parityll(telegram & (0x3FFFFFULL << 36)));
+}
+
+/**
+ * Das Telegramm MINUTES Minuten lang senden: das echte MyDCF77 muss genau
+ * dieses Telegramm sehen und synchronisiert nur, wenn es gueltig ist, dann
+ * auf die erwartete Zeit.
+ */
+static void checkTelegram(const char *name, uint64_t telegram, boolean valid, const Dcf77Time &expected) {
+    TimeStamp decoded(0, 0, 0, 0, 0, 0);
+    boolean direct = MyDCF77::decodeTelegram(telegram, &decoded);
+    CHECK_EQUAL(valid, direct);
+    if (valid) {
+        CHECK(dcf77Equals(expected, &decoded));
+    }
+
+    hostReset();
+    Dcf77Signal signal(24);
+    unsigned long start = 300000;
+    for (byte m = 0; m < MINUTES; m++) {
+        signal.appendMinute(start + m * DCF77_SIM_MINUTE, telegram);
+    }
+    MyDCF77 dcf77(DCF77_PIN, DCF77_LED);
+    Dcf77Loop loop(&signal, DCF77_PIN);
+    loop.setLoopMicros(LOOP_MICROS);
+    unsigned long syncs = 0;
+    unsigned long wrong = 0;
+    loop.run(start + MINUTES * DCF77_SIM_MINUTE + 2 * DCF77_SIM_SECOND, [&]() {
+        if (dcf77.poll(false)) {
+            syncs++;
+            wrong += !dcf77Equals(expected, &dcf77);
+        }
+    });
+    unsigned long received = 0;
+    for (byte age = 0; age < MYDCF77_TELEGRAM_RING; age++) {
+        received += (dcf77.getTelegram(age) == telegram);
+    }
+    printf("%-28s %s, %lu Telegramme, %lu Synchronisationen\n", name, valid ? "gueltig" : "ungueltig", received, syncs);
+
+    // das Signal kam richtig an, es liegt also an decode()...
+    CHECK(received >= MINUTES - 1);
+    if (valid) {
+        CHECK(syncs >= MINUTES - 1);
+        CHECK_EQUAL(0, wrong);
+    } else {
+        CHECK_EQUAL(0, syncs);
+    }
+}
+
+static void checkTime(const char *name, const Dcf77Time &time, boolean valid) {
+    checkTelegram(name, dcf77Encode(time), valid, time);
+}
+
+int main() {
+    Dcf77Time sunday = {34, 12, 18, 7, 10, 26};
+    uint64_t good = dcf77Encode(sunday);
+
+    checkTime("18.10.26 12:34", sunday, true);
+    checkTime("31.12.99 23:59", {59, 23, 31, 5, 12, 99}, true);
+    checkTime("01.01.00 00:00", {0, 0, 1, 6, 1, 0}, true);
+
+    // der Tag gegen die Laenge des Monats...
+    checkTime("30.04.26", {0, 8, 30, 4, 4, 26}, true);
+    checkTime("31.04.26", {0, 8, 31, 5, 4, 26}, false);
+    checkTime("31.06.26", {0, 8, 31, 3, 6, 26}, false);
+    checkTime("29.02.24 (Schaltjahr)", {0, 8, 29, 4, 2, 24}, true);
+    checkTime("29.02.00 (Schaltjahr)", {0, 8, 29, 2, 2, 0}, true);
+    checkTime("29.02.25", {0, 8, 29, 7, 2, 25}, false);
+    checkTime("28.02.25", {0, 8, 28, 5, 2, 25}, true);
+    checkTime("30.02.24", {0, 8, 30, 5, 2, 24}, false);
+    checkTime("00.10.26", {0, 8, 0, 5, 10, 26}, false);
+
+    // Wochentag und Monat 0, Monat 13...
+    checkTime("Wochentag 0", {34, 12, 18, 0, 10, 26}, false);
+    checkTime("Monat 0", {34, 12, 18, 7, 0, 26}, false);
+    checkTime("Monat 13", {34, 12, 18, 7, 13, 26}, false);
+
+    // Einer ueber 9 (A-F) in jedem Feld, die Paritaeten stimmen...
+    checkTelegram("Minute 1A", fixParity(setField(good, 21, 7, 0x1A)), false, sunday);
+    checkTelegram("Minute 0F", fixParity(setField(good, 21, 7, 0x0F)), false, sunday);
+    checkTelegram("Stunde 1A", fixParity(setField(good, 29, 6, 0x1A)), false, sunday);
+    checkTelegram("Tag 1B", fixParity(setField(good, 36, 6, 0x1B)), false, sunday);
+    checkTelegram("Monat 0C", fixParity(setField(good, 45, 5, 0x0C)), false, sunday);
+    checkTelegram("Jahr 2D", fixParity(setField(good, 50, 8, 0x2D)), false, sunday);
+    // ...und Zehner zu gross...
+    checkTelegram("Minute 60", fixParity(setField(good, 21, 7, 0x60)), false, sunday);
+    checkTelegram("Stunde 24", fixParity(setField(good, 29, 6, 0x24)), false, sunday);
+    checkTelegram("Jahr A0", fixParity(setField(good, 50, 8, 0xA0)), false, sunday);
+
+    // jede Paritaet einzeln falsch...
+    checkTelegram("P1 falsch", good ^ (1ULL << 28), false, sunday);
+    checkTelegram("P2 falsch", good ^ (1ULL << 35), false, sunday);
+    checkTelegram("P3 falsch", good ^ (1ULL << 58), false, sunday);
+    checkTelegram("Minute ohne P1", good ^ (1ULL << 22), false, sunday);
+    checkTelegram("Stunde ohne P2", good ^ (1ULL << 30), false, sunday);
+    checkTelegram("Jahr ohne P3", good ^ (1ULL << 57), false, sunday);
+
+    // Kontroll-Bits...
+    checkTelegram("M = 1", good | 1ULL, false, sunday);
+    checkTelegram("S = 0", good & ~(1ULL << 20), false, sunday);
+    checkTelegram("Z1 = Z2 = 1", good | (1ULL << 17), false, sunday);
+    checkTelegram("Z1 = Z2 = 0", good & ~(1ULL << 18), false, sunday);
+    Dcf77Time summer = sunday;
+    checkTelegram("MESZ (Z1)", (good | (1ULL << 17)) & ~(1ULL << 18), true, summer);
+
+    return hostTestResult();
+}
@@ -0,0 +1,209 @@
+/**
+ * Dcf77EdgeCaptureTest
+ * Prueft MyDCF77 mit MYDCF77_EDGE_CAPTURE: die Flanken kommen per hostSetPin()
+ * in die Interrupt-Routine und werden mit ihrem Zeitstempel in den Ringpuffer
+ * geschrieben, waehrend loop() haengt (lange Bilder, I2C). Decodiert wird
+ * trotzdem dasselbe wie ohne Haenger: dieselben Telegramme, dieselben Zeiten,
+ * und poll() meldet die Synchronisation hoechstens einen Durchlauf spaeter.
+ * Dazu eine verpasste Minutenmarke und ein Aussetzer (fuer MYDCF77_ACCUMULATOR).
+ *
+ * @mc       Host (Linux/macOS)
+ * @autor    agent / agent _AT_ local
+ *           Vorlage von: Christian Aschoff / caschoff _AT_ mac _DOT_ com
+ * @version  1.2
+ * @created  18.10.2026
+ * @updated  18.10.2026
+ *
+ * Versionshistorie:
+ * V 1.0:  - Erstellt.
+ * V 1.1:  - Verpasste Minutenmarke und Aussetzer, Erwartungen fuer MYDCF77_ACCUMULATOR.
+ * V 1.2:  - Mit und ohne Haenger dieselben Telegramme (getTelegram()), ohne
+ *           MYDCF77_MATCHED_FILTER auch nach dem Aussetzer nie eine falsche Zeit.
+ */
+#include "HostArduino.h"
+#include "HostTest.h"
+#include "Dcf77Simulation.h"
+#include "MyDCF77.h"
+
+#define DCF77_PIN 9
+#define DCF77_LED 8
+#define MINUTES 8
+#define LOOP_MICROS 1000UL
+
+/**
+ * Eine Synchronisation: wann poll() TRUE lieferte und welche Zeit decodiert war.
+ */
+struct Sync {
+    unsigned long time;
+    Dcf77Time decoded;
+};
+
+/**
+ * Ein Durchlauf mit Haengern (alle stallEvery Durchlaeufe stallMicros), dabei
+ * die Synchronisationen und die Telegramme bei jeder Minutenmarke sammeln.
+ */
+static byte runDecoder(Dcf77Signal *signal, unsigned long end, unsigned long stallEvery, unsigned long stallMicros,
+                       std::vector<Sync> &syncs, std::vector<uint64_t> &telegrams) {
+    hostReset();
+    MyDCF77 dcf77(DCF77_PIN, DCF77_LED);
+    Dcf77Loop loop(signal, DCF77_PIN);
+    loop.setLoopMicros(LOOP_MICROS);
+    loop.setStall(stallEvery, stallMicros);
+    uint64_t telegram = dcf77.getTelegram(0);
+    loop.run(end, [&]() {
+        if (dcf77.poll(false)) {
+            Sync sync = {micros(), {dcf77.getMinutes(), dcf77.getHours(), dcf77.getDate(),
+                                    dcf77.getDayOfWeek(), dcf77.getMonth(), dcf77.getYear()}};
+            syncs.push_back(sync);
+        }
+        // mehrere Minutenmarken in einem Haenger gibt es nicht, eine Minute ist laenger...
+        if (dcf77.getTelegram(0) != telegram) {
+            telegram = dcf77.getTelegram(0);
+            telegrams.push_back(telegram);
+        }
+    });
+    return dcf77.getDroppedEdges();
+}
+
+/**
+ * Mit und ohne Haenger dasselbe decodieren.
+ */
+static void checkStall(const char *name, const Dcf77Noise &noise, const std::vector<Dcf77Time> &sent,
+                       unsigned long stallEvery, unsigned long stallMicros) {
+    Dcf77Signal signal(21);
+    signal.setNoise(noise);
+    unsigned long start = 300000;
+    for (size_t m = 0; m < sent.size(); m++) {
+        signal.appendMinute(start + m * DCF77_SIM_MINUTE, dcf77Encode(sent[m]));
+    }
+    unsigned long end = start + sent.size() * DCF77_SIM_MINUTE + 2 * DCF77_SIM_SECOND;
+
+    std::vector<Sync> expectedSyncs;
+    std::vector<uint64_t> expectedTelegrams;
+    CHECK_EQUAL(0, runDecoder(&signal, end, 0, 0, expectedSyncs, expectedTelegrams));
+
+    std::vector<Sync> syncs;
+    std::vector<uint64_t> telegrams;
+    byte dropped = runDecoder(&signal, end, stallEvery, stallMicros, syncs, telegrams);
+    printf("%s, alle %lu Durchlaeufe %lu ms: %lu Synchronisationen (ohne Haenger %lu), %d verlorene Flanken\n",
+           name, stallEvery, stallMicros / 1000, (unsigned long)syncs.size(), (unsigned long)expectedSyncs.size(), dropped);
+    CHECK_EQUAL(0, dropped);
+
+    // jede Synchronisation auf eine gesendete Zeit, ohne Stoerungen jede Minute
+    // nach dem Einrasten...
+    if (memcmp(&noise, &dcf77Clean, sizeof(noise)) == 0) {
+        CHECK(expectedSyncs.size() >= sent.size() - DCF77_SIM_LOST_MINUTES);
+    }
+    CHECK(!expectedSyncs.empty());
+    unsigned long wrong = 0;
+    for (size_t i = 0; i < expectedSyncs.size(); i++) {
+        boolean found = false;
+        for (size_t m = 0; m < sent.size(); m++) {
+            found |= (memcmp(&expectedSyncs[i].decoded, &sent[m], sizeof(Dcf77Time)) == 0);
+        }
+        if (!found) {
+            wrong++;
+        }
+    }
+    CHECK_EQUAL(0, wrong);
+
+    // ...und mit Haengern genauso...
+    CHECK_EQUAL(expectedTelegrams.size(), telegrams.size());
+    CHECK(telegrams == expectedTelegrams);
+    CHECK_EQUAL(expectedSyncs.size(), syncs.size());
+    unsigned long late = 0;
+    wrong = 0;
+    for (size_t i = 0; (i < syncs.size()) && (i < expectedSyncs.size()); i++) {
+        if (memcmp(&syncs[i].decoded, &expectedSyncs[i].decoded, sizeof(Dcf77Time)) != 0) {
+            wrong++;
+        }
+        // poll() meldet es beim ersten Durchlauf nach dem richtigen Zeitpunkt...
+        if ((syncs[i].time < expectedSyncs[i].time)
+                || (syncs[i].time > expectedSyncs[i].time + LOOP_MICROS + stallMicros)) {
+            printf("    Synchronisation %lu bei %lu us statt %lu us\n", (unsigned long)i, syncs[i].time, expectedSyncs[i].time);
+            late++;
+        }
+    }
+    CHECK_EQUAL(0, wrong);
+    CHECK_EQUAL(0, late);
+}
+
+/**
+ * Eine verpasste Minutenmarke (ein Impuls in Sekunde 59) und ein Aussetzer (kein
+ * Impuls in Sekunde 30) in je einer Minute. Ohne MYDCF77_ACCUMULATOR gehen
+ * diese beiden Minuten verloren, mit gleicht MyDCF77 beides aus und
+ * synchronisiert nach dem Einrasten jede Minute. Nie auf eine falsche Zeit.
+ */
+static void checkMarks(const std::vector<Dcf77Time> &sent, byte missedMinute, byte dropoutMinute) {
+    Dcf77Signal signal(21);
+    unsigned long start = 300000;
+    for (size_t m = 0; m < sent.size(); m++) {
+        unsigned long minute = start + m * DCF77_SIM_MINUTE;
+        signal.appendMinute(minute, dcf77Encode(sent[m]));
+        if (m == missedMinute) {
+            Dcf77Edge rise = {minute + 59 * DCF77_SIM_SECOND, true};
+            Dcf77Edge fall = {minute + 59 * DCF77_SIM_SECOND + 100000, false};
+            signal.edges.push_back(rise);
+            signal.edges.push_back(fall);
+        }
+        if (m == dropoutMinute) {
+            for (size_t i = 0; i < signal.edges.size(); i++) {
+                if (signal.edges[i].time >= minute + 30 * DCF77_SIM_SECOND) {
+                    signal.edges.erase(signal.edges.begin() + i, signal.edges.begin() + i + 2);
+                    break;
+                }
+            }
+        }
+    }
+    unsigned long end = start + sent.size() * DCF77_SIM_MINUTE + 2 * DCF77_SIM_SECOND;
+
+    std::vector<Sync> syncs;
+    std::vector<uint64_t> telegrams;
+    CHECK_EQUAL(0, runDecoder(&signal, end, 0, 0, syncs, telegrams));
+    printf("verpasste Minutenmarke in Minute %d, Aussetzer in Minute %d: %lu Synchronisationen\n",
+           missedMinute, dropoutMinute, (unsigned long)syncs.size());
+
+    // in der Reihenfolge der gesendeten Zeiten, keine doppelt...
+    size_t m = 0;
+    unsigned long wrong = 0;
+    for (size_t i = 0; i < syncs.size(); i++) {
+        while ((m < sent.size()) && (memcmp(&syncs[i].decoded, &sent[m], sizeof(Dcf77Time)) != 0)) {
+            m++;
+        }
+        if (m == sent.size()) {
+            wrong++;
+            m = 0;
+        } else {
+            m++;
+        }
+    }
+    CHECK_EQUAL(0, wrong);
+#ifdef MYDCF77_ACCUMULATOR
+    CHECK_EQUAL(sent.size() - DCF77_SIM_LOST_MINUTES, syncs.size());
+#else
+    CHECK(syncs.size() >= sent.size() - DCF77_SIM_LOST_MINUTES - 2);
+#endif
+}
+
+int main() {
+    std::vector<Dcf77Time> sent;
+    Dcf77Time time = {58, 23, 31, 5, 12, 26};
+    for (byte m = 0; m < MINUTES; m++) {
+        dcf77NextMinute(time);
+        sent.push_back(time);
+    }
+
+    // Zittern der Flanken und kurze Stoerspitzen, wie neben den LED-Stripes...
+    Dcf77Noise noisy = {0, 0, 0.5, 2000, 5000};
+
+    checkStall("sauber", dcf77Clean, sent, 50, 800000);
+    checkStall("sauber", dcf77Clean, sent, 7, 250000);
+    checkStall("sauber", dcf77Clean, sent, 1, 900000);
+    checkStall("gestoert", noisy, sent, 50, 800000);
+    checkStall("gestoert", noisy, sent, 1, 900000);
+
+    checkMarks(sent, 3, 5);
+    checkMarks(sent, 5, 3);
+
+    return hostTestResult();
+}
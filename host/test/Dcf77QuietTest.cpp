@@ -0,0 +1,146 @@
+/**
+ * Dcf77QuietTest
+ * Prueft die ruhigen Bins von MyDCF77 (MYDCF77_QUIET_WINDOWS), in denen der
+ * Sketch geaenderte Bilder an die LEDs schickt:
+ * - waehrend eines Impulses (der Pin ist HIGH) ist nie ein ruhiges Fenster,
+ *   auch nicht direkt nach einer Driftkorrektur, die die Bins (und damit die
+ *   Maske) verschiebt. Der Empfaenger laeuft dazu etwas zu schnell oder zu
+ *   langsam, so dass MyDCF77 alle MYDCF77_DRIFT_CORRECTION_TIME Sekunden
+ *   nachstellen muss,
+ * - getMillisToQuietWindow() ist 0 genau im ruhigen Fenster, sonst hoechstens
+ *   der Impuls mit den Sicherheits-Bins, und wer so lange wartet, landet in
+ *   einem ruhigen Fenster,
+ * - jede Sekunde bleibt genug ruhige Zeit fuer die LEDs.
+ * Die ersten Sekunden (bis MyDCF77 einen Impuls gesehen hat) zaehlen nicht.
+ *
+ * @mc       Host (Linux/macOS)
+ * @autor    agent / agent _AT_ local
+ *           Vorlage von: Christian Aschoff / caschoff _AT_ mac _DOT_ com
+ * @version  1.0
+ * @created  18.10.2026
+ *
+ * Versionshistorie:
+ * V 1.0:  - Erstellt.
+ */
+#include "HostArduino.h"
+#include "HostTest.h"
+#include "Dcf77Simulation.h"
+#include "MyDCF77.h"
+
+#ifndef MYDCF77_QUIET_WINDOWS
+#error "Dcf77QuietTest braucht MYDCF77_QUIET_WINDOWS."
+#endif
+
+#define DCF77_PIN 9
+#define DCF77_LED 8
+#define MINUTES 3
+#define LOOP_MICROS 1000UL
+#define LEARN_MICROS (3 * DCF77_SIM_SECOND)
+
+// Eine Bin, der laengste Impuls (200ms) und die Sicherheits-Bins davor und dahinter...
+#define BIN_MICROS (1000000UL / MYDCF77_SIGNAL_BINS)
+#define MAX_LOUD_MICROS (200000UL + (2 * MYDCF77_QUIET_GUARD_BINS + 2) * BIN_MICROS)
+
+/**
+ * Drei Minuten senden, der Empfaenger geht dabei um ppm falsch (positiv: die
+ * Sekunden sind zu lang). start legt die Phase der Impulse gegen die Bins fest.
+ */
+static void checkQuiet(const char *name, unsigned long start, long ppm) {
+    hostReset();
+    Dcf77Signal signal(13);
+    Dcf77Time time = {58, 23, 31, 5, 12, 26};
+    for (byte m = 0; m < MINUTES; m++) {
+        dcf77NextMinute(time);
+        signal.appendMinute(m * DCF77_SIM_MINUTE, dcf77Encode(time));
+    }
+    for (size_t i = 0; i < signal.edges.size(); i++) {
+        signal.edges[i].time = start + signal.edges[i].time + (long long)signal.edges[i].time * ppm / 1000000;
+    }
+    unsigned long end = signal.edges.back().time + 2 * DCF77_SIM_SECOND;
+
+    MyDCF77 dcf77(DCF77_PIN, DCF77_LED);
+    Dcf77Loop loop(&signal, DCF77_PIN);
+    loop.setLoopMicros(LOOP_MICROS);
+
+    unsigned long pulseLoops = 0;
+    unsigned long quietInPulse = 0;
+    unsigned long wrongZero = 0;
+    unsigned long tooLong = 0;
+    unsigned long maxWait = 0;
+    unsigned long missedPredictions = 0;
+    unsigned long predictions = 0;
+    unsigned long quietLoops = 0;
+    unsigned long loops = 0;
+    // wann getMillisToQuietWindow() ein ruhiges Fenster versprochen hat...
+    unsigned long promised = 0;
+    boolean promise = false;
+    loop.run(end, [&]() {
+        dcf77.poll(false);
+        unsigned long now = micros();
+        if (now < start + LEARN_MICROS) {
+            return;
+        }
+        loops++;
+        boolean quiet = dcf77.isQuietWindow();
+        unsigned int wait = dcf77.getMillisToQuietWindow();
+        quietLoops += quiet;
+
+        if (hostGetPin(DCF77_PIN) == HIGH) {
+            pulseLoops++;
+            if (quiet) {
+                if (quietInPulse < 10) {
+                    printf("    %s: ruhig im Impuls bei %lu us\n", name, now);
+                }
+                quietInPulse++;
+            }
+        }
+
+        if (quiet != (wait == 0)) {
+            wrongZero++;
+        }
+        maxWait = max(maxWait, (unsigned long)wait);
+        if (wait * 1000UL > MAX_LOUD_MICROS) {
+            tooLong++;
+        }
+
+        // ...und ob es dann auch ruhig ist (auf die Millisekunde abgerundet, ein Durchlauf Toleranz)...
+        if (promise && ((long)(now - promised) >= 0)) {
+            predictions++;
+            if (!quiet) {
+                if (missedPredictions < 10) {
+                    printf("    %s: bei %lu us versprochen, noch nicht ruhig\n", name, promised);
+                }
+                missedPredictions++;
+            }
+            promise = false;
+        }
+        if (!quiet && !promise) {
+            promised = now + wait * 1000UL + 2 * LOOP_MICROS;
+            promise = true;
+        }
+    });
+
+    printf("%-32s %lu Durchlaeufe im Impuls, davon %lu ruhig, %lu%% ruhig, hoechstens %lu ms bis ruhig\n",
+           name, pulseLoops, quietInPulse, quietLoops * 100 / loops, maxWait);
+    CHECK(pulseLoops > 0);
+    CHECK_EQUAL(0, quietInPulse);
+    CHECK_EQUAL(0, wrongZero);
+    CHECK_EQUAL(0, tooLong);
+    CHECK(predictions > 0);
+    CHECK_EQUAL(0, missedPredictions);
+    // 100/200ms Impuls mit Sicherheits-Bins, der Rest der Sekunde gehoert den LEDs...
+    CHECK(quietLoops * 2 > loops);
+}
+
+int main() {
+    // die Impulse mitten in, am Anfang und am Ende einer Bin...
+    checkQuiet("genau", 300000, 0);
+    checkQuiet("genau, Impuls am Bin-Anfang", BIN_MICROS * 7 + 500, 0);
+    checkQuiet("genau, Impuls am Bin-Ende", BIN_MICROS * 7 - 500, 0);
+    // ...und mit Drift, MyDCF77 stellt die Bins alle 30s nach...
+    checkQuiet("2000 ppm zu langsam", 300000, 2000);
+    checkQuiet("2000 ppm zu schnell", 300000, -2000);
+    checkQuiet("500 ppm zu schnell", 650000, -500);
+
+    return hostTestResult();
+}
@@ -0,0 +1,221 @@
+/**
+ * Dcf77RecorderTest
+ * Prueft MYDCF77_RECORDER von der Aufzeichnung bis zum Abspielen: der
+ * Dcf77ReplayDriver laeuft live ueber ein synthetisches Signal (MyDCF77 zeichnet
+ * auf Serial auf, einmal pro Minute mit RTC-Zeit), davor und mittendrin kommen
+ * Textausgaben auf dieselbe Schnittstelle (ungerade lang, die Worte sind danach
+ * verschoben). Abgespielt kommen dieselben Synchronisationen heraus wie live,
+ * bis auf die Minuten, die der Text kaputt gemacht hat, danach geht es ab dem
+ * naechsten Kopf richtig weiter.
+ * Ausserdem: ist beim Stellen der RTC-Zeit der Sendepuffer zu voll, wartet sie,
+ * bis Kopf und Zeit passen, statt den Puffer mit leeren Worten zu fuellen.
+ *
+ * Aufruf: dcf77_recorder_test [aufzeichnung] (schreibt die Aufzeichnung dorthin)
+ *
+ * @mc       Host (Linux/macOS)
+ * @autor    agent / agent _AT_ local
+ *           Vorlage von: Christian Aschoff / caschoff _AT_ mac _DOT_ com
+ * @version  1.0
+ * @created  18.10.2026
+ *
+ * Versionshistorie:
+ * V 1.0:  - Erstellt.
+ */
+#include "HostArduino.h"
+#include "HostTest.h"
+#include "Dcf77Simulation.h"
+#include "Dcf77ReplayDriver.h"
+#include <string>
+
+#define DCF77_PIN 9
+#define DCF77_LED 8
+#define MINUTES 9
+#define LOOP_MICROS 1000UL
+// In dieser Minute kommt der Text mitten in die Aufzeichnung.
+#define TEXT_MINUTE 4
+
+static boolean sameTime(const Dcf77Time &a, const Dcf77Time &b) {
+    return memcmp(&a, &b, sizeof(Dcf77Time)) == 0;
+}
+
+/**
+ * Live: die Synchronisationen und die Aufzeichnung (alles auf Serial).
+ */
+static std::string runLive(Dcf77Signal *signal, unsigned long start, unsigned long end, std::vector<Dcf77ReplaySync> &syncs) {
+    hostReset();
+    MyDCF77 dcf77(DCF77_PIN, DCF77_LED);
+    MyRTC rtc(0x68, 4);
+    DCF77Helper helper;
+    // der Sendepuffer leert sich wie im Sketch (SERIAL_SPEED)...
+    hostSetSerialBaud(57600);
+    // die RTC geht falsch, aber sie geht...
+    rtc.set(12, 10, 1, 4, 1, 26);
+    rtc.setSeconds(30);
+    rtc.writeTime();
+    Serial.println(F("Qlockthree is initializing..."));
+
+    Dcf77ReplayDriver driver(&dcf77, &rtc, &helper, DCF77_PIN);
+    Dcf77Loop loop(signal, DCF77_PIN);
+    loop.setLoopMicros(LOOP_MICROS);
+    boolean textWritten = false;
+    loop.run(end, [&]() {
+        driver.loop();
+        if (!textWritten && (micros() >= start + TEXT_MINUTE * DCF77_SIM_MINUTE + 30 * DCF77_SIM_SECOND)) {
+            Serial.println(F("Captured: 12:34:00 18.10.2026"));
+            textWritten = true;
+        }
+    });
+    syncs = driver.syncs;
+    return hostSerialOutput();
+}
+
+/**
+ * Die Aufzeichnung abspielen.
+ */
+static void runReplay(const std::string &recording, std::vector<Dcf77ReplaySync> &syncs, unsigned long *headers,
+                      unsigned long *resyncs) {
+    hostReset();
+    MyDCF77 dcf77(DCF77_PIN, DCF77_LED);
+    MyRTC rtc(0x68, 4);
+    DCF77Helper helper;
+    Dcf77ReplayDriver driver(&dcf77, &rtc, &helper, DCF77_PIN);
+    driver.setLoopMicros(LOOP_MICROS);
+    for (size_t i = 0; i < recording.size(); i++) {
+        driver.feed(recording[i]);
+    }
+    driver.finish(DCF77_SIM_SECOND);
+    syncs = driver.syncs;
+    *headers = driver.getReplay()->getHeaders();
+    *resyncs = driver.getReplay()->getResyncs();
+}
+
+/**
+ * Ist beim Stellen der RTC-Zeit weniger als Kopf und Zeit im Sendepuffer frei
+ * (hier nach einer Textausgabe), wartet die Zeit, bis er sich geleert hat: bei
+ * 57600 Baud, record() alle 100-200us und einem Pegel, der sich nicht aendert.
+ */
+static void checkFullBuffer() {
+    hostReset();
+    hostSetSerialBaud(57600);
+    DCF77Recorder recorder;
+    Dcf77Random random(3);
+    TimeStamp rtc(34, 12, 18, 7, 10, 26);
+    unsigned long end = 3 * DCF77_SIM_SECOND;
+    boolean timeSet = false;
+    size_t textEnd = 0;
+    while (micros() < end) {
+        if (!timeSet && (micros() >= DCF77_SIM_SECOND)) {
+            Serial.print(F("Captured: 12:34:00 18.10.2026, DCF77-Time written to RTC."));
+            textEnd = hostSerialOutput().size();
+            CHECK(Serial.availableForWrite() < DCF77_RECORDING_HEADER_LENGTH + 2 + DCF77_RECORDING_TIME_LENGTH);
+            recorder.setTime(&rtc, 0);
+            timeSet = true;
+        }
+        recorder.record(micros(), false);
+        hostAdvanceMicros(100 + random.below(100));
+    }
+
+    // die Zeit kommt nach dem Text, und danach ist Ruhe (nur die langen Pausen)...
+    DCF77Replay replay;
+    unsigned long times = 0;
+    for (size_t i = textEnd; i < hostSerialOutput().size(); i++) {
+        if (replay.feed(hostSerialOutput()[i]) == DCF77_REPLAY_TIME) {
+            TimeStamp recorded(0, 0, 0, 0, 0, 0);
+            replay.getRtc(&recorded);
+            CHECK_EQUAL(34, recorded.getMinutes());
+            times++;
+        }
+    }
+    printf("Voller Sendepuffer: %lu Byte nach dem Text, %lu RTC-Zeiten, %lu Ueberlaeufe\n",
+           (unsigned long)(hostSerialOutput().size() - textEnd), times, hostCounters.serialOverflows);
+    CHECK_EQUAL(1, times);
+    CHECK(hostSerialOutput().size() - textEnd < 64);
+    CHECK_EQUAL(0, hostCounters.serialOverflows);
+}
+
+/**
+ * Die Synchronisation auf sent[m] suchen.
+ */
+static const Dcf77ReplaySync *findSync(const std::vector<Dcf77ReplaySync> &syncs, const Dcf77Time &sent) {
+    for (size_t i = 0; i < syncs.size(); i++) {
+        if (sameTime(syncs[i].decoded, sent)) {
+            return &syncs[i];
+        }
+    }
+    return 0;
+}
+
+int main(int argc, char **argv) {
+    std::vector<Dcf77Time> sent;
+    Dcf77Time time = {50, 14, 18, 7, 10, 26};
+    for (byte m = 0; m < MINUTES; m++) {
+        dcf77NextMinute(time);
+        sent.push_back(time);
+    }
+    Dcf77Signal signal(25);
+    unsigned long start = 300000;
+    for (size_t m = 0; m < sent.size(); m++) {
+        signal.appendMinute(start + m * DCF77_SIM_MINUTE, dcf77Encode(sent[m]));
+    }
+    unsigned long end = start + sent.size() * DCF77_SIM_MINUTE + 2 * DCF77_SIM_SECOND;
+
+    std::vector<Dcf77ReplaySync> live;
+    std::string recording = runLive(&signal, start, end, live);
+    // die Aufzeichnung z.B. fuer dcf77_replay und dcf77_demodulator_bench...
+    if (argc > 1) {
+        FILE *file = fopen(argv[1], "wb");
+        CHECK(file && (fwrite(recording.data(), 1, recording.size(), file) == recording.size()));
+        if (file) {
+            fclose(file);
+        }
+    }
+    std::vector<Dcf77ReplaySync> replayed;
+    unsigned long headers;
+    unsigned long resyncs;
+    runReplay(recording, replayed, &headers, &resyncs);
+    printf("%lu Byte aufgezeichnet, %lu Koepfe (%lu nach dem Text), %lu Synchronisationen live, %lu abgespielt\n",
+           (unsigned long)recording.size(), headers, resyncs, (unsigned long)live.size(), (unsigned long)replayed.size());
+
+    // live jede Minute nach dem Einrasten und nach drei Telegrammen stellt der DCF77Helper die RTC...
+    CHECK(live.size() >= sent.size() - DCF77_SIM_LOST_MINUTES);
+    for (size_t i = 0; i < live.size(); i++) {
+        CHECK(findSync(live, live[i].decoded) == &live[i]);
+    }
+    CHECK(live.back().ok);
+
+    // ...abgespielt genauso, bis auf die Minute mit dem Text und die danach (ohne Minutenmarke,
+    // dann rastet das Abspielen neu ein)...
+    CHECK_EQUAL(1, resyncs);
+    CHECK(headers >= sent.size());
+    unsigned long missing = 0;
+    unsigned long wrong = 0;
+    for (size_t m = 0; m < sent.size(); m++) {
+        const Dcf77ReplaySync *liveSync = findSync(live, sent[m]);
+        const Dcf77ReplaySync *replayedSync = findSync(replayed, sent[m]);
+        if (!liveSync) {
+            continue;
+        }
+        if ((m >= TEXT_MINUTE) && (m <= TEXT_MINUTE + DCF77_SIM_LOST_MINUTES)) {
+            continue;
+        }
+        if (!replayedSync) {
+            printf("    %02d:%02d fehlt beim Abspielen\n", sent[m].hours, sent[m].minutes);
+            missing++;
+        } else if (replayedSync->ok != liveSync->ok) {
+            printf("    %02d:%02d beim Abspielen %s\n", sent[m].hours, sent[m].minutes, replayedSync->ok ? "ok" : "nicht ok");
+            wrong++;
+        }
+    }
+    CHECK_EQUAL(0, missing);
+    CHECK_EQUAL(0, wrong);
+    // ...nichts, was nicht gesendet wurde, und am Ende stellt der DCF77Helper die RTC wieder...
+    for (size_t i = 0; i < replayed.size(); i++) {
+        CHECK(findSync(live, replayed[i].decoded) != 0);
+    }
+    CHECK(!replayed.empty() && replayed.back().ok);
+    CHECK(findSync(replayed, sent[TEXT_MINUTE + DCF77_SIM_LOST_MINUTES + 1]) != 0);
+
+    checkFullBuffer();
+
+    return hostTestResult();
+}
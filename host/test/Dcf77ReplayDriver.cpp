@@ -0,0 +1,152 @@
+/**
+ * Dcf77ReplayDriver
+ * Der DCF77-Teil des Sketches am Rechner, live oder mit einer Aufzeichnung.
+ *
+ * @mc       Host (Linux/macOS)
+ * @autor    agent / agent _AT_ local
+ *           Vorlage von: Christian Aschoff / caschoff _AT_ mac _DOT_ com
+ * @version  1.0
+ * @created  18.10.2026
+ *
+ * Versionshistorie:
+ * V 1.0:  - Erstellt.
+ */
+#include "Dcf77ReplayDriver.h"
+
+Dcf77ReplayDriver::Dcf77ReplayDriver(MyDCF77 *dcf77, MyRTC *rtc, DCF77Helper *helper, byte pin)
+    : _pendingRtc(0, 0, 0, 0, 0, 0) {
+    _dcf77 = dcf77;
+    _rtc = rtc;
+    _helper = helper;
+    _pin = pin;
+    _loopMicros = 1000;
+    _nextLoop = micros();
+    _rtcMicros = micros();
+    _timeRecorded = false;
+    _offset = 0;
+    _timePending = false;
+    _pendingSeconds = 0;
+    _pendingAt = 0;
+}
+
+void Dcf77ReplayDriver::setLoopMicros(unsigned long loopMicros) {
+    _loopMicros = loopMicros;
+}
+
+void Dcf77ReplayDriver::loop() {
+    _tickRtc();
+#ifdef MYDCF77_RECORDER
+    // einmal pro Minute die RTC-Zeit in die Aufzeichnung (wie mit helperSeconds im Sketch)...
+    _rtc->readTime();
+    if (_rtc->getSeconds() == 0) {
+        if (!_timeRecorded) {
+            _dcf77->recordTime(_rtc, _rtc->getSeconds());
+            _timeRecorded = true;
+        }
+    } else {
+        _timeRecorded = false;
+    }
+#endif
+    if (_dcf77->poll(false)) {
+        // wie manageNewDCF77Data()...
+        _rtc->readTime();
+#ifdef MYDCF77_ACCUMULATOR
+        boolean samplesOk = true;
+#else
+        _helper->addSample(_dcf77, _rtc);
+        boolean samplesOk = _helper->samplesOk();
+#endif
+        if (samplesOk) {
+            _rtc->setSeconds(0);
+            _rtc->set(_dcf77);
+            _rtc->writeTime();
+            _rtcMicros = micros();
+        }
+        Dcf77ReplaySync sync = {micros(), {_dcf77->getMinutes(), _dcf77->getHours(), _dcf77->getDate(),
+                                           _dcf77->getDayOfWeek(), _dcf77->getMonth(), _dcf77->getYear()}, samplesOk};
+        syncs.push_back(sync);
+    }
+}
+
+void Dcf77ReplayDriver::feed(byte b) {
+    switch (_replay.feed(b)) {
+    case DCF77_REPLAY_HEADER:
+        // die Aufzeichnung beginnt mit einem Durchlauf von loop(), der Takt also auch...
+        if (_replay.getHeaders() == 1) {
+            _offset = micros();
+            _nextLoop = _offset;
+        }
+        // ...nach einem kaputten Stueck kann die Zeit zurueckspringen, dann ab jetzt weiter...
+        if (_offset + _replay.getTime() < micros()) {
+            _offset = micros() - _replay.getTime();
+        }
+        _runUntil(_offset + _replay.getTime());
+        break;
+    case DCF77_REPLAY_LEVEL:
+        _runUntil(_offset + _replay.getTime());
+        hostSetPin(_pin, _replay.getLevel() ? HIGH : LOW);
+        break;
+    case DCF77_REPLAY_TIME:
+        // live kam die RTC-Zeit nach der Synchronisation, die sie evtl. gestellt hat, abgespielt
+        // liegt die evtl. einen Bin spaeter (anderer Takt), also erst danach stellen...
+        _replay.getRtc(&_pendingRtc);
+        _pendingSeconds = _replay.getRtcSeconds();
+        _pendingAt = micros();
+        _timePending = true;
+        break;
+    }
+}
+
+void Dcf77ReplayDriver::finish(unsigned long micros) {
+    _runUntil(::micros() + micros);
+}
+
+DCF77Replay *Dcf77ReplayDriver::getReplay() {
+    return &_replay;
+}
+
+/**
+ * Der Sekundentakt der RTC (ohne Datumswechsel, wie TimeStamp::incMinutes()).
+ */
+void Dcf77ReplayDriver::_tickRtc() {
+    if (micros() - _rtcMicros < DCF77_SIM_SECOND) {
+        return;
+    }
+    _rtc->readTime();
+    while (micros() - _rtcMicros >= DCF77_SIM_SECOND) {
+        _rtcMicros += DCF77_SIM_SECOND;
+        byte seconds = _rtc->getSeconds() + 1;
+        if (seconds > 59) {
+            seconds = 0;
+            _rtc->incMinutes();
+            if (_rtc->getMinutes() == 0) {
+                _rtc->incHours();
+            }
+        }
+        _rtc->setSeconds(seconds);
+    }
+    _rtc->writeTime();
+}
+
+/**
+ * loop() im Takt bis time laufen lassen.
+ */
+void Dcf77ReplayDriver::_runUntil(unsigned long time) {
+    while (_nextLoop <= time) {
+        if (_nextLoop > micros()) {
+            hostSetMicros(_nextLoop);
+        }
+        if (_timePending && (micros() - _pendingAt > DCF77_REPLAY_DRIVER_TIME_DELAY)) {
+            _rtc->set(&_pendingRtc);
+            _rtc->setSeconds(_pendingSeconds);
+            _rtc->writeTime();
+            _rtcMicros = _pendingAt;
+            _timePending = false;
+        }
+        loop();
+        _nextLoop += _loopMicros;
+    }
+    if (time > micros()) {
+        hostSetMicros(time);
+    }
+}
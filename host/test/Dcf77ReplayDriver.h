@@ -0,0 +1,91 @@
+/**
+ * Dcf77ReplayDriver
+ * Der DCF77-Teil des Sketches am Rechner: loop() zaehlt die RTC weiter (wie
+ * ihr Sekundentakt), schreibt mit MYDCF77_RECORDER einmal pro Minute die
+ * RTC-Zeit in die Aufzeichnung, ruft poll() auf und macht bei einer
+ * Synchronisation dasselbe wie manageNewDCF77Data() (DCF77Helper bzw. mit
+ * MYDCF77_ACCUMULATOR sofort, dann die RTC ueber Wire stellen).
+ *
+ * Mit feed() laeuft eine Aufzeichnung des DCF77Recorder durch: die Pegel
+ * kommen zu ihrer Zeit an den Pin (mit MYDCF77_EDGE_CAPTURE also in den
+ * Interrupt), dazwischen laeuft loop() im eingestellten Takt, und die
+ * RTC-Zeiten aus der Aufzeichnung stellen die RTC (einen Bin spaeter, live
+ * kamen sie nach der Synchronisation, die sie evtl. gestellt hat). Springt die Zeit nach einem
+ * kaputten Stueck zurueck (DCF77Replay liest ab dem naechsten Kopf weiter),
+ * geht es ab der aktuellen Zeit weiter.
+ *
+ * @mc       Host (Linux/macOS)
+ * @autor    agent / agent _AT_ local
+ *           Vorlage von: Christian Aschoff / caschoff _AT_ mac _DOT_ com
+ * @version  1.0
+ * @created  18.10.2026
+ *
+ * Versionshistorie:
+ * V 1.0:  - Erstellt.
+ */
+#ifndef DCF77_REPLAY_DRIVER_H
+#define DCF77_REPLAY_DRIVER_H
+
+#include "HostArduino.h"
+#include "Dcf77Simulation.h"
+#include "MyDCF77.h"
+#include "MyRTC.h"
+#include "DCF77Helper.h"
+#include "DCF77Replay.h"
+#include <vector>
+
+// So lange nach einer RTC-Zeit aus der Aufzeichnung wird die RTC gestellt (ein Bin).
+#define DCF77_REPLAY_DRIVER_TIME_DELAY (DCF77_SIM_SECOND / MYDCF77_SIGNAL_BINS)
+
+/**
+ * Eine Synchronisation: wann poll() TRUE lieferte, welche Zeit decodiert war
+ * und ob die RTC gestellt wurde.
+ */
+struct Dcf77ReplaySync {
+    unsigned long time;
+    Dcf77Time decoded;
+    boolean ok;
+};
+
+class Dcf77ReplayDriver {
+public:
+    Dcf77ReplayDriver(MyDCF77 *dcf77, MyRTC *rtc, DCF77Helper *helper, byte pin);
+
+    void setLoopMicros(unsigned long loopMicros);
+
+    // Ein Durchlauf von loop().
+    void loop();
+
+    // Das naechste Byte der Aufzeichnung.
+    void feed(byte b);
+    // Nach der Aufzeichnung noch micros weiterlaufen (fuer die letzte Minutenmarke).
+    void finish(unsigned long micros);
+
+    DCF77Replay *getReplay();
+
+    std::vector<Dcf77ReplaySync> syncs;
+
+private:
+    MyDCF77 *_dcf77;
+    MyRTC *_rtc;
+    DCF77Helper *_helper;
+    byte _pin;
+    DCF77Replay _replay;
+    unsigned long _loopMicros;
+    unsigned long _nextLoop;
+    // micros() beim letzten Sekundentakt der RTC.
+    unsigned long _rtcMicros;
+    boolean _timeRecorded;
+    // micros() zur Zeit 0 der Aufzeichnung.
+    unsigned long _offset;
+    // Die RTC-Zeit aus der Aufzeichnung, bis sie gestellt wird.
+    boolean _timePending;
+    TimeStamp _pendingRtc;
+    byte _pendingSeconds;
+    unsigned long _pendingAt;
+
+    void _tickRtc();
+    void _runUntil(unsigned long time);
+};
+
+#endif
@@ -0,0 +1,242 @@
+/**
+ * Dcf77Simulation
+ * Ein synthetisches DCF77-Signal fuer Tests und Benchmarks am Rechner,
+ * siehe Dcf77Simulation.h.
+ *
+ * @mc       Host (Linux/macOS)
+ * @autor    agent / agent _AT_ local
+ *           Vorlage von: Christian Aschoff / caschoff _AT_ mac _DOT_ com
+ * @version  1.0
+ * @created  18.10.2026
+ *
+ * Versionshistorie:
+ * V 1.0:  - Erstellt.
+ */
+#include "Dcf77Simulation.h"
+#include <algorithm>
+
+const Dcf77Noise dcf77Clean = {0, 0, 0, 0, 0};
+
+static uint64_t dcf77Bcd(byte value, byte from, byte length) {
+    byte bcd = ((value / 10) << 4) | (value % 10);
+    return ((uint64_t)bcd & ((1 << length) - 1)) << from;
+}
+
+static uint64_t dcf77Parity(uint64_t telegram, byte from, byte to) {
+    byte ones = 0;
+    for (byte i = from; i < to; i++) {
+        ones += (telegram >> i) & 1;
+    }
+    return (uint64_t)(ones & 1) << to;
+}
+
+/**
+ * Das Telegramm, das in der Minute vor time gesendet wird: Bit n ist Sekunde n,
+ * MEZ (Z2), Start-Bit S und die drei geraden Paritaeten.
+ */
+uint64_t dcf77Encode(const Dcf77Time &time) {
+    uint64_t telegram = (1ULL << 18) | (1ULL << 20);
+    telegram |= dcf77Bcd(time.minutes, 21, 7);
+    telegram |= dcf77Parity(telegram, 21, 28);
+    telegram |= dcf77Bcd(time.hours, 29, 6);
+    telegram |= dcf77Parity(telegram, 29, 35);
+    telegram |= dcf77Bcd(time.date, 36, 6);
+    telegram |= (uint64_t)(time.dayOfWeek & 0x07) << 42;
+    telegram |= dcf77Bcd(time.month, 45, 5);
+    telegram |= dcf77Bcd(time.year, 50, 8);
+    telegram |= dcf77Parity(telegram, 36, 58);
+    return telegram;
+}
+
+/**
+ * Eine Minute weiter, mit Stunde, Tag, Monat und Jahr (2000-2099).
+ */
+void dcf77NextMinute(Dcf77Time &time) {
+    static const byte daysPerMonth[13] = {0, 31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+    if (++time.minutes < 60) {
+        return;
+    }
+    time.minutes = 0;
+    if (++time.hours < 24) {
+        return;
+    }
+    time.hours = 0;
+    time.dayOfWeek = (time.dayOfWeek % 7) + 1;
+    byte days = daysPerMonth[time.month] + (((time.month == 2) && ((time.year & 3) == 0)) ? 1 : 0);
+    if (++time.date <= days) {
+        return;
+    }
+    time.date = 1;
+    if (++time.month <= 12) {
+        return;
+    }
+    time.month = 1;
+    time.year = (time.year + 1) % 100;
+}
+
+boolean dcf77Equals(const Dcf77Time &time, TimeStamp *timeStamp) {
+    return (timeStamp->getMinutes() == time.minutes) && (timeStamp->getHours() == time.hours)
+        && (timeStamp->getDate() == time.date) && (timeStamp->getDayOfWeek() == time.dayOfWeek)
+        && (timeStamp->getMonth() == time.month) && (timeStamp->getYear() == time.year);
+}
+
+void dcf77Set(TimeStamp *timeStamp, const Dcf77Time &time) {
+    timeStamp->set(time.minutes, time.hours, time.date, time.dayOfWeek, time.month, time.year);
+}
+
+/*
+ * Dcf77Random
+ */
+Dcf77Random::Dcf77Random(uint32_t seed) {
+    _state = seed ? seed : 0x9E3779B9UL;
+}
+
+uint32_t Dcf77Random::next() {
+    _state ^= _state << 13;
+    _state ^= _state >> 17;
+    _state ^= _state << 5;
+    return _state;
+}
+
+double Dcf77Random::uniform() {
+    return next() / 4294967296.0;
+}
+
+uint32_t Dcf77Random::below(uint32_t n) {
+    return n ? (uint32_t)(uniform() * n) : 0;
+}
+
+bool Dcf77Random::chance(double p) {
+    return uniform() < p;
+}
+
+/*
+ * Dcf77Signal
+ */
+Dcf77Signal::Dcf77Signal(uint32_t seed) : _random(seed) {
+    _noise = dcf77Clean;
+    _flippedBits = 0;
+    _droppedBits = 0;
+    _sentBits = 0;
+}
+
+void Dcf77Signal::setNoise(const Dcf77Noise &noise) {
+    _noise = noise;
+}
+
+long Dcf77Signal::_jitter() {
+    if (!_noise.jitterMicros) {
+        return 0;
+    }
+    return (long)_random.below(2 * _noise.jitterMicros + 1) - (long)_noise.jitterMicros;
+}
+
+/**
+ * Die Impulse und Stoerspitzen werden als Umschaltzeitpunkte gesammelt (jeder
+ * Abschnitt kippt den Pegel zweimal), so ueberlagern sie sich wie am Empfaenger.
+ * Am Ende der Minute ist der Pegel wieder LOW.
+ */
+void Dcf77Signal::appendMinute(unsigned long start, uint64_t telegram) {
+    std::vector<unsigned long> toggles;
+    unsigned long end = start + DCF77_SIM_MINUTE;
+
+    for (byte second = 0; second < 59; second++) {
+        boolean one = (telegram >> second) & 1;
+        _sentBits++;
+        if (_random.chance(_noise.flipRate)) {
+            one = !one;
+            _flippedBits++;
+        }
+        if (_random.chance(_noise.dropRate)) {
+            _droppedBits++;
+            continue;
+        }
+        unsigned long from = start + second * DCF77_SIM_SECOND;
+        long rise = _jitter();
+        long fall = (one ? 200000L : 100000L) + _jitter();
+        toggles.push_back(from + (rise < 0 ? 0 : rise));
+        toggles.push_back(from + fall);
+    }
+
+    if (_noise.glitchRate > 0) {
+        for (byte second = 0; second < 60; second++) {
+            // Poisson-verteilt, als Folge von Bernoulli-Versuchen pro Millisekunde...
+            double p = _noise.glitchRate / 1000.0;
+            for (unsigned int ms = 0; ms < 1000; ms++) {
+                if (_random.chance(p)) {
+                    unsigned long at = start + second * DCF77_SIM_SECOND + ms * 1000UL + _random.below(1000);
+                    unsigned long length = 1 + _random.below(_noise.glitchMaxMicros);
+                    toggles.push_back(at);
+                    toggles.push_back(std::min(at + length, end - 1));
+                }
+            }
+        }
+    }
+
+    std::sort(toggles.begin(), toggles.end());
+    boolean level = false;
+    for (size_t i = 0; i < toggles.size(); i++) {
+        if ((i + 1 < toggles.size()) && (toggles[i + 1] == toggles[i])) {
+            // zweimal gekippt ist nicht gekippt...
+            i++;
+            continue;
+        }
+        level = !level;
+        Dcf77Edge edge = {toggles[i], level};
+        edges.push_back(edge);
+    }
+}
+
+unsigned long Dcf77Signal::getFlippedBits() {
+    return _flippedBits;
+}
+
+unsigned long Dcf77Signal::getDroppedBits() {
+    return _droppedBits;
+}
+
+unsigned long Dcf77Signal::getSentBits() {
+    return _sentBits;
+}
+
+/*
+ * Dcf77Loop
+ */
+Dcf77Loop::Dcf77Loop(Dcf77Signal *signal, byte pin) {
+    _signal = signal;
+    _pin = pin;
+    _nextEdge = 0;
+    _loopMicros = 1000;
+    _stallEvery = 0;
+    _stallMicros = 0;
+    _loops = 0;
+}
+
+void Dcf77Loop::setLoopMicros(unsigned long loopMicros) {
+    _loopMicros = loopMicros;
+}
+
+void Dcf77Loop::setStall(unsigned long stallEvery, unsigned long stallMicros) {
+    _stallEvery = stallEvery;
+    _stallMicros = stallMicros;
+}
+
+void Dcf77Loop::run(unsigned long until, const std::function<void()> &poll) {
+    while (micros() < until) {
+        unsigned long next = micros() + _loopMicros;
+        _loops++;
+        if (_stallEvery && ((_loops % _stallEvery) == 0)) {
+            next += _stallMicros;
+        }
+        // die Flanken bis zum naechsten Durchlauf kommen zu ihrer Zeit an den Pin...
+        while ((_nextEdge < _signal->edges.size()) && (_signal->edges[_nextEdge].time <= next)) {
+            const Dcf77Edge &edge = _signal->edges[_nextEdge++];
+            if (edge.time > micros()) {
+                hostSetMicros(edge.time);
+            }
+            hostSetPin(_pin, edge.level ? HIGH : LOW);
+        }
+        hostSetMicros(next);
+        poll();
+    }
+}
@@ -0,0 +1,153 @@
+/**
+ * Dcf77Simulation
+ * Ein synthetisches DCF77-Signal fuer Tests und Benchmarks am Rechner: Telegramme
+ * codieren, Minuten mit Stoerungen (falsche Bits, Spitzen, Aussetzer, Zittern
+ * der Flanken) erzeugen und die Firmware-Schleife mit poll() im eingestellten
+ * Takt (auch mit Haengern) darueber laufen lassen. Die Flanken gehen per
+ * hostSetPin() an den Pin, also auch in einen Pin-Interrupt.
+ *
+ * @mc       Host (Linux/macOS)
+ * @autor    agent / agent _AT_ local
+ *           Vorlage von: Christian Aschoff / caschoff _AT_ mac _DOT_ com
+ * @version  1.1
+ * @created  18.10.2026
+ * @updated  18.10.2026
+ *
+ * Versionshistorie:
+ * V 1.0:  - Erstellt.
+ * V 1.1:  - DCF77_SIM_LOST_MINUTES fuer die Tests mit MYDCF77_ACCUMULATOR.
+ */
+#ifndef DCF77_SIMULATION_H
+#define DCF77_SIMULATION_H
+
+#include "HostArduino.h"
+#include "TimeStamp.h"
+#include <functional>
+#include <vector>
+
+#define DCF77_SIM_SECOND 1000000UL
+#define DCF77_SIM_MINUTE (60 * DCF77_SIM_SECOND)
+
+// Die Minuten ohne Synchronisation am Anfang eines sauberen Signals: mit MYDCF77_MATCHED_FILTER
+// geht beim Einrasten die erste verloren, mit MYDCF77_ACCUMULATOR auch die zweite (die Schwelle
+// braucht zwei Telegramme).
+#ifdef MYDCF77_ACCUMULATOR
+#define DCF77_SIM_LOST_MINUTES 2
+#else
+#define DCF77_SIM_LOST_MINUTES 1
+#endif
+
+/**
+ * Eine Uhrzeit, wie sie im Telegramm steht (Jahr zweistellig, Wochentag 1 = Montag).
+ */
+struct Dcf77Time {
+    byte minutes;
+    byte hours;
+    byte date;
+    byte dayOfWeek;
+    byte month;
+    byte year;
+};
+
+uint64_t dcf77Encode(const Dcf77Time &time);
+void dcf77NextMinute(Dcf77Time &time);
+boolean dcf77Equals(const Dcf77Time &time, TimeStamp *timeStamp);
+void dcf77Set(TimeStamp *timeStamp, const Dcf77Time &time);
+
+/**
+ * Reproduzierbare Zufallszahlen (xorshift32), unabhaengig von der C++-Bibliothek.
+ */
+class Dcf77Random {
+public:
+    explicit Dcf77Random(uint32_t seed);
+
+    uint32_t next();
+    // gleichverteilt in [0, 1)
+    double uniform();
+    // gleichverteilt in [0, n)
+    uint32_t below(uint32_t n);
+    // ein Ereignis mit der Wahrscheinlichkeit p
+    bool chance(double p);
+
+private:
+    uint32_t _state;
+};
+
+/**
+ * Die Stoerungen pro Sekunde.
+ */
+struct Dcf77Noise {
+    // Wahrscheinlichkeit, dass ein Impuls die falsche Laenge hat (100ms statt 200ms und umgekehrt).
+    double flipRate;
+    // Wahrscheinlichkeit, dass ein Impuls ganz fehlt.
+    double dropRate;
+    // Stoerspitzen pro Sekunde (der Pegel kippt fuer 1 bis glitchMaxMicros).
+    double glitchRate;
+    unsigned long glitchMaxMicros;
+    // Die Flanken zittern um bis zu +-jitterMicros.
+    unsigned long jitterMicros;
+};
+
+extern const Dcf77Noise dcf77Clean;
+
+struct Dcf77Edge {
+    unsigned long time;
+    boolean level;
+};
+
+/**
+ * Das Signal am Ausgang des Empfaengers (HIGH = Absenkung des Traegers, nicht
+ * invertiert) als Folge von Flanken.
+ */
+class Dcf77Signal {
+public:
+    explicit Dcf77Signal(uint32_t seed);
+
+    void setNoise(const Dcf77Noise &noise);
+
+    // Eine Minute mit dem Telegramm ab start anhaengen (Sekunde 59 ohne Impuls).
+    void appendMinute(unsigned long start, uint64_t telegram);
+
+    // Die Impulse, die mit falscher Laenge oder gar nicht gesendet wurden.
+    unsigned long getFlippedBits();
+    unsigned long getDroppedBits();
+    unsigned long getSentBits();
+
+    std::vector<Dcf77Edge> edges;
+
+private:
+    Dcf77Random _random;
+    Dcf77Noise _noise;
+    unsigned long _flippedBits;
+    unsigned long _droppedBits;
+    unsigned long _sentBits;
+
+    long _jitter();
+};
+
+/**
+ * Die Schleife der Firmware: alle loopMicros poll(), dazwischen kommen die
+ * Flanken zu ihrer Zeit an den Pin. Alle stallEvery Durchlaeufe dauert ein
+ * Durchlauf stallMicros laenger (Ausgabe auf die LEDs, I2C...).
+ */
+class Dcf77Loop {
+public:
+    Dcf77Loop(Dcf77Signal *signal, byte pin);
+
+    void setLoopMicros(unsigned long loopMicros);
+    void setStall(unsigned long stallEvery, unsigned long stallMicros);
+
+    // bis until laufen, poll() bei jedem Durchlauf.
+    void run(unsigned long until, const std::function<void()> &poll);
+
+private:
+    Dcf77Signal *_signal;
+    byte _pin;
+    size_t _nextEdge;
+    unsigned long _loopMicros;
+    unsigned long _stallEvery;
+    unsigned long _stallMicros;
+    unsigned long _loops;
+};
+
+#endif
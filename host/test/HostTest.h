@@ -0,0 +1,56 @@
+/**
+ * HostTest
+ * Minimale Pruefungen fuer die Tests am Rechner: CHECK() und CHECK_EQUAL()
+ * zaehlen Fehler und geben sie mit Datei und Zeile aus, hostTestResult()
+ * liefert den Exit-Code fuer ctest.
+ *
+ * @mc       Host (Linux/macOS)
+ * @autor    agent / agent _AT_ local
+ *           Vorlage von: Christian Aschoff / caschoff _AT_ mac _DOT_ com
+ * @version  1.0
+ * @created  18.10.2026
+ *
+ * Versionshistorie:
+ * V 1.0:  - Erstellt.
+ */
+#ifndef HOST_TEST_H
+#define HOST_TEST_H
+
+#include <stdio.h>
+
+inline unsigned long &hostTestFailures() {
+    static unsigned long failures;
+    return failures;
+}
+
+inline unsigned long &hostTestChecks() {
+    static unsigned long checks;
+    return checks;
+}
+
+inline bool hostCheck(bool ok, const char *what, const char *file, int line) {
+    hostTestChecks()++;
+    if (!ok) {
+        hostTestFailures()++;
+        printf("%s:%d: FEHLER: %s\n", file, line, what);
+    }
+    return ok;
+}
+
+#define CHECK(cond) hostCheck((cond), #cond, __FILE__, __LINE__)
+
+#define CHECK_EQUAL(expected, actual)                                                       \
+    do {                                                                                    \
+        unsigned long long hostExpected = (unsigned long long)(expected);                   \
+        unsigned long long hostActual = (unsigned long long)(actual);                       \
+        if (!hostCheck(hostExpected == hostActual, #actual " == " #expected, __FILE__, __LINE__)) { \
+            printf("    erwartet 0x%llx, ist 0x%llx\n", hostExpected, hostActual);            \
+        }                                                                                   \
+    } while (0)
+
+inline int hostTestResult() {
+    printf("%lu Pruefungen, %lu Fehler\n", hostTestChecks(), hostTestFailures());
+    return hostTestFailures() ? 1 : 0;
+}
+
+#endif
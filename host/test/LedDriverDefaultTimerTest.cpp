@@ -0,0 +1,143 @@
+/**
+ * LedDriverDefaultTimerTest
+ * Prueft das Multiplexen von LedDriverDefault per Timer1-Interrupt
+ * (LED_DRIVER_DEFAULT_TIMER): die Interrupt-Routine gibt nie Interrupts frei
+ * und schreibt SREG nicht, die Anzeit pro Zeile (OutputEnable LOW, gemessen
+ * in Takten von Timer1 ueber OCR1A) ist fuer jede Helligkeit genau
+ * Helligkeit / (2^BITS - 1). Nur mit SHIFTREGISTER_SPI
+ * (led_driver_default_timer_test_spi) wird zusaetzlich geprueft, dass ein
+ * neues Bild erst mit Zeile 0 gezeigt wird: dort stehen die Bytes jeder Zeile
+ * in SPI.history(), ohne SPI schreibt der Interrupt direkt auf die Ports und
+ * die einzelnen Bits sind am Rechner nicht zu sehen.
+ * Ausgegeben wird die Bildwiederholrate (ohne die Zeit fuer die Shift-Register).
+ *
+ * @mc       Host (Linux/macOS)
+ * @autor    agent / agent _AT_ local
+ *           Vorlage von: Christian Aschoff / caschoff _AT_ mac _DOT_ com
+ * @version  1.0
+ * @created  18.10.2026
+ *
+ * Versionshistorie:
+ * V 1.0:  - Erstellt.
+ */
+#include "HostArduino.h"
+#include "HostTest.h"
+#include "Renderer.h"
+#include "LedDriverDefault.h"
+#ifdef SHIFTREGISTER_SPI
+#include <SPI.h>
+#endif
+
+#define OUTPUT_ENABLE_PIN 3
+#define LINES 10
+
+extern "C" void TIMER1_COMPA_vect(void);
+
+#ifdef SHIFTREGISTER_SPI
+/**
+ * Die vier Bytes, die der Interrupt am Anfang einer Zeile geschickt hat.
+ */
+static bool rowSent(const word matrix[16], byte row) {
+    word columns = ~matrix[row];
+    word rowBit = 1 << row;
+    return (SPI.history(3) == lowByte(columns)) && (SPI.history(2) == highByte(columns)) &&
+           (SPI.history(1) == lowByte(rowBit)) && (SPI.history(0) == highByte(rowBit));
+}
+#endif
+
+int main() {
+    hostReset();
+    Renderer renderer;
+    word matrix[16];
+    word nextMatrix[16];
+    renderer.clearScreenBuffer(matrix);
+    renderer.setMinutes(10, 25, LANGUAGE_DE_DE, matrix);
+    renderer.clearScreenBuffer(nextMatrix);
+    renderer.setMinutes(10, 30, LANGUAGE_DE_DE, nextMatrix);
+
+    LedDriverDefault ledDriver(10, 12, 11, OUTPUT_ENABLE_PIN, LINES);
+    ledDriver.init();
+#ifdef SHIFTREGISTER_SPI
+    CHECK(SPI.isBegun());
+#endif
+    ledDriver.wakeUp();
+    CHECK(TIMSK1 & _BV(OCIE1A));
+
+#ifdef SHIFTREGISTER_SPI
+    // was der Interrupt zeigt (vor dem ersten Bild nichts) und was er mit der naechsten Zeile 0 zeigen soll...
+    const word *shown = 0;
+    const word *queued = 0;
+    unsigned long badRows = 0;
+#endif
+
+    unsigned long frameTicks = 0;
+    unsigned long badDuty = 0;
+    for (byte brightness = 0; brightness <= 100; brightness++) {
+        ledDriver.setBrightness(brightness);
+        ledDriver.writeScreenBufferToMatrix(matrix, true);
+#ifdef SHIFTREGISTER_SPI
+        queued = matrix;
+#endif
+        hostResetCounters();
+
+        // Drei Bilder, das neue kommt mitten im zweiten...
+        unsigned long onTicks = 0;
+        unsigned long ticks = 0;
+        for (unsigned int slice = 0; slice < 3 * LINES * LED_DRIVER_DEFAULT_BCM_BITS; slice++) {
+            if (slice == (3 * LINES * LED_DRIVER_DEFAULT_BCM_BITS) / 2) {
+                ledDriver.writeScreenBufferToMatrix(nextMatrix, true);
+#ifdef SHIFTREGISTER_SPI
+                queued = nextMatrix;
+#endif
+            }
+            TIMER1_COMPA_vect();
+#ifdef SHIFTREGISTER_SPI
+            if ((slice % LED_DRIVER_DEFAULT_BCM_BITS) == 0) {
+                // die Zeilen laufen ab 1, Zeile 0 kommt nach den letzten...
+                byte row = (slice / LED_DRIVER_DEFAULT_BCM_BITS + 1) % LINES;
+                if ((row == 0) && queued) {
+                    shown = queued;
+                    queued = 0;
+                }
+                if (shown && !rowSent(shown, row)) {
+                    badRows++;
+                }
+            }
+#endif
+            unsigned long sliceTicks = OCR1A + 1UL;
+            ticks += sliceTicks;
+            if (hostGetPin(OUTPUT_ENABLE_PIN) == LOW) {
+                onTicks += sliceTicks;
+            }
+        }
+        frameTicks = ticks / 3;
+
+        byte level = ((word) brightness * ((1 << LED_DRIVER_DEFAULT_BCM_BITS) - 1) + 50) / 100;
+        if (onTicks * ((1 << LED_DRIVER_DEFAULT_BCM_BITS) - 1) != ticks * level) {
+            printf("Helligkeit %d%%: %lu von %lu Takten an, erwartet %d/%d\n", brightness, onTicks, ticks, level, (1 << LED_DRIVER_DEFAULT_BCM_BITS) - 1);
+            badDuty++;
+        }
+        // ...mit 0% immer dunkel, mit 100% immer an...
+        if (((brightness == 0) && (onTicks != 0)) || ((brightness == 100) && (onTicks != ticks))) {
+            badDuty++;
+        }
+
+        CHECK_EQUAL(0, hostCounters.interruptEnables);
+        CHECK_EQUAL(0, hostCounters.interruptDisables);
+        CHECK_EQUAL(0, hostCounters.sregWrites);
+    }
+    CHECK_EQUAL(0, badDuty);
+#ifdef SHIFTREGISTER_SPI
+    CHECK_EQUAL(0, badRows);
+#endif
+
+    printf("Bild: %lu Takte (Timer1, Prescaler 8), %.1f Hz ohne das Schreiben der Shift-Register\n",
+           frameTicks, (F_CPU / 8.0) / frameTicks);
+    CHECK(frameTicks > 0);
+
+    ledDriver.shutDown();
+    CHECK((TIMSK1 & _BV(OCIE1A)) == 0);
+    CHECK_EQUAL(HIGH, hostGetPin(OUTPUT_ENABLE_PIN));
+
+    return hostTestResult();
+}
@@ -0,0 +1,236 @@
+/**
+ * LedDriverDeltaTest
+ * Prueft, dass die Treiber, die nur die geaenderten Pixel schreiben
+ * (NeoPixel, DotStar, LPD8806 und UeberPixel), nach jedem Bild denselben
+ * Inhalt im Streifen bzw. in den MAX7219 haben wie ein zweiter Treiber,
+ * der vor jedem Bild mit clearData() geloescht wird und das ganze Bild neu
+ * schreibt. Dazwischen wechseln Helligkeit, Farbe und shutDown()/wakeUp().
+ * Mit LED_DRIVER_INTENSITY (led_driver_delta_test_intensity) wechseln auch die
+ * Intensitaeten einzelner Pixel, der Ecken und der Alarm-LED. Dazu muss bei den
+ * LED-Stripes eine neue Intensitaet genau die LED dieses Pixels neu schreiben,
+ * mit der Farbe (pro Farbanteil) wie _scaleIntensity().
+ *
+ * @mc       Host (Linux/macOS)
+ * @autor    agent / agent _AT_ local
+ *           Vorlage von: Christian Aschoff / caschoff _AT_ mac _DOT_ com
+ * @version  1.1
+ * @created  18.10.2026
+ * @updated  18.10.2026
+ *
+ * Versionshistorie:
+ * V 1.0:  - Erstellt.
+ * V 1.1:  - Intensitaeten (LED_DRIVER_INTENSITY).
+ */
+#include "HostArduino.h"
+#include "HostTest.h"
+#include "Renderer.h"
+#include "LedDriverNeoPixel.h"
+#include "LedDriverDotStar.h"
+#include "LedDriverLPD8806.h"
+#include "LedDriverUeberPixel.h"
+#include <vector>
+
+template <class Strip>
+static bool sameStrip(Strip *a, Strip *b) {
+    for (uint16_t i = 0; i < a->numPixels(); i++) {
+        if (a->getPixelColor(i) != b->getPixelColor(i)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static bool sameMax7219(LedControl *a, LedControl *b) {
+    for (int addr = 0; addr < 4; addr++) {
+        for (int row = 0; row < 8; row++) {
+            if (a->getRow(addr, row) != b->getRow(addr, row)) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+/**
+ * Alle Sprachen, alle Minuten des Tages, mit Ecken und Alarm-LED.
+ */
+template <class Compare>
+static void checkDriver(const char *name, LedDriver *live, LedDriver *full, Compare same) {
+    Renderer renderer;
+    word matrix[16];
+    unsigned long frames = 0;
+    unsigned long mismatches = 0;
+
+    live->init();
+    full->init();
+    for (byte language = 0; language <= LANGUAGE_COUNT; language++) {
+        for (unsigned int m = 0; m < 24 * 60; m++, frames++) {
+            renderer.clearScreenBuffer(matrix);
+            renderer.setMinutes(m / 60, m % 60, language, matrix);
+            renderer.setCorners(m % 60, (language & 1) == 0, matrix);
+            if ((m % 7) == 0) {
+                renderer.activateAlarmLed(matrix);
+            }
+
+            if ((frames % 97) == 0) {
+                byte brightness = 10 + (frames / 97) % 90;
+                live->setBrightness(brightness);
+                full->setBrightness(brightness);
+            }
+            if ((frames % 301) == 0) {
+                byte c = frames / 301;
+                live->setColor(255 - c, 100 + c, c * 3);
+                full->setColor(255 - c, 100 + c, c * 3);
+            }
+            if ((frames % 499) == 0) {
+                live->shutDown();
+                live->wakeUp();
+            }
+#ifdef LED_DRIVER_INTENSITY
+            if ((frames % 13) == 0) {
+                byte x = (frames / 13) % 11;
+                byte y = (frames / 143) % 10;
+                byte intensity = frames * 37;
+                live->setPixelIntensity(x, y, intensity);
+                full->setPixelIntensity(x, y, intensity);
+            }
+            if ((frames % 211) == 0) {
+                live->setCornerIntensity((frames / 211) % 4, frames);
+                full->setCornerIntensity((frames / 211) % 4, frames);
+                live->setAlarmLedIntensity(frames * 3);
+                full->setAlarmLedIntensity(frames * 3);
+            }
+            if ((frames % 1009) == 0) {
+                live->setAllIntensities(255);
+                full->setAllIntensities(255);
+            }
+#endif
+
+            live->writeScreenBufferToMatrix(matrix, true);
+            full->clearData();
+            full->writeScreenBufferToMatrix(matrix, true);
+            if (!same()) {
+                mismatches++;
+            }
+        }
+    }
+    if (mismatches) {
+        printf("%s: %lu von %lu Bildern verschieden\n", name, mismatches, frames);
+    }
+    CHECK_EQUAL(0, mismatches);
+}
+
+#ifdef LED_DRIVER_INTENSITY
+/**
+ * Ein Farbanteil mit der Intensitaet wie LedDriver::_scaleIntensity().
+ */
+static uint32_t scaleColor(uint32_t color, byte intensity) {
+    uint32_t scaled = 0;
+    for (byte shift = 0; shift < 24; shift += 8) {
+        scaled |= ((((color >> shift) & 0xFF) * (intensity + 1)) >> 8) << shift;
+    }
+    return scaled;
+}
+
+/**
+ * Fuer jeden eingeschalteten Buchstaben eines Bildes nacheinander eine neue
+ * Intensitaet: genau eine LED wird geschrieben und hat die skalierte Farbe,
+ * alle anderen bleiben, wie sie mit voller Intensitaet waren.
+ */
+template <class Strip>
+static void checkIntensity(const char *name, LedDriver *driver, Strip *strip) {
+    Renderer renderer;
+    word matrix[16];
+    renderer.clearScreenBuffer(matrix);
+    renderer.setMinutes(10, 25, LANGUAGE_DE_DE, matrix);
+    driver->init();
+    driver->setColor(250, 120, 60);
+    driver->setBrightness(80);
+    driver->writeScreenBufferToMatrix(matrix, true);
+    std::vector<uint32_t> full;
+    for (uint16_t i = 0; i < strip->numPixels(); i++) {
+        full.push_back(strip->getPixelColor(i));
+    }
+
+    unsigned long pixels = 0;
+    unsigned long wrongWrites = 0;
+    unsigned long wrongColors = 0;
+    for (byte y = 0; y < 10; y++) {
+        for (byte x = 0; x < 11; x++) {
+            if (!driver->getPixelFromScreenBuffer(x, y, matrix)) {
+                continue;
+            }
+            byte intensity = 17 + pixels * 41;
+            pixels++;
+            hostResetCounters();
+            driver->setPixelIntensity(x, y, intensity);
+            driver->writeScreenBufferToMatrix(matrix, true);
+            if (hostCounters.pixelWrites != 1) {
+                wrongWrites++;
+            }
+            byte changed = 0;
+            for (uint16_t i = 0; i < strip->numPixels(); i++) {
+                uint32_t color = strip->getPixelColor(i);
+                if (color != full[i]) {
+                    changed++;
+                    wrongColors += (color != scaleColor(full[i], intensity));
+                }
+            }
+            wrongColors += (changed != 1);
+
+            // ...und zurueck auf die volle Intensitaet...
+            driver->setPixelIntensity(x, y, 255);
+            driver->writeScreenBufferToMatrix(matrix, true);
+        }
+    }
+    printf("%s: %lu Buchstaben mit eigener Intensitaet\n", name, pixels);
+    CHECK(pixels > 0);
+    CHECK_EQUAL(0, wrongWrites);
+    CHECK_EQUAL(0, wrongColors);
+}
+#endif
+
+int main() {
+    hostReset();
+
+    LedDriverNeoPixel neoPixel(6);
+    Adafruit_NeoPixel *neoPixelStrip = Adafruit_NeoPixel::hostLast;
+    LedDriverNeoPixel neoPixelFull(6);
+    Adafruit_NeoPixel *neoPixelFullStrip = Adafruit_NeoPixel::hostLast;
+    checkDriver("LedDriverNeoPixel", &neoPixel, &neoPixelFull, [&]() {
+        return sameStrip(neoPixelStrip, neoPixelFullStrip);
+    });
+
+    LedDriverDotStar dotStar(6, 7);
+    Adafruit_DotStar *dotStarStrip = Adafruit_DotStar::hostLast;
+    LedDriverDotStar dotStarFull(6, 7);
+    Adafruit_DotStar *dotStarFullStrip = Adafruit_DotStar::hostLast;
+    checkDriver("LedDriverDotStar", &dotStar, &dotStarFull, [&]() {
+        return sameStrip(dotStarStrip, dotStarFullStrip);
+    });
+
+    LedDriverLPD8806 lpd8806(6, 7);
+    LPD8806 *lpd8806Strip = LPD8806::hostLast;
+    LedDriverLPD8806 lpd8806Full(6, 7);
+    LPD8806 *lpd8806FullStrip = LPD8806::hostLast;
+    checkDriver("LedDriverLPD8806", &lpd8806, &lpd8806Full, [&]() {
+        return sameStrip(lpd8806Strip, lpd8806FullStrip);
+    });
+
+#ifdef LED_DRIVER_INTENSITY
+    checkIntensity("LedDriverNeoPixel", &neoPixel, neoPixelStrip);
+    checkIntensity("LedDriverDotStar", &dotStar, dotStarStrip);
+    checkIntensity("LedDriverLPD8806", &lpd8806, lpd8806Strip);
+#endif
+
+    // zwei Ketten an verschiedenen Pins, sonst hoeren beide alles mit...
+    LedDriverUeberPixel ueberPixel(5, 6, 7);
+    LedControl *ueberPixelChain = LedControl::hostLast;
+    LedDriverUeberPixel ueberPixelFull(8, 9, 10);
+    LedControl *ueberPixelFullChain = LedControl::hostLast;
+    checkDriver("LedDriverUeberPixel", &ueberPixel, &ueberPixelFull, [&]() {
+        return sameMax7219(ueberPixelChain, ueberPixelFullChain);
+    });
+
+    return hostTestResult();
+}
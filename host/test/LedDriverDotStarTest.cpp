@@ -0,0 +1,137 @@
+/**
+ * LedDriverDotStarTest
+ * Prueft LedDriverDotStar mit LED_DRIVER_DOTSTAR_GLOBAL_BRIGHTNESS: ein
+ * DotStarStrip laesst sich nicht in einen Adafruit_DotStar* umwandeln (dessen
+ * show() wuerde das Helligkeitsfeld uebergehen), und die eigene Ausgabe sperrt
+ * die Interrupts pro Byte und stellt den alten Zustand wieder her.
+ * Mit LED_DRIVER_CURRENT_LIMIT: der Strom aus Farben und Helligkeitsfeld
+ * bleibt fuer jede Helligkeit im Budget, ohne unnoetig dunkel zu werden.
+ *
+ * @mc       Host (Linux/macOS)
+ * @autor    agent / agent _AT_ local
+ *           Vorlage von: Christian Aschoff / caschoff _AT_ mac _DOT_ com
+ * @version  1.0
+ * @created  18.10.2026
+ *
+ * Versionshistorie:
+ * V 1.0:  - Erstellt.
+ */
+#include "HostArduino.h"
+#include "HostTest.h"
+#include "Renderer.h"
+#include "LedDriverDotStar.h"
+#include <type_traits>
+
+static_assert(!std::is_convertible<DotStarStrip *, Adafruit_DotStar *>::value,
+              "DotStarStrip darf nicht als Adafruit_DotStar (mit dessen show()) benutzt werden");
+
+// Start-Frame, pro LED Helligkeitsfeld und drei Farben, End-Frame...
+#define DOTSTAR_SHOW_BYTES (4 + 114 * 4 + (114 + 15) / 16)
+
+#ifdef LED_DRIVER_CURRENT_LIMIT
+/**
+ * Zugriff auf den Streifen (Farben und Helligkeitsfeld).
+ */
+class TestDotStar : public LedDriverDotStar {
+public:
+    TestDotStar() : LedDriverDotStar(6, 7) {
+    }
+    DotStarStrip *strip() {
+        return _strip;
+    }
+};
+
+/**
+ * Der Strom, den der Streifen gerade zieht (in mA, wie der Treiber ihn abschaetzt):
+ * LED_DRIVER_MA_PER_CHANNEL pro Farbe bei voller Stufe, mal Helligkeitsfeld / 31.
+ */
+static double stripCurrent(DotStarStrip *strip) {
+    double load = 0;
+    for (uint16_t i = 0; i < strip->numPixels(); i++) {
+        uint32_t c = strip->getPixelColor(i);
+        load += ((c >> 16) & 0xFF) + ((c >> 8) & 0xFF) + (c & 0xFF);
+    }
+    return load / 255.0 * LED_DRIVER_MA_PER_CHANNEL * strip->getGlobalBrightness() / 31.0;
+}
+
+/**
+ * Fuer jede Helligkeit (nur Refresh, das Feld aendert sich ohne neues Bild):
+ * nie ueber dem Budget, und nicht mehr als 10% dunkler als noetig.
+ */
+static void checkCurrentLimit(const char *name, word matrix[16]) {
+    TestDotStar ledDriver;
+    ledDriver.init();
+    ledDriver.setBrightness(100);
+    ledDriver.writeScreenBufferToMatrix(matrix, true);
+
+    // der volle Strom ohne Begrenzung...
+    double full = 0;
+    for (uint16_t i = 0; i < ledDriver.strip()->numPixels(); i++) {
+        uint32_t c = ledDriver.strip()->getPixelColor(i);
+        if (c != 0) {
+            full += (250 + 255 + 200) / 255.0 * LED_DRIVER_MA_PER_CHANNEL;
+        }
+    }
+
+    unsigned long overBudget = 0;
+    unsigned long overDimmed = 0;
+    for (byte brightness = 1; brightness <= 100; brightness++) {
+        ledDriver.setBrightness(brightness);
+        ledDriver.writeScreenBufferToMatrix(matrix, false);
+        double current = stripCurrent(ledDriver.strip());
+        double wanted = min(full * brightness / 100.0, (double)LED_DRIVER_CURRENT_BUDGET_MA);
+        if (current > LED_DRIVER_CURRENT_BUDGET_MA) {
+            printf("%s, %d%%: %.0f mA ueber dem Budget\n", name, brightness, current);
+            overBudget++;
+        }
+        if (current < wanted * 0.9) {
+            printf("%s, %d%%: %.0f mA statt %.0f mA\n", name, brightness, current, wanted);
+            overDimmed++;
+        }
+    }
+    CHECK_EQUAL(0, overBudget);
+    CHECK_EQUAL(0, overDimmed);
+}
+#endif
+
+int main() {
+    hostReset();
+    Renderer renderer;
+    word matrix[16];
+    renderer.clearScreenBuffer(matrix);
+    renderer.setMinutes(10, 25, LANGUAGE_DE_DE, matrix);
+
+    LedDriverDotStar ledDriver(6, 7);
+    ledDriver.init();
+    ledDriver.setBrightness(50);
+    ledDriver.writeScreenBufferToMatrix(matrix, true);
+
+    // nur das Helligkeitsfeld aendert sich, es gibt genau eine Ausgabe...
+    hostResetCounters();
+    ledDriver.setBrightness(80);
+    ledDriver.writeScreenBufferToMatrix(matrix, false);
+    CHECK_EQUAL(DOTSTAR_SHOW_BYTES, hostCounters.interruptDisables);
+    CHECK_EQUAL(DOTSTAR_SHOW_BYTES, hostCounters.sregWrites);
+    CHECK_EQUAL(0, hostCounters.interruptEnables);
+    CHECK(SREG & _BV(SREG_I));
+
+    // ...mit gesperrten Interrupts bleiben sie gesperrt...
+    hostResetCounters();
+    cli();
+    ledDriver.setBrightness(30);
+    ledDriver.writeScreenBufferToMatrix(matrix, false);
+    CHECK((SREG & _BV(SREG_I)) == 0);
+    sei();
+    CHECK_EQUAL(DOTSTAR_SHOW_BYTES, hostCounters.sregWrites);
+
+#ifdef LED_DRIVER_CURRENT_LIMIT
+    word all[16];
+    for (byte y = 0; y < 16; y++) {
+        all[y] = (y < 10) ? 0xFFFF : 0;
+    }
+    checkCurrentLimit("Uhrzeit", matrix);
+    checkCurrentLimit("alle LEDs", all);
+#endif
+
+    return hostTestResult();
+}
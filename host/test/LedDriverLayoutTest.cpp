@@ -0,0 +1,271 @@
+/**
+ * LedDriverLayoutTest
+ * Prueft die Verkabelungs-Tabellen der Streifen-Treiber (LedDriverLayouts.h)
+ * gegen die _setPixel()- und _setEcke()-Funktionen, die sie ersetzt haben.
+ * Die alten Funktionen stehen unten unveraendert (Stand vor den Tabellen,
+ * LedDriverNeoPixel.cpp, LedDriverDotStar.cpp und LedDriverLPD8806.cpp in
+ * beiden Layouts), nur _strip merkt sich die Position statt zu leuchten.
+ *
+ * Geprueft wird zweimal: jeder Eintrag der Tabellen (beide LPD8806-Layouts)
+ * und jeder einzelne Pixel durch den echten Treiber, der genau die LED der
+ * alten Funktion einschalten muss.
+ *
+ * @mc       Host (Linux/macOS)
+ * @autor    agent / agent _AT_ local
+ *           Vorlage von: Christian Aschoff / caschoff _AT_ mac _DOT_ com
+ * @version  1.0
+ * @created  18.10.2026
+ *
+ * Versionshistorie:
+ * V 1.0:  - Erstellt.
+ */
+#include "HostArduino.h"
+#include "HostTest.h"
+#include "LedDriverLayouts.h"
+#include "LedDriverNeoPixel.h"
+#include "LedDriverDotStar.h"
+#include "LedDriverLPD8806.h"
+
+/**
+ * Statt eines Streifens: die zuletzt gesetzte Position.
+ */
+struct BaselineStrip {
+    int index;
+
+    void setPixelColor(uint16_t n, uint32_t c) {
+        index = n;
+    }
+};
+
+/**
+ * LedDriverNeoPixel::_setPixel(), gleich in LedDriverDotStar.
+ */
+struct BaselineSerpentine {
+    BaselineStrip *_strip;
+
+    void _setPixel(byte x, byte y, uint32_t c) {
+        _setPixel(x + (y * 11), c);
+    }
+
+    void _setPixel(byte num, uint32_t c) {
+        if (num < 110) {
+            if ((num / 11) % 2 == 0) {
+                _strip->setPixelColor(num, c);
+            } else {
+                _strip->setPixelColor(((num / 11) * 11) + 10 - (num % 11), c);
+            }
+        } else {
+            switch (num) {
+                case 110:
+                    _strip->setPixelColor(111, c);
+                    break;
+                case 111:
+                    _strip->setPixelColor(112, c);
+                    break;
+                case 112:
+                    _strip->setPixelColor(113, c);
+                    break;
+                case 113:
+                    _strip->setPixelColor(110, c);
+                    break;
+            }
+        }
+    }
+
+    // wie writeScreenBufferToMatrix(): _setPixel(15 - x, y) und _setPixel(110...113)
+    void set(byte num) {
+        if (num < 110) {
+            _setPixel(num % 11, num / 11, 1);
+        } else {
+            _setPixel(num, 1);
+        }
+    }
+};
+
+/**
+ * LedDriverLPD8806::_setPixel() ohne LPD_ALT_LAYOUT.
+ */
+struct BaselineLpd8806 {
+    BaselineStrip *_strip;
+
+    void _setPixel(byte x, byte y, uint32_t c) {
+        _setPixel(x + (y * 11), c);
+    }
+
+    void _setPixel(byte num, uint32_t c) {
+        if (num < 110) {
+            if ((num / 11) % 2 == 0) {
+                _strip->setPixelColor(num + (num / 11), c);
+            } else {
+                _strip->setPixelColor(((num / 11) * 12) + 11 - (num % 11), c);
+            }
+        } else {
+            switch (num) {
+                case 110:
+                    _strip->setPixelColor(111 + 11, c);
+                    break;
+                case 111:
+                    _strip->setPixelColor(112 + 12, c);
+                    break;
+                case 112:
+                    _strip->setPixelColor(113 + 13, c);
+                    break;
+                case 113:
+                    _strip->setPixelColor(110 + 10, c);
+                    break;
+            }
+        }
+    }
+
+    void set(byte num) {
+        if (num < 110) {
+            _setPixel(num % 11, num / 11, 1);
+        } else {
+            _setPixel(num, 1);
+        }
+    }
+};
+
+/**
+ * LedDriverLPD8806::_setPixel() und _setEcke() mit LPD_ALT_LAYOUT.
+ */
+struct BaselineLpd8806Alt {
+    BaselineStrip *_strip;
+
+    void _setEcke(uint8_t ecke, uint32_t c) {
+        switch(ecke) {
+        case 0:
+            _strip->setPixelColor(1, c);
+            break;
+        case 1:
+            // led unten links + zeile + 1. led
+            _strip->setPixelColor(2 + 12  + 1 , c);
+            break;
+        case 2:
+            // 2 * leds + 9 zeilen + 1. led
+            _strip->setPixelColor(2*2 + 9 *12 + 1, c);
+            break;
+        case 3:
+            // 10 zeilen + 3 * leds
+            _strip->setPixelColor(10 *12 + (3 * 2) + 1, c);
+            break;
+        }
+    }
+
+    void _setPixel(byte x, byte y, uint32_t c) {
+        if (y % 2==1) {
+            // Gegenläufige Reiche
+            x = 11 -x;
+        } else {
+            // Ganz links freilassen
+            x = x;
+        }
+        if (y == 0) {
+            _strip->setPixelColor(2+x, c);
+        } else if (y <=8) {
+            _strip->setPixelColor(y*12 +4 + x, c);
+        } else {
+            // oberste reihe
+            _strip->setPixelColor(y*12 +6 + x, c);
+        }
+    }
+
+    // wie writeScreenBufferToMatrix(): _setPixel(15 - x, 9 - y) und _setEcke(0...3)
+    void set(byte num) {
+        if (num < 110) {
+            _setPixel(num % 11, 9 - num / 11, 1);
+        } else {
+            _setEcke(num - 110, 1);
+        }
+    }
+};
+
+/**
+ * Jeder Eintrag der Tabelle gegen die alte Funktion.
+ */
+template <class Baseline>
+static void checkTable(const char *name, const byte *layout) {
+    BaselineStrip strip;
+    Baseline baseline = {&strip};
+    unsigned long mismatches = 0;
+
+    for (byte num = 0; num < 114; num++) {
+        strip.index = -1;
+        baseline.set(num);
+        if (strip.index != pgm_read_byte_near(&layout[num])) {
+            printf("%s: Pixel %d -> %d statt %d\n", name, num, pgm_read_byte_near(&layout[num]), strip.index);
+            mismatches++;
+        }
+    }
+    CHECK_EQUAL(0, mismatches);
+}
+
+/**
+ * Jeder Pixel einzeln durch den Treiber: genau die LED der alten Funktion leuchtet.
+ */
+template <class Baseline, class Strip>
+static void checkDriver(const char *name, LedDriver *driver, Strip *strip) {
+    BaselineStrip expected;
+    Baseline baseline = {&expected};
+    unsigned long mismatches = 0;
+    word matrix[16];
+
+    driver->init();
+    for (byte num = 0; num < 114; num++) {
+        memset(matrix, 0, sizeof(matrix));
+        if (num < 110) {
+            matrix[num / 11] = 1 << (15 - num % 11);
+        } else {
+            // Ecke 1, 2, 3, 4 steht in Zeile 1, 0, 3, 2...
+            matrix[(num - 110) ^ 1] = 0b0000000000011111;
+        }
+        driver->writeScreenBufferToMatrix(matrix, true);
+        baseline.set(num);
+
+        int lit = 0;
+        for (uint16_t i = 0; i < strip->numPixels(); i++) {
+            if (strip->getPixelColor(i) != 0) {
+                lit++;
+                if (i != expected.index) {
+                    printf("%s: Pixel %d leuchtet an %d statt %d\n", name, num, i, expected.index);
+                    mismatches++;
+                }
+            }
+        }
+        if (lit != 1) {
+            printf("%s: Pixel %d schaltet %d LEDs ein\n", name, num, lit);
+            mismatches++;
+        }
+    }
+    CHECK_EQUAL(0, mismatches);
+}
+
+static const byte layoutLpd8806Default[] PROGMEM = {
+    LED_DRIVER_LAYOUT(layoutLpd8806)
+};
+
+static const byte layoutLpd8806Alternative[] PROGMEM = {
+    LED_DRIVER_LAYOUT(layoutLpd8806Alt)
+};
+
+int main() {
+    hostReset();
+
+    checkTable<BaselineSerpentine>("layoutNeoPixel", layoutNeoPixel);
+    checkTable<BaselineSerpentine>("layoutDotStar", layoutDotStar);
+    checkTable<BaselineLpd8806>("layoutLpd8806", layoutLpd8806Default);
+    checkTable<BaselineLpd8806Alt>("layoutLpd8806Alt", layoutLpd8806Alternative);
+
+    LedDriverNeoPixel neoPixel(6);
+    checkDriver<BaselineSerpentine>("LedDriverNeoPixel", &neoPixel, Adafruit_NeoPixel::hostLast);
+    LedDriverDotStar dotStar(6, 7);
+    checkDriver<BaselineSerpentine>("LedDriverDotStar", &dotStar, Adafruit_DotStar::hostLast);
+    LedDriverLPD8806 lpd8806(6, 7);
+#ifdef LPD_ALT_LAYOUT
+    checkDriver<BaselineLpd8806Alt>("LedDriverLPD8806 (LPD_ALT_LAYOUT)", &lpd8806, LPD8806::hostLast);
+#else
+    checkDriver<BaselineLpd8806>("LedDriverLPD8806", &lpd8806, LPD8806::hostLast);
+#endif
+
+    return hostTestResult();
+}
@@ -0,0 +1,199 @@
+/**
+ * LedDriverPowerShiftRegisterTest
+ * Prueft den Bitstrom von LedDriverPowerShiftRegister (Transposition mit
+ * _transpose(), 15 Bytes am Stueck) Bit fuer Bit gegen die Schleife, die er
+ * ersetzt hat: ein shiftOutABit() mit getPixelFromScreenBuffer() pro Bit. Die
+ * alte Schleife steht unten unveraendert (Stand vor der Transposition,
+ * LedDriverPowerShiftRegister.cpp), nur sammelt sie die Bits statt sie
+ * rauszuschieben.
+ *
+ * Geprueft werden alle Minuten des Tages in jeder Sprache (mit Ecken und
+ * Alarm-LED) und Zufallsbilder, bei denen auch die Bits ausserhalb der Matrix
+ * und die Zeilen 10 bis 15 gesetzt sind. Mitgeschnitten wird, was am Ausgang
+ * ankommt: ohne SHIFTREGISTER_SPI Data bei jeder steigenden Clock-Flanke bis
+ * zum Latch (per digitalWrite()), mit (led_driver_power_shift_register_test_spi)
+ * die SPI-Bytes, das erste Bit ist das niederwertigste.
+ *
+ * @mc       Host (Linux/macOS)
+ * @autor    agent / agent _AT_ local
+ *           Vorlage von: Christian Aschoff / caschoff _AT_ mac _DOT_ com
+ * @version  1.0
+ * @created  18.10.2026
+ *
+ * Versionshistorie:
+ * V 1.0:  - Erstellt.
+ */
+#include "HostArduino.h"
+#include "HostTest.h"
+#include "Renderer.h"
+#include "LedDriverPowerShiftRegister.h"
+#ifdef SHIFTREGISTER_SPI
+#include <SPI.h>
+#endif
+#include <vector>
+
+// wie im Sketch (mit SHIFTREGISTER_SPI umverdrahtet, siehe Configuration.h)...
+#ifdef SHIFTREGISTER_SPI
+#define PIN_DATA 11
+#define PIN_CLOCK 13
+#define PIN_LATCH 10
+#else
+#define PIN_DATA 10
+#define PIN_CLOCK 12
+#define PIN_LATCH 11
+#endif
+#define PIN_OUTPUT_ENABLE 3
+
+#define STREAM_BITS (POWER_SHIFT_REGISTER_BYTES * 8)
+#define RANDOM_FRAMES 20000
+
+/**
+ * LedDriverPowerShiftRegister::writeScreenBufferToMatrix() mit
+ * LedDriver::getPixelFromScreenBuffer(), shiftOutABit() haengt das Bit an.
+ */
+struct BaselinePowerShiftRegister {
+    std::vector<bool> bits;
+
+    void shiftOutABit(boolean bitIsSet) {
+        bits.push_back(bitIsSet);
+    }
+
+    boolean getPixelFromScreenBuffer(byte x, byte y, word matrix[16]) {
+        return (matrix[y] & (0b1000000000000000 >> x)) == (0b1000000000000000 >> x);
+    }
+
+    void writeScreenBufferToMatrix(word matrix[16], boolean onChange) {
+        if (onChange) {
+            // die letzten 6 Outputs sind frei - padding
+            for (byte p = 0; p < 6; p++) {
+                shiftOutABit(false);
+            }
+
+            // dann Ecken...
+            // unten links...
+            shiftOutABit(getPixelFromScreenBuffer(11, 3, matrix));
+            // unten rechts...
+            shiftOutABit(getPixelFromScreenBuffer(11, 2, matrix));
+            // oben rechts...
+            shiftOutABit(getPixelFromScreenBuffer(11, 1, matrix));
+            // oben links...
+            shiftOutABit(getPixelFromScreenBuffer(11, 0, matrix));
+
+            // dann weiter...
+            for (int x = 10; x >= 0; x--) {
+                for (int y = 9; y >= 0; y--) {
+                    shiftOutABit(getPixelFromScreenBuffer(x, y, matrix));
+                }
+            }
+        }
+    }
+};
+
+/**
+ * Was bis zum letzten Latch am Ausgang ankam.
+ */
+static std::vector<bool> received;
+
+#ifndef SHIFTREGISTER_SPI
+static std::vector<bool> shifting;
+static uint8_t dataLevel;
+
+static void pinWritten(uint8_t pin, uint8_t val) {
+    if (pin == PIN_DATA) {
+        dataLevel = val;
+    } else if ((pin == PIN_CLOCK) && val) {
+        shifting.push_back(dataLevel);
+    } else if ((pin == PIN_LATCH) && val) {
+        received = shifting;
+        shifting.clear();
+    }
+}
+#endif
+
+/**
+ * Ein Bild durch den echten Treiber und die alte Schleife, die Bits vergleichen.
+ */
+static unsigned long frames;
+static unsigned long mismatches;
+
+static void checkFrame(LedDriverPowerShiftRegister *driver, word matrix[16], const char *name) {
+    BaselinePowerShiftRegister baseline;
+    baseline.writeScreenBufferToMatrix(matrix, true);
+
+    received.clear();
+#ifdef SHIFTREGISTER_SPI
+    unsigned long before = hostCounters.spiBytes;
+    driver->writeScreenBufferToMatrix(matrix, true);
+    CHECK_EQUAL(POWER_SHIFT_REGISTER_BYTES, hostCounters.spiBytes - before);
+    for (byte i = 0; i < POWER_SHIFT_REGISTER_BYTES; i++) {
+        byte b = SPI.history(POWER_SHIFT_REGISTER_BYTES - 1 - i);
+        for (byte n = 0; n < 8; n++) {
+            received.push_back(b & (1 << n));
+        }
+    }
+#else
+    driver->writeScreenBufferToMatrix(matrix, true);
+#endif
+
+    frames++;
+    if (received != baseline.bits) {
+        if (mismatches < 10) {
+            printf("%s: %lu Bits statt %lu, oder andere Bits\n", name, (unsigned long)received.size(),
+                   (unsigned long)baseline.bits.size());
+        }
+        mismatches++;
+    }
+}
+
+int main() {
+    hostReset();
+#ifndef SHIFTREGISTER_SPI
+    hostSetDigitalWriteHook(pinWritten);
+#endif
+    LedDriverPowerShiftRegister driver(PIN_DATA, PIN_CLOCK, PIN_LATCH, PIN_OUTPUT_ENABLE);
+    driver.init();
+    driver.wakeUp();
+
+    // die alte Schleife schiebt genau die 15 Bytes der Kette raus...
+    BaselinePowerShiftRegister lengthCheck;
+    word empty[16] = {0};
+    lengthCheck.writeScreenBufferToMatrix(empty, true);
+    CHECK_EQUAL(STREAM_BITS, lengthCheck.bits.size());
+
+    Renderer renderer;
+    word matrix[16];
+    char name[48];
+    for (byte language = 0; language <= LANGUAGE_COUNT; language++) {
+        for (unsigned int m = 0; m < 24 * 60; m++) {
+            renderer.clearScreenBuffer(matrix);
+            renderer.setMinutes(m / 60, m % 60, language, matrix);
+            renderer.setCorners(m % 60, (language & 1) == 0, matrix);
+            if ((m % 7) == 0) {
+                renderer.activateAlarmLed(matrix);
+            }
+            snprintf(name, sizeof(name), "Sprache %d, %02d:%02d", language, m / 60, m % 60);
+            checkFrame(&driver, matrix, name);
+        }
+    }
+
+    randomSeed(17);
+    for (unsigned long r = 0; r < RANDOM_FRAMES; r++) {
+        for (byte y = 0; y < 16; y++) {
+            matrix[y] = random(0x10000);
+        }
+        // ...auch einzelne Pixel und die volle Matrix...
+        if ((r % 3) == 0) {
+            memset(matrix, 0, sizeof(matrix));
+            matrix[random(16)] = 1 << random(16);
+        } else if ((r % 101) == 1) {
+            memset(matrix, 0xFF, sizeof(matrix));
+        }
+        snprintf(name, sizeof(name), "Zufallsbild %lu", r);
+        checkFrame(&driver, matrix, name);
+    }
+
+    printf("%lu Bilder, %lu mit anderen Bits\n", frames, mismatches);
+    CHECK_EQUAL(0, mismatches);
+
+    return hostTestResult();
+}
@@ -0,0 +1,223 @@
+/**
+ * LedDriverUeberPixelTest
+ * Prueft LedDriverUeberPixel (Schattenkopie der Digit-Register, ein Latch fuer
+ * alle vier MAX7219) gegen den Weg, den es ersetzt hat: _setPixel() und
+ * setLed() fuer jeden geaenderten Pixel. Der alte Weg steht unten
+ * unveraendert (Stand vor der Schattenkopie, LedDriverUeberPixel.cpp und das
+ * Delta aus LedDriver.cpp), nur LedControl merkt sich die Register selbst.
+ *
+ * Fuer jede Minute des Tages in jeder Sprache (mit Ecken, Alarm-LED und ab und
+ * zu clearData()) muessen alle 4x8 Digit-Register der MAX7219 gleich sein, die
+ * der neue Treiber per _writeDigit() ueber Data, Clock und Load schreibt
+ * (siehe LedControl im Host-Build). Gezaehlt werden die Uebertragungen (ein
+ * Load-Puls): alt ein setLed() pro Pixel, neu ein _writeDigit() pro Digit.
+ *
+ * @mc       Host (Linux/macOS)
+ * @autor    agent / agent _AT_ local
+ *           Vorlage von: Christian Aschoff / caschoff _AT_ mac _DOT_ com
+ * @version  1.0
+ * @created  18.10.2026
+ *
+ * Versionshistorie:
+ * V 1.0:  - Erstellt.
+ */
+#include "HostArduino.h"
+#include "HostTest.h"
+#include "Renderer.h"
+#include "LedDriverUeberPixel.h"
+
+/**
+ * Statt LedControl: die Register der vier MAX7219, jedes setLed() ist eine
+ * Uebertragung an die ganze Kette.
+ */
+struct BaselineLedControl {
+    byte status[4][8];
+    unsigned long transfers;
+
+    void setLed(int addr, int row, int col, boolean state) {
+        byte val = 0b10000000 >> col;
+        if (state) {
+            status[addr][row] |= val;
+        } else {
+            status[addr][row] &= ~val;
+        }
+        transfers++;
+    }
+
+    void clearDisplay(int addr) {
+        memset(status[addr], 0, 8);
+        transfers += 8;
+    }
+};
+
+/**
+ * LedDriverUeberPixel::writeScreenBufferToMatrix(), _setPixel() und clearData()
+ * mit _getChangedRows(), _getChangedPixels() und _storeLastMatrix() aus LedDriver.
+ */
+struct BaselineUeberPixel {
+    BaselineLedControl *_ledControl;
+    word _lastMatrix[16];
+    boolean _lastMatrixValid;
+
+    word _getChangedRows(word matrix[16]) {
+        if (!_lastMatrixValid) {
+            return (1 << 10) - 1;
+        }
+        word rows = 0;
+        for (byte y = 0; y < 10; y++) {
+            if (matrix[y] != _lastMatrix[y]) {
+                rows |= 1 << y;
+            }
+        }
+        return rows;
+    }
+
+    word _getChangedPixels(byte y, word matrix[16]) {
+        if (!_lastMatrixValid) {
+            return 0b1111111111111111;
+        }
+        return matrix[y] ^ _lastMatrix[y];
+    }
+
+    void _storeLastMatrix(word matrix[16]) {
+        for (byte y = 0; y < 10; y++) {
+            _lastMatrix[y] = matrix[y];
+        }
+        _lastMatrixValid = true;
+    }
+
+    void writeScreenBufferToMatrix(word matrix[16], boolean onChange) {
+        if (onChange) {
+            // nur die Pixel schreiben, die sich geaendert haben...
+            word changedRows = _getChangedRows(matrix);
+            if (changedRows == 0) {
+                return;
+            }
+
+            for (byte y = 0; y < 10; y++) {
+                if ((changedRows & (1 << y)) == 0) {
+                    continue;
+                }
+                word changedPixels = _getChangedPixels(y, matrix);
+                for (byte x = 5; x < 16; x++) {
+                    word t = 1 << x;
+                    if ((changedPixels & t) == t) {
+                        _setPixel(15 - x, y, (matrix[y] & t) == t);
+                    }
+                }
+            }
+
+            // wir muessen die Eck-LEDs umsetzten (Ecke 1, 2, 3, 4 steht in Zeile 1, 0, 3, 2
+            // und haengt am 1., 2., 3., 4. MAX7219 an Digit 6, 5, 6, 5)...
+            for (byte i = 0; i < 4; i++) {
+                byte y = i ^ 1;
+                if ((changedRows & (1 << y)) && (_getChangedPixels(y, matrix) & 0b0000000000011111)) {
+                    _ledControl->setLed(i, (i & 1) ? 5 : 6, 5, (matrix[y] & 0b0000000000011111) == 0b0000000000011111);
+                }
+            }
+
+            _storeLastMatrix(matrix);
+        }
+    }
+
+    void clearData() {
+        for (byte i = 0; i < 4; i++) {
+            _ledControl->clearDisplay(i);
+        }
+        _lastMatrixValid = false;
+    }
+
+    void _setPixel(byte x, byte y, boolean state) {
+        // 1. MAX7219
+        if ((x < 6) && (y < 5)) {
+            _ledControl->setLed(0, x, y, state);
+        }
+
+        // 2. MAX7219
+        if ((x < 6) && (y > 4) && (y < 10)) {
+            _ledControl->setLed(2, x, y - 5, state);
+        }
+
+        // 3. MAX7219
+        if ((x > 5) && (x < 11) && (y < 5)) {
+            _ledControl->setLed(1, x - 6, y, state);
+        }
+
+        // 4. MAX7219
+        if ((x > 5) && (x < 11) && (y > 4) && (y < 10)) {
+            _ledControl->setLed(3, x - 6, y - 5, state);
+        }
+    }
+};
+
+int main() {
+    hostReset();
+    LedDriverUeberPixel driver(5, 6, 7);
+    LedControl *chips = LedControl::hostLast;
+    BaselineLedControl baselineChips;
+    memset(&baselineChips, 0, sizeof(baselineChips));
+    BaselineUeberPixel baseline = {&baselineChips, {0}, false};
+
+    // init() schaltet die Ecken ein und laesst sie stehen, wie der alte Treiber...
+    driver.init();
+    baselineChips.setLed(0, 6, 5, true);
+    baselineChips.setLed(1, 5, 5, true);
+    baselineChips.setLed(2, 6, 5, true);
+    baselineChips.setLed(3, 5, 5, true);
+    baselineChips.transfers = 0;
+    hostResetCounters();
+
+    Renderer renderer;
+    word matrix[16];
+    unsigned long frames = 0;
+    unsigned long mismatches = 0;
+    unsigned long refreshWrites = 0;
+    unsigned long maxDigits = 0;
+    for (byte language = 0; language <= LANGUAGE_COUNT; language++) {
+        for (unsigned int m = 0; m < 24 * 60; m++, frames++) {
+            renderer.clearScreenBuffer(matrix);
+            renderer.setMinutes(m / 60, m % 60, language, matrix);
+            renderer.setCorners(m % 60, (language & 1) == 0, matrix);
+            if ((m % 7) == 0) {
+                renderer.activateAlarmLed(matrix);
+            }
+            if ((frames % 503) == 0) {
+                driver.clearData();
+                baseline.clearData();
+            }
+
+            unsigned long before = hostCounters.ledControlWrites;
+            driver.writeScreenBufferToMatrix(matrix, true);
+            baseline.writeScreenBufferToMatrix(matrix, true);
+            // ein _writeDigit() schreibt das Digit aller vier MAX7219...
+            maxDigits = max(maxDigits, (hostCounters.ledControlWrites - before) / 4);
+
+            before = hostCounters.ledControlWrites;
+            driver.writeScreenBufferToMatrix(matrix, false);
+            refreshWrites += hostCounters.ledControlWrites - before;
+
+            for (byte i = 0; i < 4; i++) {
+                for (byte digit = 0; digit < 8; digit++) {
+                    if (chips->getRow(i, digit) != baselineChips.status[i][digit]) {
+                        if (mismatches < 10) {
+                            printf("Sprache %d, %02d:%02d: MAX7219 %d Digit %d ist 0x%02x statt 0x%02x\n", language, m / 60,
+                                   m % 60, i, digit, chips->getRow(i, digit), baselineChips.status[i][digit]);
+                        }
+                        mismatches++;
+                    }
+                }
+            }
+        }
+    }
+
+    unsigned long transfers = hostCounters.ledControlWrites / 4;
+    printf("%lu Bilder: %lu Uebertragungen mit setLed(), %lu mit _writeDigit() (hoechstens %lu pro Bild)\n",
+           frames, baselineChips.transfers, transfers, maxDigits);
+    CHECK_EQUAL(0, mismatches);
+    CHECK_EQUAL(0, hostCounters.ledControlWrites % 4);
+    CHECK_EQUAL(0, refreshWrites);
+    CHECK(maxDigits <= 8);
+    CHECK(transfers < baselineChips.transfers);
+
+    return hostTestResult();
+}
@@ -0,0 +1,141 @@
+/**
+ * RenderCacheTest
+ * Prueft den Schluessel des Render-Caches (RenderCache, wie ihn
+ * renderCacheHit() im Sketch benutzt):
+ * - in der Zeitanzeige wird jede Minute genau einmal gerendert, egal wie oft
+ *   loop() pro Sekunde vorbeikommt,
+ * - jedes Feld des Schluessels (Modus, Stunden mit Zeitverschiebung, Minuten,
+ *   Sprache, Eck-LED-Richtung, Alarm-LED) erzwingt ein neues Bild,
+ * - eine blinkende Alarmzeit wird nie gecacht und verwirft den Cache, so dass
+ *   die danach stehende Alarmzeit neu gerendert wird,
+ * - invalidate() (z.B. nach REMOTE_BUTTON_SETCOLOR oder nach dem Lauftext)
+ *   erzwingt genau ein neues Bild,
+ * - getMode() liefert den Modus des Bildes im Bildspeicher (fuer den
+ *   Uebergang beim Minutenwechsel).
+ *
+ * @mc       Host (Linux/macOS)
+ * @autor    agent / agent _AT_ local
+ *           Vorlage von: Christian Aschoff / caschoff _AT_ mac _DOT_ com
+ * @version  1.0
+ * @created  18.10.2026
+ *
+ * Versionshistorie:
+ * V 1.0:  - Erstellt.
+ */
+#include "HostArduino.h"
+#include "HostTest.h"
+#include "RenderCache.h"
+
+// wie im Sketch...
+#define STD_MODE_NORMAL  0
+#define STD_MODE_ALARM   1
+#define EXT_MODE_TIMESET 17
+
+/**
+ * Ein Tag in der Zeitanzeige, loop() kommt loopsPerSecond mal pro Sekunde vorbei.
+ */
+static void checkDay(byte loopsPerSecond) {
+    RenderCache cache;
+    unsigned long renders = 0;
+    for (unsigned long s = 0; s < 24UL * 60 * 60; s++) {
+        for (byte l = 0; l < loopsPerSecond; l++) {
+            if (!cache.hit(STD_MODE_NORMAL, s / 3600, (s / 60) % 60, 0, true, RENDER_CACHE_ALARM_OFF)) {
+                renders++;
+            }
+        }
+    }
+    printf("%d Durchlaeufe pro Sekunde: %lu Bilder am Tag\n", loopsPerSecond, renders);
+    CHECK_EQUAL(24UL * 60, renders);
+}
+
+/**
+ * Jedes Feld des Schluessels fuer sich: einmal neu rendern, dann wieder Treffer.
+ */
+static void checkKey() {
+    RenderCache cache;
+    CHECK_EQUAL(RENDER_CACHE_INVALID, cache.getMode());
+    CHECK(!cache.hit(STD_MODE_NORMAL, 10, 25, 0, true, RENDER_CACHE_ALARM_OFF));
+    CHECK_EQUAL(STD_MODE_NORMAL, cache.getMode());
+    CHECK(cache.hit(STD_MODE_NORMAL, 10, 25, 0, true, RENDER_CACHE_ALARM_OFF));
+
+    // Modus...
+    CHECK(!cache.hit(EXT_MODE_TIMESET, 10, 25, 0, true, RENDER_CACHE_ALARM_OFF));
+    CHECK_EQUAL(EXT_MODE_TIMESET, cache.getMode());
+    CHECK(cache.hit(EXT_MODE_TIMESET, 10, 25, 0, true, RENDER_CACHE_ALARM_OFF));
+    CHECK(!cache.hit(STD_MODE_NORMAL, 10, 25, 0, true, RENDER_CACHE_ALARM_OFF));
+    // ...Stunden (Zeitverschiebung auch ins Negative)...
+    CHECK(!cache.hit(STD_MODE_NORMAL, 11, 25, 0, true, RENDER_CACHE_ALARM_OFF));
+    CHECK(!cache.hit(STD_MODE_NORMAL, -1, 25, 0, true, RENDER_CACHE_ALARM_OFF));
+    CHECK(cache.hit(STD_MODE_NORMAL, -1, 25, 0, true, RENDER_CACHE_ALARM_OFF));
+    CHECK(!cache.hit(STD_MODE_NORMAL, 10, 25, 0, true, RENDER_CACHE_ALARM_OFF));
+    // ...Minuten...
+    CHECK(!cache.hit(STD_MODE_NORMAL, 10, 26, 0, true, RENDER_CACHE_ALARM_OFF));
+    CHECK(cache.hit(STD_MODE_NORMAL, 10, 26, 0, true, RENDER_CACHE_ALARM_OFF));
+    // ...Sprache...
+    CHECK(!cache.hit(STD_MODE_NORMAL, 10, 26, 3, true, RENDER_CACHE_ALARM_OFF));
+    CHECK(cache.hit(STD_MODE_NORMAL, 10, 26, 3, true, RENDER_CACHE_ALARM_OFF));
+    // ...Eck-LED-Richtung...
+    CHECK(!cache.hit(STD_MODE_NORMAL, 10, 26, 3, false, RENDER_CACHE_ALARM_OFF));
+    CHECK(cache.hit(STD_MODE_NORMAL, 10, 26, 3, false, RENDER_CACHE_ALARM_OFF));
+    // ...Alarm-LED.
+    CHECK(!cache.hit(STD_MODE_ALARM, 10, 26, 3, false, RENDER_CACHE_ALARM_ON));
+    CHECK(cache.hit(STD_MODE_ALARM, 10, 26, 3, false, RENDER_CACHE_ALARM_ON));
+    CHECK(!cache.hit(STD_MODE_ALARM, 10, 26, 3, false, RENDER_CACHE_ALARM_OFF));
+}
+
+/**
+ * STD_MODE_ALARM: solange die Alarmzeit blinkt, wird jedes Mal gerendert.
+ */
+static void checkBlinkingAlarm() {
+    RenderCache cache;
+    CHECK(!cache.hit(STD_MODE_ALARM, 7, 30, 0, true, RENDER_CACHE_ALARM_ON));
+    CHECK(cache.hit(STD_MODE_ALARM, 7, 30, 0, true, RENDER_CACHE_ALARM_ON));
+
+    unsigned long renders = 0;
+    for (byte i = 0; i < 100; i++) {
+        if (!cache.hit(STD_MODE_ALARM, 7, 30, 0, true, RENDER_CACHE_ALARM_BLINKING)) {
+            renders++;
+        }
+        CHECK_EQUAL(RENDER_CACHE_INVALID, cache.getMode());
+    }
+    CHECK_EQUAL(100, renders);
+
+    // ...hoert es auf zu blinken, steht im Bildspeicher irgendeine Blink-Phase...
+    CHECK(!cache.hit(STD_MODE_ALARM, 7, 30, 0, true, RENDER_CACHE_ALARM_ON));
+    CHECK(cache.hit(STD_MODE_ALARM, 7, 30, 0, true, RENDER_CACHE_ALARM_ON));
+
+    // ...auch wenn nur ein Aufruf blinkt.
+    CHECK(!cache.hit(STD_MODE_ALARM, 7, 30, 0, true, RENDER_CACHE_ALARM_BLINKING));
+    CHECK(!cache.hit(STD_MODE_ALARM, 7, 30, 0, true, RENDER_CACHE_ALARM_ON));
+}
+
+/**
+ * invalidate(): die Farbe (REMOTE_BUTTON_SETCOLOR) oder der Lauftext haben den
+ * Bildspeicher geaendert, ohne dass sich der Schluessel geaendert hat.
+ */
+static void checkInvalidate() {
+    RenderCache cache;
+    CHECK(!cache.hit(STD_MODE_NORMAL, 12, 0, 1, true, RENDER_CACHE_ALARM_OFF));
+    CHECK(cache.hit(STD_MODE_NORMAL, 12, 0, 1, true, RENDER_CACHE_ALARM_OFF));
+    cache.invalidate();
+    CHECK_EQUAL(RENDER_CACHE_INVALID, cache.getMode());
+    CHECK(!cache.hit(STD_MODE_NORMAL, 12, 0, 1, true, RENDER_CACHE_ALARM_OFF));
+    CHECK_EQUAL(STD_MODE_NORMAL, cache.getMode());
+    CHECK(cache.hit(STD_MODE_NORMAL, 12, 0, 1, true, RENDER_CACHE_ALARM_OFF));
+
+    // ...auch zweimal hintereinander nur ein neues Bild...
+    cache.invalidate();
+    cache.invalidate();
+    CHECK(!cache.hit(STD_MODE_NORMAL, 12, 0, 1, true, RENDER_CACHE_ALARM_OFF));
+    CHECK(cache.hit(STD_MODE_NORMAL, 12, 0, 1, true, RENDER_CACHE_ALARM_OFF));
+}
+
+int main() {
+    checkDay(1);
+    checkDay(50);
+    checkKey();
+    checkBlinkingAlarm();
+    checkInvalidate();
+
+    return hostTestResult();
+}
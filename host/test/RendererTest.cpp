@@ -0,0 +1,76 @@
+/**
+ * RendererTest
+ * Prueft, dass der Renderer fuer jede Sprache, jede Stunde (auch mit
+ * Zeitverschiebung, -13 bis 37) und jede Minute dasselbe Bild liefert
+ * wie der Renderer mit der switch-Kaskade (Stand vor den Tabellen):
+ * setMinutes() mit setCorners() und setMinutes() mit
+ * cleanWordsForAlarmSettingMode(). Verglichen wird ein FNV-1a-Hash
+ * ueber alle Bilder einer Sprache, die Werte stammen aus dem alten Renderer.
+ *
+ * @mc       Host (Linux/macOS)
+ * @autor    agent / agent _AT_ local
+ *           Vorlage von: Christian Aschoff / caschoff _AT_ mac _DOT_ com
+ * @version  1.0
+ * @created  18.10.2026
+ *
+ * Versionshistorie:
+ * V 1.0:  - Erstellt.
+ */
+#include "HostTest.h"
+#include "Renderer.h"
+
+static const char *languageNames[LANGUAGE_COUNT + 1] = {
+    "DE_DE", "DE_SW", "DE_BA", "DE_SA", "CH", "EN", "FR", "IT", "NL", "ES"
+};
+
+#ifdef WOERTER_DE_MKF
+static const uint64_t expectedHashes[LANGUAGE_COUNT + 1] = {
+    0xbed651cb122668bdULL, 0x17710df7dc42958dULL, 0x3c61a4e95ec936cdULL, 0x590a11571eab7b85ULL,
+    0x88bf0d2805b7e2f5ULL, 0x4a779b26d8e3294dULL, 0xcb2a440f91005085ULL, 0x091ba0578cbe5215ULL,
+    0x1f8cf8b61809ea65ULL, 0xf8d263cecf148e25ULL
+};
+#else
+static const uint64_t expectedHashes[LANGUAGE_COUNT + 1] = {
+    0x7c053b59cfe9802dULL, 0x5ebfc1339c469fedULL, 0x3b110c700dd7226dULL, 0xed08ae57d2333435ULL,
+    0x88bf0d2805b7e2f5ULL, 0x4a779b26d8e3294dULL, 0xcb2a440f91005085ULL, 0x091ba0578cbe5215ULL,
+    0x1f8cf8b61809ea65ULL, 0xf8d263cecf148e25ULL
+};
+#endif
+
+static void hashMatrix(uint64_t &hash, const word matrix[16]) {
+    for (byte i = 0; i < 16; i++) {
+        byte bytes[2] = {lowByte(matrix[i]), highByte(matrix[i])};
+        for (byte b = 0; b < 2; b++) {
+            hash ^= bytes[b];
+            hash *= 0x100000001b3ULL;
+        }
+    }
+}
+
+int main() {
+    Renderer renderer;
+    word matrix[16];
+
+    for (byte language = 0; language <= LANGUAGE_COUNT; language++) {
+        uint64_t hash = 0xcbf29ce484222325ULL;
+        for (int hours = -13; hours <= 37; hours++) {
+            for (byte minutes = 0; minutes < 60; minutes++) {
+                renderer.clearScreenBuffer(matrix);
+                renderer.setMinutes(hours, minutes, language, matrix);
+                renderer.setCorners(minutes, true, matrix);
+                hashMatrix(hash, matrix);
+
+                renderer.clearScreenBuffer(matrix);
+                renderer.setMinutes(hours, minutes, language, matrix);
+                renderer.cleanWordsForAlarmSettingMode(language, matrix);
+                hashMatrix(hash, matrix);
+            }
+        }
+        if (hash != expectedHashes[language]) {
+            printf("Sprache %s:\n", languageNames[language]);
+        }
+        CHECK_EQUAL(expectedHashes[language], hash);
+    }
+
+    return hostTestResult();
+}
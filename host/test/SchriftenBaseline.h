@@ -0,0 +1,416 @@
+/**
+ * SchriftenBaseline
+ * Die Zeichen-Tabellen, die Schriften.h ersetzt hat, unveraendert aus
+ * Staben.h (V 1.1), Zahlen.h (V 1.3) und ZahlenKlein.h (V 1.0): ein Byte pro
+ * Zeile, die rechte Spalte ist Bit 0. Nur fuer SchriftenTest.
+ *
+ * @mc       Host (Linux/macOS)
+ * @autor    agent / agent _AT_ local
+ *           Vorlage von: Christian Aschoff / caschoff _AT_ mac _DOT_ com
+ * @version  1.0
+ * @created  18.10.2026
+ *
+ * Versionshistorie:
+ * V 1.0:  - Erstellt.
+ */
+#ifndef SCHRIFTEN_BASELINE_H
+#define SCHRIFTEN_BASELINE_H
+
+// Staben.h: A-Z, 5x5...
+static const char staben[][5] = {
+    { // 0:A
+        0b00001100,
+        0b00010010,
+        0b00011110,
+        0b00010010,
+        0b00010010
+    }
+    ,
+    { // 1:B
+        0b00011100,
+        0b00010010,
+        0b00011100,
+        0b00010010,
+        0b00011100
+    }
+    ,
+    { // 2:C
+        0b00001110,
+        0b00010000,
+        0b00010000,
+        0b00010000,
+        0b00001110
+    }
+    ,
+    { // 3:D
+        0b00011100,
+        0b00010010,
+        0b00010010,
+        0b00010010,
+        0b00011100
+    }
+    ,
+    { // 4:E
+        0b00011110,
+        0b00010000,
+        0b00011100,
+        0b00010000,
+        0b00011110
+    }
+    ,
+    { // 5:F
+        0b00011110,
+        0b00010000,
+        0b00011100,
+        0b00010000,
+        0b00010000
+    }
+    ,
+    { // 6:G
+        0b00001110,
+        0b00010000,
+        0b00010110,
+        0b00010010,
+        0b00001100
+    }
+    ,
+    { // 7:H
+        0b00010010,
+        0b00010010,
+        0b00011110,
+        0b00010010,
+        0b00010010
+    }
+    ,
+    { // 8:I
+        0b00001000,
+        0b00001000,
+        0b00001000,
+        0b00001000,
+        0b00001000
+    }
+    ,
+    { // 9:J
+        0b00011110,
+        0b00000010,
+        0b00000010,
+        0b00010010,
+        0b00001100
+    }
+    ,
+    { // 10:K
+        0b00010010,
+        0b00010100,
+        0b00011000,
+        0b00010100,
+        0b00010010
+    }
+    ,
+    { // 11:L
+        0b00010000,
+        0b00010000,
+        0b00010000,
+        0b00010000,
+        0b00011110
+    }
+    ,
+    { // 12:M
+        0b00010001,
+        0b00011011,
+        0b00010101,
+        0b00010001,
+        0b00010001
+    }
+    ,
+    { // 13:N
+        0b00010001,
+        0b00011001,
+        0b00010101,
+        0b00010011,
+        0b00010001
+    }
+    ,
+    { // 14:O
+        0b00001100,
+        0b00010010,
+        0b00010010,
+        0b00010010,
+        0b00001100
+    }
+    ,
+    { // 15:P
+        0b00011100,
+        0b00010010,
+        0b00011100,
+        0b00010000,
+        0b00010000
+    }
+    ,
+    { // 16:Q
+        0b00001100,
+        0b00010010,
+        0b00010010,
+        0b00001100,
+        0b00000010
+    }
+    ,
+    { // 17:R
+        0b00011100,
+        0b00010010,
+        0b00011100,
+        0b00010100,
+        0b00010010
+    }
+    ,
+    { // 18:S
+        0b00001110,
+        0b00010000,
+        0b00001100,
+        0b00000010,
+        0b00011100
+    }
+    ,
+    { // 19:T
+        0b00011111,
+        0b00000100,
+        0b00000100,
+        0b00000100,
+        0b00000100
+    }
+    ,
+    { // 20:U
+        0b00010001,
+        0b00010001,
+        0b00010001,
+        0b00010001,
+        0b00001110
+    }
+    ,
+    { // 21:V
+        0b00010001,
+        0b00010001,
+        0b00010001,
+        0b00001010,
+        0b00000100
+    }
+    ,
+    { // 22:W
+        0b00010001,
+        0b00010001,
+        0b00010101,
+        0b00011011,
+        0b00010001
+    }
+    ,
+    { // 23:X
+        0b00010001,
+        0b00001010,
+        0b00000100,
+        0b00001010,
+        0b00010001
+    }
+    ,
+    { // 24:Y
+        0b00010001,
+        0b00001010,
+        0b00000100,
+        0b00000100,
+        0b00000100
+    }
+    ,
+    { // 25:Z
+        0b00011111,
+        0b00000010,
+        0b00000100,
+        0b00001000,
+        0b00011110
+    }
+};
+
+// Zahlen.h: 0-9, 5x7...
+static const char ziffern[][7] = {
+    { // 0:0
+        0b00001110,
+        0b00010001,
+        0b00010001,
+        0b00010001,
+        0b00010001,
+        0b00010001,
+        0b00001110
+    }
+    ,
+    { // 1:1
+        0b00000100,
+        0b00001100,
+        0b00000100,
+        0b00000100,
+        0b00000100,
+        0b00000100,
+        0b00001110
+    }
+    ,
+    { // 2:2
+        0b00001110,
+        0b00010001,
+        0b00000001,
+        0b00000010,
+        0b00000100,
+        0b00001000,
+        0b00011111
+    }
+    ,
+    { // 3:3
+        0b00011111,
+        0b00000010,
+        0b00000100,
+        0b00000010,
+        0b00000001,
+        0b00010001,
+        0b00001110
+    }
+    ,
+    { // 4:4
+        0b00000010,
+        0b00000110,
+        0b00001010,
+        0b00010010,
+        0b00011111,
+        0b00000010,
+        0b00000010
+    }
+    ,
+    { // 5:5
+        0b00011111,
+        0b00010000,
+        0b00011110,
+        0b00000001,
+        0b00000001,
+        0b00010001,
+        0b00001110
+    }
+    ,
+    { // 6:6
+        0b00000110,
+        0b00001000,
+        0b00010000,
+        0b00011110,
+        0b00010001,
+        0b00010001,
+        0b00001110
+    }
+    ,
+    { // 7:7
+        0b00011111,
+        0b00000001,
+        0b00000010,
+        0b00000100,
+        0b00001000,
+        0b00001000,
+        0b00001000
+    }
+    ,
+    { // 8:8
+        0b00001110,
+        0b00010001,
+        0b00010001,
+        0b00001110,
+        0b00010001,
+        0b00010001,
+        0b00001110
+    }
+    ,
+    { // 9:9
+        0b00001110,
+        0b00010001,
+        0b00010001,
+        0b00001111,
+        0b00000001,
+        0b00000010,
+        0b00001100
+    }
+};
+
+// ZahlenKlein.h: 0-9, 4x5...
+static const char ziffernKlein[][5] = {
+    { // 0:0
+        0b0110,
+        0b1001,
+        0b1001,
+        0b1001,
+        0b0110
+    }
+    ,
+    { // 1:1
+        0b0010,
+        0b0110,
+        0b0010,
+        0b0010,
+        0b0111
+    }
+    ,
+    { // 2:2
+        0b0110,
+        0b1001,
+        0b0010,
+        0b0100,
+        0b1111
+    }
+    ,
+    { // 3:3
+        0b1110,
+        0b0001,
+        0b0110,
+        0b0001,
+        0b1110
+    }
+    ,
+    { // 4:4
+        0b0010,
+        0b0110,
+        0b1010,
+        0b1111,
+        0b0010
+    }
+    ,
+    { // 5:5
+        0b1111,
+        0b1000,
+        0b1110,
+        0b0001,
+        0b1110
+    }
+    ,
+    { // 6:6
+        0b0110,
+        0b1000,
+        0b1110,
+        0b1001,
+        0b0110
+    }
+    ,
+    { // 7:7
+        0b1111,
+        0b0001,
+        0b0010,
+        0b0100,
+        0b1000
+    }
+    ,
+    { // 8:8
+        0b0110,
+        0b1001,
+        0b0110,
+        0b1001,
+        0b0110
+    }
+    ,
+    { // 9:9
+        0b0110,
+        0b1001,
+        0b0111,
+        0b0001,
+        0b0110
+    }
+};
+
+#endif
@@ -0,0 +1,205 @@
+/**
+ * SchriftenTest
+ * Prueft den Zeichen-Atlas (Schriften.h) und Renderer::writeChar() gegen die
+ * Tabellen, die er ersetzt hat (SchriftenBaseline.h, aus Staben.h, Zahlen.h
+ * und ZahlenKlein.h):
+ * - jedes Zeichen jeder Schrift Zeile fuer Zeile (getCharRows(), Breite, Hoehe),
+ * - writeChar() an jeder Stelle, an die die alten write*-Funktionen schreiben
+ *   konnten, gegen die alte Schleife (Zeile << posx, ODER),
+ * - write4SmallDigits() fuer 00 00 bis 99 99 wie im Sketch,
+ * - das Clipping: jedes Zeichen an jeder Stelle, auch teilweise oder ganz
+ *   ausserhalb der 11x10 Buchstaben, gegen ein Setzen Pixel fuer Pixel. Der
+ *   Hintergrund ist zufaellig, ausserhalb des Zeichens (Eck-LEDs, Alarm-LED,
+ *   Zeilen 10 bis 15) darf sich nichts aendern.
+ *
+ * @mc       Host (Linux/macOS)
+ * @autor    agent / agent _AT_ local
+ *           Vorlage von: Christian Aschoff / caschoff _AT_ mac _DOT_ com
+ * @version  1.0
+ * @created  18.10.2026
+ *
+ * Versionshistorie:
+ * V 1.0:  - Erstellt.
+ */
+#include "HostArduino.h"
+#include "HostTest.h"
+#include "Renderer.h"
+#include "SchriftenBaseline.h"
+
+/**
+ * Eine Schrift und ihre alte Tabelle.
+ */
+struct BaselineSchrift {
+    const char *name;
+    byte schrift;
+    char first;
+    byte count;
+    byte width;
+    byte height;
+    const char *rows;
+};
+
+static const BaselineSchrift baselineSchriften[] = {
+    {"Staben", SCHRIFT_STABEN, 'A', 26, 5, 5, &staben[0][0]},
+    {"Ziffern", SCHRIFT_ZIFFERN, '0', 10, 5, 7, &ziffern[0][0]},
+    {"ZiffernKlein", SCHRIFT_ZIFFERN_KLEIN, '0', 10, 4, 5, &ziffernKlein[0][0]}
+};
+
+static byte baselineRow(const BaselineSchrift &s, char c, byte r) {
+    return s.rows[(c - s.first) * s.height + r];
+}
+
+static void randomMatrix(word matrix[16]) {
+    for (byte y = 0; y < 16; y++) {
+        matrix[y] = random(0x10000);
+    }
+}
+
+/**
+ * Zeilen, Breite und Hoehe jedes Zeichens, die alten Zeilen sind nicht breiter
+ * als die Schrift. Zeichen ausserhalb der Schrift gibt es nicht.
+ */
+static void checkGlyphs(Renderer &renderer, const BaselineSchrift &s) {
+    CHECK_EQUAL(s.height, renderer.getCharHeight(s.schrift));
+    unsigned long wrong = 0;
+    for (char c = s.first; c < s.first + s.count; c++) {
+        byte rows[8];
+        CHECK_EQUAL(s.width, renderer.getCharRows(s.schrift, c, rows));
+        for (byte r = 0; r < s.height; r++) {
+            CHECK_EQUAL(0, baselineRow(s, c, r) & ~((1 << s.width) - 1));
+            if (rows[r] != baselineRow(s, c, r)) {
+                printf("%s '%c' Zeile %d: 0x%02x statt 0x%02x\n", s.name, c, r, rows[r], baselineRow(s, c, r));
+                wrong++;
+            }
+        }
+    }
+    CHECK_EQUAL(0, wrong);
+
+    byte rows[8];
+    CHECK_EQUAL(0, renderer.getCharRows(s.schrift, s.first - 1, rows));
+    CHECK_EQUAL(0, renderer.getCharRows(s.schrift, s.first + s.count, rows));
+    CHECK_EQUAL(0, renderer.getCharRows(s.schrift, ' ', rows));
+}
+
+/**
+ * writeChar() gegen die alte Schleife der write*-Funktionen: die Zeilen um
+ * posx verschoben in die Matrix geodert, mit posx so, dass das Zeichen ganz in
+ * den Spalten 0 bis 10 steht (wie write1xyStab und write1xyDigit im Sketch,
+ * die linke Spalte x ist 16 - posx - Breite).
+ */
+static void checkOldPositions(Renderer &renderer, const BaselineSchrift &s) {
+    unsigned long wrong = 0;
+    for (char c = s.first; c < s.first + s.count; c++) {
+        for (byte posx = 5; posx <= 16 - s.width; posx++) {
+            for (byte posy = 0; posy <= 10 - s.height; posy++) {
+                word matrix[16];
+                word expected[16];
+                randomMatrix(matrix);
+                memcpy(expected, matrix, sizeof(matrix));
+                for (byte i = 0; i < s.height; i++) {
+                    expected[posy + i] |= baselineRow(s, c, i) << posx;
+                }
+                renderer.writeChar(s.schrift, c, 16 - posx - s.width, posy, matrix);
+                if (memcmp(matrix, expected, sizeof(matrix)) != 0) {
+                    if (wrong < 10) {
+                        printf("%s '%c' an posx %d, posy %d anders als frueher\n", s.name, c, posx, posy);
+                    }
+                    wrong++;
+                }
+            }
+        }
+    }
+    CHECK_EQUAL(0, wrong);
+}
+
+/**
+ * Jedes Zeichen an jeder Stelle von ganz links/oben draussen bis ganz
+ * rechts/unten draussen, gegen Pixel fuer Pixel mit Clipping.
+ */
+static void checkClipping(Renderer &renderer, const BaselineSchrift &s) {
+    unsigned long wrong = 0;
+    unsigned long positions = 0;
+    for (char c = s.first; c < s.first + s.count; c++) {
+        for (int x = -s.width - 1; x <= 12; x++) {
+            for (int y = -s.height - 1; y <= 11; y++, positions++) {
+                word matrix[16];
+                word expected[16];
+                randomMatrix(matrix);
+                memcpy(expected, matrix, sizeof(matrix));
+                for (byte r = 0; r < s.height; r++) {
+                    for (byte col = 0; col < s.width; col++) {
+                        int px = x + col;
+                        int py = y + r;
+                        boolean set = baselineRow(s, c, r) & (1 << (s.width - 1 - col));
+                        if (set && (px >= 0) && (px < 11) && (py >= 0) && (py < 10)) {
+                            expected[py] |= 0b1000000000000000 >> px;
+                        }
+                    }
+                }
+                renderer.writeChar(s.schrift, c, x, y, matrix);
+                if (memcmp(matrix, expected, sizeof(matrix)) != 0) {
+                    if (wrong < 10) {
+                        printf("%s '%c' an x %d, y %d falsch abgeschnitten\n", s.name, c, x, y);
+                    }
+                    wrong++;
+                }
+            }
+        }
+    }
+    printf("%s: %d Zeichen, %lu Stellen mit Clipping\n", s.name, s.count, positions);
+    CHECK_EQUAL(0, wrong);
+
+    // ...Zeichen, die es in der Schrift nicht gibt, schreiben nichts...
+    word matrix[16];
+    word expected[16];
+    randomMatrix(matrix);
+    memcpy(expected, matrix, sizeof(matrix));
+    renderer.writeChar(s.schrift, s.first - 1, 3, 2, matrix);
+    renderer.writeChar(s.schrift, s.first + s.count, 3, 2, matrix);
+    renderer.writeChar(s.schrift, 'a', 3, 2, matrix);
+    CHECK(memcmp(matrix, expected, sizeof(matrix)) == 0);
+}
+
+/**
+ * write4SmallDigits() aus dem Sketch, alt und neu.
+ */
+static void checkSmallDigits(Renderer &renderer) {
+    unsigned long wrong = 0;
+    for (byte firstNumber = 0; firstNumber < 100; firstNumber++) {
+        for (byte secondNumber = 0; secondNumber < 100; secondNumber++) {
+            word expected[16];
+            renderer.clearScreenBuffer(expected);
+            for (byte i = 0; i < 5; i++) {
+                expected[0 + i] |= ziffernKlein[firstNumber / 10][i] << 12;
+                expected[0 + i] |= ziffernKlein[firstNumber % 10][i] << 7;
+                expected[5 + i] |= ziffernKlein[secondNumber / 10][i] << 12;
+                expected[5 + i] |= ziffernKlein[secondNumber % 10][i] << 7;
+            }
+
+            word matrix[16];
+            renderer.clearScreenBuffer(matrix);
+            renderer.writeChar(SCHRIFT_ZIFFERN_KLEIN, '0' + firstNumber / 10, 0, 0, matrix);
+            renderer.writeChar(SCHRIFT_ZIFFERN_KLEIN, '0' + firstNumber % 10, 5, 0, matrix);
+            renderer.writeChar(SCHRIFT_ZIFFERN_KLEIN, '0' + secondNumber / 10, 0, 5, matrix);
+            renderer.writeChar(SCHRIFT_ZIFFERN_KLEIN, '0' + secondNumber % 10, 5, 5, matrix);
+            if (memcmp(matrix, expected, sizeof(matrix)) != 0) {
+                wrong++;
+            }
+        }
+    }
+    CHECK_EQUAL(0, wrong);
+}
+
+int main() {
+    Renderer renderer;
+    randomSeed(10);
+
+    for (byte i = 0; i < sizeof(baselineSchriften) / sizeof(baselineSchriften[0]); i++) {
+        checkGlyphs(renderer, baselineSchriften[i]);
+        checkOldPositions(renderer, baselineSchriften[i]);
+        checkClipping(renderer, baselineSchriften[i]);
+    }
+    checkSmallDigits(renderer);
+
+    return hostTestResult();
+}
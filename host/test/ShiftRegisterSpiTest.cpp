@@ -0,0 +1,64 @@
+/**
+ * ShiftRegisterSpiTest
+ * Prueft die Shift-Register mit SHIFTREGISTER_SPI: die Treiber werden wie im
+ * Sketch als globale Objekte angelegt, ihre Konstruktoren starten SPI nicht,
+ * das macht erst init() (ShiftRegister::begin()). Danach geht kein Byte vor
+ * SPI.begin() raus, und eine Zeile von LedDriverDefault kommt als 32 Bit am
+ * Stueck (Spalten invertiert, dann die Zeile, Low-Byte zuerst).
+ *
+ * @mc       Host (Linux/macOS)
+ * @autor    agent / agent _AT_ local
+ *           Vorlage von: Christian Aschoff / caschoff _AT_ mac _DOT_ com
+ * @version  1.0
+ * @created  18.10.2026
+ *
+ * Versionshistorie:
+ * V 1.0:  - Erstellt.
+ */
+#include "HostArduino.h"
+#include "HostTest.h"
+#include "Renderer.h"
+#include "LedDriverDefault.h"
+#include "LedDriverPowerShiftRegister.h"
+#include <SPI.h>
+
+// wie im Sketch mit SHIFTREGISTER_SPI: Data an MOSI (11), Clock an SCK (13), Latch an SS (10)...
+LedDriverDefault ledDriverDefault(11, 13, 10, 3, 10);
+LedDriverPowerShiftRegister ledDriverPowerShiftRegister(11, 13, 10, 3);
+
+int main() {
+    // kein hostReset(), das wuerde SPI zuruecksetzen...
+    CHECK(!SPI.isBegun());
+    CHECK_EQUAL(0, hostCounters.spiBytes);
+
+    Renderer renderer;
+    word matrix[16];
+    renderer.clearScreenBuffer(matrix);
+    renderer.setMinutes(10, 25, LANGUAGE_DE_DE, matrix);
+
+    ledDriverDefault.init();
+    CHECK(SPI.isBegun());
+    ledDriverDefault.setBrightness(50);
+    ledDriverDefault.wakeUp();
+    ledDriverDefault.clearData();
+    // nur die erste Zeile, dann stehen ihre 32 Bit vor den 32 Bit zum Ausschalten...
+    ledDriverDefault.setLinesToWrite(1);
+    ledDriverDefault.writeScreenBufferToMatrix(matrix, true);
+    word columns = ~matrix[0];
+    CHECK_EQUAL(lowByte(columns), SPI.history(7));
+    CHECK_EQUAL(highByte(columns), SPI.history(6));
+    CHECK_EQUAL(1, SPI.history(5));
+    CHECK_EQUAL(0, SPI.history(4));
+    CHECK_EQUAL(0xFF, SPI.history(3));
+    CHECK_EQUAL(0xFF, SPI.history(2));
+    CHECK_EQUAL(0, SPI.history(1));
+    CHECK_EQUAL(0, SPI.history(0));
+
+    ledDriverPowerShiftRegister.init();
+    ledDriverPowerShiftRegister.writeScreenBufferToMatrix(matrix, true);
+
+    CHECK(hostCounters.spiBytes > 0);
+    CHECK_EQUAL(0, hostCounters.spiBytesBeforeBegin);
+
+    return hostTestResult();
+}
@@ -0,0 +1,98 @@
+/**
+ * SprachenTest
+ * Prueft die Sprachbeschreibung (Sprachen.h, Woerter_*.h) fuer sich:
+ * jedes Wort liegt in den Zeilen 0-9 und den Spalten der Buchstaben,
+ * jede Sprache hat 12 Minuten-Phrasen und 2x13 Stunden, und Phrasen,
+ * Stunden und Alarm-Woerter verweisen nur auf vorhandene Woerter.
+ * Dass die Tabellen dieselben Bilder ergeben wie der alte Renderer,
+ * prueft RendererTest.
+ *
+ * @mc       Host (Linux/macOS)
+ * @autor    agent / agent _AT_ local
+ *           Vorlage von: Christian Aschoff / caschoff _AT_ mac _DOT_ com
+ * @version  1.0
+ * @created  18.10.2026
+ *
+ * Versionshistorie:
+ * V 1.0:  - Erstellt.
+ */
+#include "HostTest.h"
+#include "Renderer.h"
+#include "Sprachen.h"
+
+#define TABLE(t) {t, sizeof(t) / sizeof(t[0])}
+
+struct Table {
+    const void *table;
+    size_t count;
+};
+
+static const Table woerterTables[] = {
+    TABLE(woerter_DE), TABLE(woerter_CH), TABLE(woerter_EN), TABLE(woerter_FR),
+    TABLE(woerter_IT), TABLE(woerter_NL), TABLE(woerter_ES)
+};
+
+static const Table phrasenTables[] = {
+    TABLE(phrasen_DE_DE), TABLE(phrasen_DE_SW), TABLE(phrasen_DE_BA), TABLE(phrasen_DE_SA),
+    TABLE(phrasen_CH), TABLE(phrasen_EN), TABLE(phrasen_FR), TABLE(phrasen_IT),
+    TABLE(phrasen_NL), TABLE(phrasen_ES)
+};
+
+static const Table stundenTables[] = {
+    TABLE(stunden_DE), TABLE(stunden_CH), TABLE(stunden_EN), TABLE(stunden_FR),
+    TABLE(stunden_IT), TABLE(stunden_NL), TABLE(stunden_ES)
+};
+
+static size_t countOf(const Table *tables, size_t tableCount, const void *table) {
+    for (size_t i = 0; i < tableCount; i++) {
+        if (tables[i].table == table) {
+            return tables[i].count;
+        }
+    }
+    return 0;
+}
+
+// Nur Woerter mit einem Index kleiner als count...
+static bool wordsExist(uint32_t words, size_t count) {
+    return (count >= 30) || ((words >> count) == 0);
+}
+
+int main() {
+    CHECK_EQUAL(LANGUAGE_COUNT + 1, sizeof(sprachen) / sizeof(sprachen[0]));
+
+    for (byte i = 0; i < sizeof(woerterTables) / sizeof(woerterTables[0]); i++) {
+        const word *woerter = (const word *)woerterTables[i].table;
+        CHECK(woerterTables[i].count <= 30);
+        for (size_t n = 0; n < woerterTables[i].count; n++) {
+            word wort = woerter[n];
+            CHECK(WORT_ZEILE(wort) < 10);
+            CHECK(WORT_SPALTEN(wort) != 0);
+            // Bit 4 ist weder Zeile noch Spalte...
+            CHECK((wort & 0b0000000000010000) == 0);
+        }
+    }
+
+    for (byte language = 0; language <= LANGUAGE_COUNT; language++) {
+        const Sprache &sprache = sprachen[language];
+        size_t woerter = countOf(woerterTables, sizeof(woerterTables) / sizeof(woerterTables[0]), sprache.woerter);
+        CHECK(woerter > 0);
+        CHECK_EQUAL(12, countOf(phrasenTables, sizeof(phrasenTables) / sizeof(phrasenTables[0]), sprache.phrasen));
+        CHECK_EQUAL(2, countOf(stundenTables, sizeof(stundenTables) / sizeof(stundenTables[0]), sprache.stunden));
+
+        for (byte p = 0; p < 12; p++) {
+            uint32_t phrase = sprache.phrasen[p];
+            CHECK(wordsExist(phrase & PHRASE_WORDS, woerter));
+        }
+        for (byte glatt = 0; glatt < 2; glatt++) {
+            for (byte h = 0; h < 13; h++) {
+                CHECK(sprache.stunden[glatt][h] != 0);
+                CHECK(wordsExist(sprache.stunden[glatt][h], woerter));
+                CHECK((sprache.stunden[glatt][h] & ~PHRASE_WORDS) == 0);
+            }
+        }
+        CHECK(sprache.alarmWoerter != 0);
+        CHECK(wordsExist(sprache.alarmWoerter, woerter));
+    }
+
+    return hostTestResult();
+}
@@ -0,0 +1,106 @@
+/**
+ * TransitionTest
+ * Prueft die Uebergaenge fuer alle Minutenwechsel eines Tages (Deutsch und
+ * Englisch) mit allen Effekten: jedes Zwischenbild besteht nur aus Pixeln des
+ * alten oder des neuen Bildes, der letzte Schritt ist das Zielbild, und mit
+ * LED_DRIVER_PALETTE hat jeder leuchtende Pixel den Farbplatz des Bildes, aus
+ * dem er stammt (die Stunden-Woerter aus Renderer::setHours()).
+ *
+ * @mc       Host (Linux/macOS)
+ * @autor    agent / agent _AT_ local
+ *           Vorlage von: Christian Aschoff / caschoff _AT_ mac _DOT_ com
+ * @version  1.0
+ * @created  18.10.2026
+ *
+ * Versionshistorie:
+ * V 1.0:  - Erstellt.
+ */
+#include "HostArduino.h"
+#include "HostTest.h"
+#include "Renderer.h"
+#include "Transition.h"
+
+#define PIXELS 0b1111111111100000
+
+static void render(Renderer &renderer, unsigned int m, byte language, word matrix[16], word hours[16]) {
+    renderer.clearScreenBuffer(matrix);
+    renderer.setMinutes(m / 60, m % 60, language, matrix);
+    renderer.setCorners(m % 60, true, matrix);
+    renderer.clearScreenBuffer(hours);
+    renderer.setHours(m / 60, m % 60, language, hours);
+}
+
+int main() {
+    hostReset();
+    Renderer renderer;
+    Transition transition;
+    static const byte languages[] = {LANGUAGE_DE_DE, LANGUAGE_EN};
+    unsigned long badPixels = 0;
+    unsigned long badSlots = 0;
+    unsigned long badEnds = 0;
+    unsigned long slotChanges = 0;
+
+    for (byte l = 0; l < sizeof(languages); l++) {
+        for (byte effect = TRANSITION_WIPE; effect <= TRANSITION_CROSSFADE; effect++) {
+            word from[16], fromHours[16];
+            render(renderer, 24 * 60 - 1, languages[l], from, fromHours);
+            for (unsigned int m = 0; m < 24 * 60; m++) {
+                word to[16], toHours[16], matrix[16];
+                render(renderer, m, languages[l], to, toHours);
+                for (byte y = 0; y < 10; y++) {
+                    if (fromHours[y] != toHours[y]) {
+                        slotChanges++;
+                        break;
+                    }
+                }
+
+                memcpy(matrix, from, sizeof(matrix));
+                transition.begin(from, to, effect);
+#ifdef LED_DRIVER_PALETTE
+                transition.setSlotMasks(fromHours, toHours);
+#endif
+                while (transition.isRunning()) {
+                    CHECK(transition.step(matrix));
+#ifdef LED_DRIVER_PALETTE
+                    word slots[16];
+                    transition.getSlotMask(slots);
+#endif
+                    for (byte y = 0; y < 10; y++) {
+                        word lit = matrix[y] & PIXELS;
+                        if (lit & ~(from[y] | to[y])) {
+                            badPixels++;
+                        }
+#ifdef LED_DRIVER_PALETTE
+                        // Pixel nur aus dem alten bzw. nur aus dem neuen Bild haben dessen Farbplatz...
+                        word onlyFrom = lit & from[y] & ~to[y];
+                        word onlyTo = lit & to[y] & ~from[y];
+                        if (((slots[y] ^ fromHours[y]) & onlyFrom) || ((slots[y] ^ toHours[y]) & onlyTo)) {
+                            badSlots++;
+                        }
+#endif
+                    }
+                    hostAdvanceMicros(TRANSITION_STEP_MILLIS * 1000UL);
+                }
+                if (memcmp(matrix, to, 10 * sizeof(word)) != 0) {
+                    badEnds++;
+                }
+#ifdef LED_DRIVER_PALETTE
+                word slots[16];
+                transition.getSlotMask(slots);
+                if (memcmp(slots, toHours, 10 * sizeof(word)) != 0) {
+                    badEnds++;
+                }
+#endif
+                memcpy(from, to, sizeof(from));
+                memcpy(fromHours, toHours, sizeof(fromHours));
+            }
+        }
+    }
+
+    // sonst prueft der Test nichts...
+    CHECK(slotChanges > 0);
+    CHECK_EQUAL(0, badPixels);
+    CHECK_EQUAL(0, badSlots);
+    CHECK_EQUAL(0, badEnds);
+    return hostTestResult();
+}
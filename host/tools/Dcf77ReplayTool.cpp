@@ -0,0 +1,86 @@
+/**
+ * Dcf77ReplayTool
+ * Schickt Aufzeichnungen des DCF77Recorder (MYDCF77_RECORDER) durch die echten
+ * MyDCF77, DCF77Helper und MyRTC (ueber Wire), wie im Sketch, und gibt jede
+ * Synchronisation aus: die decodierte Zeit und ob der DCF77Helper die RTC
+ * gestellt hat. Uebersetzt mit der ausgelieferten Configuration.h, weitere
+ * Schalter (z.B. MYDCF77_MATCHED_FILTER) per DEFINITIONS in CMakeLists.txt.
+ *
+ * Aufruf: dcf77_replay aufzeichnung... (- fuer stdin)
+ *
+ * @mc       Host (Linux/macOS)
+ * @autor    agent / agent _AT_ local
+ *           Vorlage von: Christian Aschoff / caschoff _AT_ mac _DOT_ com
+ * @version  1.0
+ * @created  18.10.2026
+ *
+ * Versionshistorie:
+ * V 1.0:  - Erstellt.
+ */
+#include "HostArduino.h"
+#include "Dcf77ReplayDriver.h"
+#include <string.h>
+
+#define DCF77_PIN 9
+#define DCF77_LED 8
+
+/**
+ * Eine Aufzeichnung abspielen.
+ */
+static bool replayRecording(const char *path) {
+    FILE *file = strcmp(path, "-") ? fopen(path, "rb") : stdin;
+    if (!file) {
+        printf("%s: nicht lesbar\n", path);
+        return false;
+    }
+    hostReset();
+    MyDCF77 dcf77(DCF77_PIN, DCF77_LED);
+    MyRTC rtc(0x68, 4);
+    DCF77Helper helper;
+    Dcf77ReplayDriver driver(&dcf77, &rtc, &helper, DCF77_PIN);
+    unsigned long start = micros();
+    byte droppedWords = 0;
+    int c;
+    while ((c = fgetc(file)) != EOF) {
+        driver.feed(c);
+        if (driver.getReplay()->getDroppedWords() > droppedWords) {
+            droppedWords = driver.getReplay()->getDroppedWords();
+        }
+    }
+    if (file != stdin) {
+        fclose(file);
+    }
+    if (!driver.getReplay()->getHeaders()) {
+        printf("%s: kein Kopf, keine Aufzeichnung\n", path);
+        return false;
+    }
+    // ...bis zur naechsten Sekunde, falls die Aufzeichnung mit einer Minutenmarke endet...
+    driver.finish(DCF77_SIM_SECOND);
+
+    unsigned long ok = 0;
+    for (size_t i = 0; i < driver.syncs.size(); i++) {
+        const Dcf77ReplaySync &sync = driver.syncs[i];
+        printf("  %8.1f s: %02d:%02d %02d.%02d.%02d (%d) %s\n", (sync.time - start) / 1e6, sync.decoded.hours,
+               sync.decoded.minutes, sync.decoded.date, sync.decoded.month, sync.decoded.year, sync.decoded.dayOfWeek,
+               sync.ok ? "RTC gestellt" : "DCF77Helper nicht ok");
+        if (sync.ok) {
+            ok++;
+        }
+    }
+    printf("%s: %.0f s, %lu Koepfe (%lu nach kaputten Stuecken), %lu verlorene Worte, %lu Synchronisationen, %lu mit RTC gestellt\n",
+           path, (micros() - start) / 1e6, driver.getReplay()->getHeaders(), driver.getReplay()->getResyncs(),
+           (unsigned long)droppedWords, (unsigned long)driver.syncs.size(), ok);
+    return true;
+}
+
+int main(int argc, char **argv) {
+    if (argc < 2) {
+        printf("Aufruf: %s aufzeichnung... (- fuer stdin)\n", argv[0]);
+        return 2;
+    }
+    bool ok = true;
+    for (int i = 1; i < argc; i++) {
+        ok &= replayRecording(argv[i]);
+    }
+    return ok ? 0 : 1;
+}